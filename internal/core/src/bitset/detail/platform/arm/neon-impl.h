@@ -827,6 +827,133 @@ OpCompareColumnImpl<double, double, Op>::op_compare_column(
     return true;
 }
 
+namespace {
+
+// loads 8 elements, promoted to 64 bits
+inline int64x2x4_t
+load_8x_i64(const int32_t* const __restrict src) {
+    const int32x4_t v0 = vld1q_s32(src);
+    const int32x4_t v1 = vld1q_s32(src + 4);
+    return {vmovl_s32(vget_low_s32(v0)),
+            vmovl_high_s32(v0),
+            vmovl_s32(vget_low_s32(v1)),
+            vmovl_high_s32(v1)};
+}
+
+inline int64x2x4_t
+load_8x_i64(const int64_t* const __restrict src) {
+    return {vld1q_s64(src),
+            vld1q_s64(src + 2),
+            vld1q_s64(src + 4),
+            vld1q_s64(src + 6)};
+}
+
+inline float64x2x4_t
+load_8x_f64(const float* const __restrict src) {
+    const float32x4_t v0 = vld1q_f32(src);
+    const float32x4_t v1 = vld1q_f32(src + 4);
+    return {vcvt_f64_f32(vget_low_f32(v0)),
+            vcvt_high_f64_f32(v0),
+            vcvt_f64_f32(vget_low_f32(v1)),
+            vcvt_high_f64_f32(v1)};
+}
+
+inline float64x2x4_t
+load_8x_f64(const double* const __restrict src) {
+    return {vld1q_f64(src),
+            vld1q_f64(src + 2),
+            vld1q_f64(src + 4),
+            vld1q_f64(src + 6)};
+}
+
+template <typename T, typename U, CompareOpType Op>
+bool
+op_compare_column_i64(uint8_t* const __restrict res_u8,
+                      const T* const __restrict left,
+                      const U* const __restrict right,
+                      const size_t size) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    for (size_t i = 0; i < size; i += 8) {
+        const int64x2x4_t v0l = load_8x_i64(left + i);
+        const int64x2x4_t v0r = load_8x_i64(right + i);
+        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template <typename T, typename U, CompareOpType Op>
+bool
+op_compare_column_f64(uint8_t* const __restrict res_u8,
+                      const T* const __restrict left,
+                      const U* const __restrict right,
+                      const size_t size) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    for (size_t i = 0; i < size; i += 8) {
+        const float64x2x4_t v0l = load_8x_f64(left + i);
+        const float64x2x4_t v0r = load_8x_f64(right + i);
+        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+}  // namespace
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<int32_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left,
+    const int64_t* const __restrict right,
+    const size_t size) {
+    return op_compare_column_i64<int32_t, int64_t, Op>(
+        res_u8, left, right, size);
+}
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<int64_t, int32_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int64_t* const __restrict left,
+    const int32_t* const __restrict right,
+    const size_t size) {
+    return op_compare_column_i64<int64_t, int32_t, Op>(
+        res_u8, left, right, size);
+}
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<float, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict left,
+    const double* const __restrict right,
+    const size_t size) {
+    return op_compare_column_f64<float, double, Op>(
+        res_u8, left, right, size);
+}
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<double, float, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict left,
+    const float* const __restrict right,
+    const size_t size) {
+    return op_compare_column_f64<double, float, Op>(
+        res_u8, left, right, size);
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 //
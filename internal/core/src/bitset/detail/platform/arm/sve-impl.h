@@ -1056,6 +1056,112 @@ OpCompareColumnImpl<double, double, Op>::op_compare_column(
     return op_compare_column_impl<double, Op>(res_u8, left, right, size);
 }
 
+namespace {
+
+// loads the elements under a predicate for 64-bit lanes, promoted to
+//   64 bits
+inline svint64_t
+load_i64(const svbool_t pred, const int32_t* const __restrict src) {
+    return svld1sw_s64(pred, src);
+}
+
+inline svint64_t
+load_i64(const svbool_t pred, const int64_t* const __restrict src) {
+    return svld1_s64(pred, src);
+}
+
+inline svfloat64_t
+load_f64(const svbool_t pred, const float* const __restrict src) {
+    // every float lands in the even half of a 64-bit lane, which is
+    //   the one svcvt_f64_f32 converts
+    const svuint64_t v =
+        svld1uw_u64(pred, reinterpret_cast<const uint32_t*>(src));
+    return svcvt_f64_f32_x(pred, svreinterpret_f32_u64(v));
+}
+
+inline svfloat64_t
+load_f64(const svbool_t pred, const double* const __restrict src) {
+    return svld1_f64(pred, src);
+}
+
+template <typename T, typename U, CompareOpType CmpOp>
+bool
+op_compare_column_i64(uint8_t* const __restrict res_u8,
+                      const T* const __restrict left,
+                      const U* const __restrict right,
+                      const size_t size) {
+    auto handler = [left, right](const svbool_t pred, const size_t idx) {
+        const svint64_t left_v = load_i64(pred, left + idx);
+        const svint64_t right_v = load_i64(pred, right + idx);
+        const svbool_t cmp = CmpHelper<CmpOp>::compare(pred, left_v, right_v);
+        return cmp;
+    };
+
+    return op_mask_helper<int64_t, decltype(handler)>(res_u8, size, handler);
+}
+
+template <typename T, typename U, CompareOpType CmpOp>
+bool
+op_compare_column_f64(uint8_t* const __restrict res_u8,
+                      const T* const __restrict left,
+                      const U* const __restrict right,
+                      const size_t size) {
+    auto handler = [left, right](const svbool_t pred, const size_t idx) {
+        const svfloat64_t left_v = load_f64(pred, left + idx);
+        const svfloat64_t right_v = load_f64(pred, right + idx);
+        const svbool_t cmp = CmpHelper<CmpOp>::compare(pred, left_v, right_v);
+        return cmp;
+    };
+
+    return op_mask_helper<double, decltype(handler)>(res_u8, size, handler);
+}
+
+}  // namespace
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<int32_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left,
+    const int64_t* const __restrict right,
+    const size_t size) {
+    return op_compare_column_i64<int32_t, int64_t, Op>(
+        res_u8, left, right, size);
+}
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<int64_t, int32_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int64_t* const __restrict left,
+    const int32_t* const __restrict right,
+    const size_t size) {
+    return op_compare_column_i64<int64_t, int32_t, Op>(
+        res_u8, left, right, size);
+}
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<float, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict left,
+    const double* const __restrict right,
+    const size_t size) {
+    return op_compare_column_f64<float, double, Op>(
+        res_u8, left, right, size);
+}
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<double, float, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict left,
+    const float* const __restrict right,
+    const size_t size) {
+    return op_compare_column_f64<double, float, Op>(
+        res_u8, left, right, size);
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 namespace {
@@ -121,6 +121,22 @@ ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_SVE, double)
 
 #undef INSTANTIATE_COMPARE_COLUMN_SVE
 
+//
+#define INSTANTIATE_COMPARE_COLUMN_PROMOTED_SVE(TTYPE, UTYPE, OP)            \
+    template bool                                                            \
+    OpCompareColumnImpl<TTYPE, UTYPE, CompareOpType::OP>::op_compare_column( \
+        uint8_t* const __restrict bitmask,                                   \
+        const TTYPE* const __restrict left,                                  \
+        const UTYPE* const __restrict right,                                 \
+        const size_t size);
+
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_PROMOTED_SVE, int32_t, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_PROMOTED_SVE, int64_t, int32_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_PROMOTED_SVE, float, double)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_PROMOTED_SVE, double, float)
+
+#undef INSTANTIATE_COMPARE_COLUMN_PROMOTED_SVE
+
 ///////////////////////////////////////////////////////////////////////////
 
 //
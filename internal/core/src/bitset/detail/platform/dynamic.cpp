@@ -119,6 +119,10 @@ ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, int32_t, int32_t)
 ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, int64_t, int64_t)
 ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, float, float)
 ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, double, double)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, int32_t, int64_t)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, int64_t, int32_t)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, float, double)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, double, float)
 
 #undef DECLARE_OP_COMPARE_COLUMN
 
@@ -146,6 +150,25 @@ ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_IMPL, double)
 
 #undef DISPATCH_OP_COMPARE_COLUMN_IMPL
 
+#define DISPATCH_OP_COMPARE_COLUMN_PROMOTED_IMPL(TTYPE, UTYPE, OP)           \
+    template <>                                                              \
+    bool                                                                     \
+    OpCompareColumnImpl<TTYPE, UTYPE, CompareOpType::OP>::op_compare_column( \
+        uint8_t* const __restrict bitmask,                                   \
+        const TTYPE* const __restrict t,                                     \
+        const UTYPE* const __restrict u,                                     \
+        const size_t size) {                                                 \
+        return op_compare_column_##TTYPE##_##UTYPE##_##OP(                   \
+            bitmask, t, u, size);                                            \
+    }
+
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_PROMOTED_IMPL, int32_t, int64_t)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_PROMOTED_IMPL, int64_t, int32_t)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_PROMOTED_IMPL, float, double)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_PROMOTED_IMPL, double, float)
+
+#undef DISPATCH_OP_COMPARE_COLUMN_PROMOTED_IMPL
+
 }  // namespace dynamic
 
 /////////////////////////////////////////////////////////////////////////////
@@ -483,6 +506,10 @@ init_dynamic_hook() {
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, int64_t, int64_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, float, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, double, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, int32_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, int64_t, int32_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, float, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, double, float)
 
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, int8_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, int16_t)
@@ -565,6 +592,10 @@ init_dynamic_hook() {
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, int64_t, int64_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, float, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, double, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, int32_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, int64_t, int32_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, float, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, double, float)
 
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, int8_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, int16_t)
@@ -650,6 +681,10 @@ init_dynamic_hook() {
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, int64_t, int64_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, float, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, double, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, int32_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, int64_t, int32_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, float, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, double, float)
 
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, int8_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, int16_t)
@@ -733,6 +768,10 @@ init_dynamic_hook() {
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, int64_t, int64_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, float, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, double, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, int32_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, int64_t, int32_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, float, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, double, float)
 
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, int8_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, int16_t)
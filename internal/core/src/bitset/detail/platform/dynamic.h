@@ -42,6 +42,14 @@ namespace dynamic {
     FUNC(uint8_t);                \
     FUNC(uint64_t);
 
+// a facility to run through all acceptable pairs of different data types,
+//   the narrower type is promoted to the wider one for a comparison
+#define ALL_PROMOTED_DATATYPES_2(FUNC) \
+    FUNC(int32_t, int64_t);            \
+    FUNC(int64_t, int32_t);            \
+    FUNC(float, double);               \
+    FUNC(double, float);
+
 ///////////////////////////////////////////////////////////////////////////
 // the default implementation
 template <typename T, typename U, CompareOpType Op>
@@ -69,6 +77,20 @@ ALL_DATATYPES_1(DECLARE_PARTIAL_OP_COMPARE_COLUMN)
 
 #undef DECLARE_PARTIAL_OP_COMPARE_COLUMN
 
+#define DECLARE_PARTIAL_OP_COMPARE_COLUMN_PROMOTED(TTYPE, UTYPE) \
+    template <CompareOpType Op>                                  \
+    struct OpCompareColumnImpl<TTYPE, UTYPE, Op> {               \
+        static bool                                              \
+        op_compare_column(uint8_t* const __restrict bitmask,     \
+                          const TTYPE* const __restrict t,       \
+                          const UTYPE* const __restrict u,       \
+                          const size_t size);                    \
+    };
+
+ALL_PROMOTED_DATATYPES_2(DECLARE_PARTIAL_OP_COMPARE_COLUMN_PROMOTED)
+
+#undef DECLARE_PARTIAL_OP_COMPARE_COLUMN_PROMOTED
+
 ///////////////////////////////////////////////////////////////////////////
 // the default implementation
 template <typename T, CompareOpType Op>
@@ -300,6 +322,7 @@ ALL_FORWARD_TYPES_1(DECLARE_PARTIAL_FORWARD_OPS)
 
 #undef ALL_DATATYPES_1
 #undef ALL_FORWARD_TYPES_1
+#undef ALL_PROMOTED_DATATYPES_2
 
 }  // namespace dynamic
 
@@ -719,6 +719,128 @@ OpCompareColumnImpl<double, double, Op>::op_compare_column(
     return true;
 }
 
+namespace {
+
+// loads 4 elements, promoted to 64 bits
+inline __m256i
+load_4x_i64(const int32_t* const __restrict src) {
+    return _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)src));
+}
+
+inline __m256i
+load_4x_i64(const int64_t* const __restrict src) {
+    return _mm256_loadu_si256((const __m256i*)src);
+}
+
+inline __m256d
+load_4x_f64(const float* const __restrict src) {
+    return _mm256_cvtps_pd(_mm_loadu_ps(src));
+}
+
+inline __m256d
+load_4x_f64(const double* const __restrict src) {
+    return _mm256_loadu_pd(src);
+}
+
+template <typename T, typename U, CompareOpType Op>
+bool
+op_compare_column_i64(uint8_t* const __restrict res_u8,
+                      const T* const __restrict left,
+                      const U* const __restrict right,
+                      const size_t size) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    for (size_t i = 0; i < size; i += 8) {
+        const __m256i v0l = load_4x_i64(left + i);
+        const __m256i v1l = load_4x_i64(left + i + 4);
+        const __m256i v0r = load_4x_i64(right + i);
+        const __m256i v1r = load_4x_i64(right + i + 4);
+        const __m256i cmp0 = CmpHelperI64<Op>::compare(v0l, v0r);
+        const __m256i cmp1 = CmpHelperI64<Op>::compare(v1l, v1r);
+        const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+        const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+template <typename T, typename U, CompareOpType Op>
+bool
+op_compare_column_f64(uint8_t* const __restrict res_u8,
+                      const T* const __restrict left,
+                      const U* const __restrict right,
+                      const size_t size) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    constexpr auto pred = ComparePredicate<double, Op>::value;
+
+    for (size_t i = 0; i < size; i += 8) {
+        const __m256d v0l = load_4x_f64(left + i);
+        const __m256d v1l = load_4x_f64(left + i + 4);
+        const __m256d v0r = load_4x_f64(right + i);
+        const __m256d v1r = load_4x_f64(right + i + 4);
+        const __m256d cmp0 = _mm256_cmp_pd(v0l, v0r, pred);
+        const __m256d cmp1 = _mm256_cmp_pd(v1l, v1r, pred);
+        const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
+        const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+}  // namespace
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<int32_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left,
+    const int64_t* const __restrict right,
+    const size_t size) {
+    return op_compare_column_i64<int32_t, int64_t, Op>(
+        res_u8, left, right, size);
+}
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<int64_t, int32_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int64_t* const __restrict left,
+    const int32_t* const __restrict right,
+    const size_t size) {
+    return op_compare_column_i64<int64_t, int32_t, Op>(
+        res_u8, left, right, size);
+}
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<float, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict left,
+    const double* const __restrict right,
+    const size_t size) {
+    return op_compare_column_f64<float, double, Op>(
+        res_u8, left, right, size);
+}
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<double, float, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict left,
+    const float* const __restrict right,
+    const size_t size) {
+    return op_compare_column_f64<double, float, Op>(
+        res_u8, left, right, size);
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 //
@@ -44,6 +44,14 @@ namespace avx512 {
     FUNC(uint8_t);                \
     FUNC(uint64_t);
 
+// a facility to run through all acceptable pairs of different data types,
+//   the narrower type is promoted to the wider one for a comparison
+#define ALL_PROMOTED_DATATYPES_2(FUNC) \
+    FUNC(int32_t, int64_t);            \
+    FUNC(int64_t, int32_t);            \
+    FUNC(float, double);               \
+    FUNC(double, float);
+
 ///////////////////////////////////////////////////////////////////////////
 
 // the default implementation does nothing
@@ -73,6 +81,20 @@ ALL_DATATYPES_1(DECLARE_PARTIAL_OP_COMPARE_COLUMN)
 
 #undef DECLARE_PARTIAL_OP_COMPARE_COLUMN
 
+#define DECLARE_PARTIAL_OP_COMPARE_COLUMN_PROMOTED(TTYPE, UTYPE) \
+    template <CompareOpType Op>                                  \
+    struct OpCompareColumnImpl<TTYPE, UTYPE, Op> {               \
+        static bool                                              \
+        op_compare_column(uint8_t* const __restrict bitmask,     \
+                          const TTYPE* const __restrict t,       \
+                          const UTYPE* const __restrict u,       \
+                          const size_t size);                    \
+    };
+
+ALL_PROMOTED_DATATYPES_2(DECLARE_PARTIAL_OP_COMPARE_COLUMN_PROMOTED)
+
+#undef DECLARE_PARTIAL_OP_COMPARE_COLUMN_PROMOTED
+
 ///////////////////////////////////////////////////////////////////////////
 
 // the default implementation does nothing
@@ -313,6 +335,7 @@ ALL_FORWARD_TYPES_1(DECLARE_PARTIAL_FORWARD_OPS)
 
 #undef ALL_DATATYPES_1
 #undef ALL_FORWARD_TYPES_1
+#undef ALL_PROMOTED_DATATYPES_2
 
 }  // namespace avx512
 }  // namespace x86
@@ -620,6 +620,121 @@ OpCompareColumnImpl<double, double, Op>::op_compare_column(
     return true;
 }
 
+namespace {
+
+// loads 8 elements, promoted to 64 bits
+inline __m512i
+load_8x_i64(const int32_t* const __restrict src) {
+    return _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i*)src));
+}
+
+inline __m512i
+load_8x_i64(const int64_t* const __restrict src) {
+    return _mm512_loadu_si512(src);
+}
+
+inline __m512d
+load_8x_f64(const float* const __restrict src) {
+    return _mm512_cvtps_pd(_mm256_loadu_ps(src));
+}
+
+inline __m512d
+load_8x_f64(const double* const __restrict src) {
+    return _mm512_loadu_pd(src);
+}
+
+template <typename T, typename U, CompareOpType Op>
+bool
+op_compare_column_i64(uint8_t* const __restrict res_u8,
+                      const T* const __restrict left,
+                      const U* const __restrict right,
+                      const size_t size) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    constexpr auto pred = ComparePredicate<int64_t, Op>::value;
+
+    for (size_t i = 0; i < size; i += 8) {
+        const __m512i vl = load_8x_i64(left + i);
+        const __m512i vr = load_8x_i64(right + i);
+        const __mmask8 cmp_mask = _mm512_cmp_epi64_mask(vl, vr, pred);
+
+        res_u8[i / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+template <typename T, typename U, CompareOpType Op>
+bool
+op_compare_column_f64(uint8_t* const __restrict res_u8,
+                      const T* const __restrict left,
+                      const U* const __restrict right,
+                      const size_t size) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    constexpr auto pred = ComparePredicate<double, Op>::value;
+
+    for (size_t i = 0; i < size; i += 8) {
+        const __m512d vl = load_8x_f64(left + i);
+        const __m512d vr = load_8x_f64(right + i);
+        const __mmask8 cmp_mask = _mm512_cmp_pd_mask(vl, vr, pred);
+
+        res_u8[i / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+}  // namespace
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<int32_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left,
+    const int64_t* const __restrict right,
+    const size_t size) {
+    return op_compare_column_i64<int32_t, int64_t, Op>(
+        res_u8, left, right, size);
+}
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<int64_t, int32_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int64_t* const __restrict left,
+    const int32_t* const __restrict right,
+    const size_t size) {
+    return op_compare_column_i64<int64_t, int32_t, Op>(
+        res_u8, left, right, size);
+}
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<float, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict left,
+    const double* const __restrict right,
+    const size_t size) {
+    return op_compare_column_f64<float, double, Op>(
+        res_u8, left, right, size);
+}
+
+template <CompareOpType Op>
+bool
+OpCompareColumnImpl<double, float, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict left,
+    const float* const __restrict right,
+    const size_t size) {
+    return op_compare_column_f64<double, float, Op>(
+        res_u8, left, right, size);
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 //
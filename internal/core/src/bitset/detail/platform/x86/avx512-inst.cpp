@@ -120,6 +120,22 @@ ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_AVX512, double)
 
 #undef INSTANTIATE_COMPARE_COLUMN_AVX512
 
+//
+#define INSTANTIATE_COMPARE_COLUMN_PROMOTED_AVX512(TTYPE, UTYPE, OP)         \
+    template bool                                                            \
+    OpCompareColumnImpl<TTYPE, UTYPE, CompareOpType::OP>::op_compare_column( \
+        uint8_t* const __restrict bitmask,                                   \
+        const TTYPE* const __restrict left,                                  \
+        const UTYPE* const __restrict right,                                 \
+        const size_t size);
+
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_PROMOTED_AVX512, int32_t, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_PROMOTED_AVX512, int64_t, int32_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_PROMOTED_AVX512, float, double)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_PROMOTED_AVX512, double, float)
+
+#undef INSTANTIATE_COMPARE_COLUMN_PROMOTED_AVX512
+
 ///////////////////////////////////////////////////////////////////////////
 
 //
@@ -10,14 +10,18 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 #pragma once
 
+#include <algorithm>
 #include <any>
 #include <chrono>
 #include <cstddef>
+#include <deque>
 #include <exception>
 #include <memory>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
+#include <folly/Executor.h>
 #include <folly/futures/Future.h>
 #include <folly/futures/SharedPromise.h>
 #include <folly/Synchronized.h>
@@ -37,6 +41,9 @@ namespace milvus::cachinglayer {
 template <typename CellT>
 class CellAccessor;
 
+template <typename CellT>
+class CellReadAhead;
+
 // - The action of pinning cells is not started until the returned SemiFuture is scheduled on an executor.
 // - Once the future is scheduled, CacheSlot must live until the future is ready.
 // - The returned CellAccessor stores a shared_ptr of CacheSlot, thus will keep CacheSlot alive.
@@ -156,6 +163,20 @@ class CacheSlot final : public std::enable_shared_from_this<CacheSlot<CellT>> {
         });
     }
 
+    // Declares the sequence of uids a scanner is going to visit, in order. Cells of the
+    // `depth` uids following the scanner's current position are pinned in the background
+    // on `executor`, see CellReadAhead.
+    std::unique_ptr<CellReadAhead<CellT>>
+    ReadAhead(std::vector<uid_t> sequence,
+              size_t depth,
+              folly::Executor::KeepAlive<> executor) {
+        return std::make_unique<CellReadAhead<CellT>>(
+            this->shared_from_this(),
+            std::move(sequence),
+            depth,
+            std::move(executor));
+    }
+
     // Manually evicts the cell if it is not pinned.
     // Returns true if the cell ends up in a state other than LOADED.
     bool
@@ -398,6 +419,92 @@ class CellAccessor {
     std::vector<internal::ListNode::NodePin> pins_;
 };
 
+// Type erased CellReadAhead, so that the holder does not need to know about CellT.
+class ReadAheadHandle {
+ public:
+    virtual ~ReadAheadHandle() = default;
+
+    // Tells the read ahead that the scanner is now working on the `pos`-th uid of the
+    // declared sequence. Read ahead pins of positions up to `pos` are released, as the
+    // scanner pins the current cell by itself, and positions in (pos, pos + depth] are
+    // scheduled if they are not yet. Moving backward is a no-op.
+    virtual void
+    Advance(size_t pos) = 0;
+};
+
+// - Pins cells of a sequence of uids declared up front, up to `depth` positions ahead of
+//   the scanner, on the given executor. A cold cell is thus loaded while the scanner is
+//   still processing the current one, turning serial load latency into overlapped I/O.
+// - The scanner still pins the cell it is about to access by itself: that pin is either a
+//   cache hit, or joins the in-flight load started by the read ahead.
+// - Errors of background pins are ignored here, the scanner will see them when pinning
+//   the cell by itself.
+// - Not thread safe, a CellReadAhead is meant to be owned by a single scanner.
+template <typename CellT>
+class CellReadAhead : public ReadAheadHandle {
+ public:
+    CellReadAhead(std::shared_ptr<CacheSlot<CellT>> slot,
+                  std::vector<uid_t> sequence,
+                  size_t depth,
+                  folly::Executor::KeepAlive<> executor)
+        : slot_(std::move(slot)),
+          sequence_(std::move(sequence)),
+          depth_(depth),
+          executor_(std::move(executor)) {
+        Schedule();
+    }
+
+    // Dropping an unfinished future does not cancel the pin, the CellAccessor is released
+    // once the load completes.
+    ~CellReadAhead() override = default;
+
+    void
+    Advance(size_t pos) override {
+        if (pos <= current_) {
+            return;
+        }
+        current_ = pos;
+        while (!inflight_.empty() && inflight_.front().first <= current_) {
+            inflight_.pop_front();
+        }
+        Schedule();
+    }
+
+    size_t
+    inflight_count() const {
+        return inflight_.size();
+    }
+
+ private:
+    void
+    Schedule() {
+        // the cell at current_ is pinned by the scanner itself.
+        auto end = std::min(sequence_.size(), current_ + depth_ + 1);
+        for (next_ = std::max(next_, current_ + 1); next_ < end; ++next_) {
+            // Pin and load inline within a single task: once the cell turns LOADING, the
+            // load must not wait in the executor queue behind scanners that are blocked
+            // on this very cell. Capturing the slot keeps it alive until the pin is done,
+            // even if this object is gone.
+            auto future = folly::via(
+                executor_, [slot = slot_, uid = sequence_[next_]]() {
+                    return SemiInlineGet(slot->PinCells({uid}));
+                });
+            inflight_.emplace_back(next_, std::move(future));
+        }
+    }
+
+    std::shared_ptr<CacheSlot<CellT>> slot_;
+    std::vector<uid_t> sequence_;
+    size_t depth_;
+    folly::Executor::KeepAlive<> executor_;
+    size_t current_{0};
+    size_t next_{0};
+    // (position in sequence_, pin of that position), ordered by position.
+    std::deque<
+        std::pair<size_t, folly::Future<std::shared_ptr<CellAccessor<CellT>>>>>
+        inflight_;
+};
+
 // TODO(tiered storage 4): this class is a temp solution. Later we should modify all usage of this class
 // to use folly::SemiFuture instead: all data access should happen within deferValue().
 // Current impl requires the T type to be movable/copyable.
@@ -67,7 +67,8 @@ Manager::ConfigureTieredStorage(CacheWarmupPolicies warmup_policies,
             "({:.2} GB), disk watermark: low "
             "{} bytes ({:.2} GB), high {} bytes ({:.2} GB), max {} bytes "
             "({:.2} GB), cache touch "
-            "window: {} ms, eviction interval: {} ms",
+            "window: {} ms, eviction interval: {} ms, eviction policy: {}, "
+            "eviction shards: {}",
             low_watermark.memory_bytes,
             low_watermark.memory_bytes / (1024.0 * 1024.0 * 1024.0),
             high_watermark.memory_bytes,
@@ -81,7 +82,9 @@ Manager::ConfigureTieredStorage(CacheWarmupPolicies warmup_policies,
             max.file_bytes,
             max.file_bytes / (1024.0 * 1024.0 * 1024.0),
             eviction_config.cache_touch_window.count(),
-            eviction_config.eviction_interval.count());
+            eviction_config.eviction_interval.count(),
+            static_cast<int>(eviction_config.eviction_policy),
+            eviction_config.shards);
     });
 }
 
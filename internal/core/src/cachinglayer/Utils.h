@@ -206,14 +206,27 @@ struct EvictionConfig {
     // Use cache_touch_window_ms to reduce the frequency of touching and reduce contention.
     std::chrono::milliseconds cache_touch_window;
     std::chrono::milliseconds eviction_interval;
+    // Order in which unpinned cells are evicted, see EvictionPolicy.
+    CacheEvictionPolicy eviction_policy;
+    // Number of shards of the list, each with its own lock and its own eviction order, so that touching cells of
+    // different shards does not contend. 0 means one shard per hardware thread.
+    int64_t shards;
     EvictionConfig()
         : cache_touch_window(std::chrono::milliseconds(0)),
-          eviction_interval(std::chrono::milliseconds(0)) {
+          eviction_interval(std::chrono::milliseconds(0)),
+          eviction_policy(CacheEvictionPolicy::CacheEvictionPolicy_LRU),
+          shards(1) {
     }
 
-    EvictionConfig(int64_t cache_touch_window_ms, int64_t eviction_interval_ms)
+    EvictionConfig(int64_t cache_touch_window_ms,
+                   int64_t eviction_interval_ms,
+                   CacheEvictionPolicy eviction_policy =
+                       CacheEvictionPolicy::CacheEvictionPolicy_LRU,
+                   int64_t shards = 1)
         : cache_touch_window(std::chrono::milliseconds(cache_touch_window_ms)),
-          eviction_interval(std::chrono::milliseconds(eviction_interval_ms)) {
+          eviction_interval(std::chrono::milliseconds(eviction_interval_ms)),
+          eviction_policy(eviction_policy),
+          shards(shards) {
     }
 };
 
@@ -303,6 +316,42 @@ cache_op_result_count_miss(StorageType storage_type) {
     }
 }
 
+inline prometheus::Counter&
+cache_policy_op_result_count_hit(CacheEvictionPolicy policy) {
+    switch (policy) {
+        case CacheEvictionPolicy::CacheEvictionPolicy_LRU:
+            return monitor::internal_cache_policy_op_result_count_hit_lru;
+        case CacheEvictionPolicy::CacheEvictionPolicy_TwoQueue:
+            return monitor::internal_cache_policy_op_result_count_hit_2q;
+        default:
+            PanicInfo(ErrorCode::UnexpectedError, "Unknown eviction policy");
+    }
+}
+
+inline prometheus::Counter&
+cache_policy_op_result_count_miss(CacheEvictionPolicy policy) {
+    switch (policy) {
+        case CacheEvictionPolicy::CacheEvictionPolicy_LRU:
+            return monitor::internal_cache_policy_op_result_count_miss_lru;
+        case CacheEvictionPolicy::CacheEvictionPolicy_TwoQueue:
+            return monitor::internal_cache_policy_op_result_count_miss_2q;
+        default:
+            PanicInfo(ErrorCode::UnexpectedError, "Unknown eviction policy");
+    }
+}
+
+inline prometheus::Counter&
+cache_policy_reload_bytes(CacheEvictionPolicy policy) {
+    switch (policy) {
+        case CacheEvictionPolicy::CacheEvictionPolicy_LRU:
+            return monitor::internal_cache_policy_reload_bytes_lru;
+        case CacheEvictionPolicy::CacheEvictionPolicy_TwoQueue:
+            return monitor::internal_cache_policy_reload_bytes_2q;
+        default:
+            PanicInfo(ErrorCode::UnexpectedError, "Unknown eviction policy");
+    }
+}
+
 inline prometheus::Counter&
 cache_cell_eviction_count(StorageType storage_type) {
     switch (storage_type) {
@@ -380,4 +429,17 @@ cache_memory_overhead_bytes(StorageType storage_type) {
 
 }  // namespace internal
 
+// Cells pinned by the calling thread and how many of them were not loaded
+// yet, sampled before and after a call to attribute cache traffic to it.
+struct ThreadCacheStats {
+    int64_t pins_{0};
+    int64_t misses_{0};
+};
+
+inline ThreadCacheStats&
+thread_cache_stats() {
+    thread_local ThreadCacheStats stats;
+    return stats;
+}
+
 }  // namespace milvus::cachinglayer
@@ -10,6 +10,7 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 #include "cachinglayer/lrucache/DList.h"
 
+#include <cstdint>
 #include <mutex>
 #include <vector>
 
@@ -23,22 +24,47 @@
 
 namespace milvus::cachinglayer::internal {
 
+namespace {
+// number of candidates per shard tryEvict() starts with, doubled each time they are not enough.
+constexpr size_t kEvictionBatch = 64;
+}  // namespace
+
 bool
 DList::reserveMemory(const ResourceUsage& size) {
-    std::unique_lock<std::mutex> list_lock(list_mtx_);
+    // fast path: reserve without lock as long as the cache can hold the reservation.
     auto used = used_memory_.load();
-    if (max_memory_.CanHold(used + size)) {
-        used_memory_ += size;
-        return true;
+    while (max_memory_.load().CanHold(used + size)) {
+        if (used_memory_.compare_exchange_weak(used, used + size)) {
+            // UpdateLimit may have shrunk the limit since it was loaded, and missed this reservation when it
+            // checked the usage. It publishes the limit first, so it is seen here.
+            if (max_memory_.load().CanHold(used + size)) {
+                return true;
+            }
+            used_memory_ -= size;
+            break;
+        }
     }
 
-    // try to evict so that used + size <= low watermark, but if that is not possible,
-    // evict enough for the current reservation.
-    if (tryEvict(used + size - low_watermark_, used + size - max_memory_)) {
-        used_memory_ += size;
-        return true;
+    std::unique_lock<std::mutex> list_lock(list_mtx_);
+    // max_memory_ only changes under the lock, but the fast path may still reserve concurrently, so the reservation
+    // is committed with a CAS against the usage it was checked with.
+    auto max_memory = max_memory_.load();
+    used = used_memory_.load();
+    while (true) {
+        if (max_memory.CanHold(used + size)) {
+            if (used_memory_.compare_exchange_weak(used, used + size)) {
+                return true;
+            }
+            continue;
+        }
+        // try to evict so that used + size <= low watermark, but if that is not possible,
+        // evict enough for the current reservation.
+        if (!tryEvict(used + size - low_watermark_, used + size - max_memory)) {
+            return false;
+        }
+        // the fast path may have taken some of the evicted memory, check again.
+        used = used_memory_.load();
     }
-    return false;
 }
 
 void
@@ -73,6 +99,7 @@ DList::evictionLoop() {
 std::string
 DList::usageInfo(const ResourceUsage& actively_pinned) const {
     auto used = used_memory_.load();
+    auto max_memory = max_memory_.load();
     static double precision = 100.0;
     return fmt::format(
         "low_watermark_: {}, "
@@ -84,13 +111,13 @@ DList::usageInfo(const ResourceUsage& actively_pinned) const {
         "actively_pinned: {} {:.2}% of used memory, {:.2}% of used disk",
         low_watermark_.ToString(),
         high_watermark_.ToString(),
-        max_memory_.ToString(),
+        max_memory.ToString(),
         used.ToString(),
-        static_cast<double>(used.memory_bytes) / max_memory_.memory_bytes *
+        static_cast<double>(used.memory_bytes) / max_memory.memory_bytes *
             precision,
         static_cast<double>(used.memory_bytes) / high_watermark_.memory_bytes *
             precision,
-        static_cast<double>(used.file_bytes) / max_memory_.file_bytes *
+        static_cast<double>(used.file_bytes) / max_memory.file_bytes *
             precision,
         static_cast<double>(used.file_bytes) / high_watermark_.file_bytes *
             precision,
@@ -122,19 +149,26 @@ DList::tryEvict(const ResourceUsage& expected_eviction,
 
     ResourceUsage actively_pinned{0, 0};
 
-    // accumulate victims using expected_eviction.
-    for (auto it = tail_; it != nullptr; it = it->next_) {
+    std::vector<std::unique_lock<std::mutex>> shard_locks;
+    shard_locks.reserve(shards_.size());
+    for (auto& shard : shards_) {
+        shard_locks.emplace_back(shard->mtx_);
+    }
+
+    // returns false once enough victims are found.
+    auto visit = [&](ListNode* it) {
         if (!would_help(it->size())) {
-            continue;
+            return true;
         }
         // use try_to_lock to avoid dead lock by failing immediately if the ListNode lock is already held.
         auto& lock = item_locks.emplace_back(it->mtx_, std::try_to_lock);
         // if lock failed, it means this ListNode will be used again, so we don't evict it anymore.
-        if (lock.owns_lock() && it->pin_count_ == 0) {
+        // begin_evict() fails if the ListNode is pinned, and keeps the lock-free pin() away until end_evict().
+        if (lock.owns_lock() && it->begin_evict()) {
             to_evict.push_back(it);
             size_to_evict += it->size();
             if (size_to_evict.CanHold(expected_eviction)) {
-                break;
+                return false;
             }
         } else {
             // if we grabbed the lock only to find that the ListNode is pinned; or if we failed to lock
@@ -142,9 +176,46 @@ DList::tryEvict(const ResourceUsage& expected_eviction,
             item_locks.pop_back();
             actively_pinned += it->size();
         }
+        return true;
+    };
+
+    // accumulate victims using expected_eviction, in the order of the eviction policy.
+    if (shards_.size() == 1) {
+        shards_[0]->policy_->ForEachCandidate(visit);
+    } else {
+        // take the candidates of the shards in turn, in batches of growing size so that a small eviction
+        // does not walk every shard entirely.
+        bool done = false;
+        for (size_t begin = 0, end = kEvictionBatch; !done;
+             begin = end, end *= 2) {
+            std::vector<std::vector<ListNode*>> batches(shards_.size());
+            bool exhausted = true;
+            for (size_t i = 0; i < shards_.size(); ++i) {
+                size_t rank = 0;
+                shards_[i]->policy_->ForEachCandidate([&](ListNode* it) {
+                    if (rank++ >= begin) {
+                        batches[i].push_back(it);
+                    }
+                    return rank < end;
+                });
+                exhausted = exhausted && rank < end;
+            }
+            for (size_t rank = 0; rank < end - begin && !done; ++rank) {
+                for (auto& batch : batches) {
+                    if (rank < batch.size() && !visit(batch[rank])) {
+                        done = true;
+                        break;
+                    }
+                }
+            }
+            done = done || exhausted;
+        }
     }
     if (!size_to_evict.CanHold(expected_eviction)) {
         if (!size_to_evict.CanHold(min_eviction)) {
+            for (auto* list_node : to_evict) {
+                list_node->end_evict();
+            }
             LOG_WARN(
                 "Milvus Caching Layer: cannot evict even min_eviction {}, "
                 "giving up eviction. Current usage: {}",
@@ -165,7 +236,9 @@ DList::tryEvict(const ResourceUsage& expected_eviction,
         auto size = list_node->size();
         internal::cache_cell_eviction_count(size.storage_type()).Increment();
         popItem(list_node);
+        list_node->evicted_ = true;
         list_node->clear_data();
+        list_node->end_evict();
         used_memory_ -= size;
     }
 
@@ -196,6 +269,9 @@ DList::UpdateLimit(const ResourceUsage& new_limit) {
                "Milvus Caching Layer: memory and disk usage limit must be "
                "greater than 0");
     std::unique_lock<std::mutex> list_lock(list_mtx_);
+    // published before the usage is checked, so that a reservation of the lock free fast path either is
+    // seen here or sees the new limit.
+    auto old_limit = max_memory_.exchange(new_limit);
     auto used = used_memory_.load();
     if (!new_limit.CanHold(used)) {
         // positive means amount owed
@@ -203,14 +279,14 @@ DList::UpdateLimit(const ResourceUsage& new_limit) {
         // deficit is the hard limit of eviction, if we cannot evict deficit, we give
         // up the limit change.
         if (!tryEvict(deficit, deficit)) {
+            max_memory_ = old_limit;
             return false;
         }
     }
-    max_memory_ = new_limit;
     milvus::monitor::internal_cache_capacity_bytes_memory.Set(
-        max_memory_.memory_bytes);
+        new_limit.memory_bytes);
     milvus::monitor::internal_cache_capacity_bytes_disk.Set(
-        max_memory_.file_bytes);
+        new_limit.file_bytes);
     return true;
 }
 
@@ -236,10 +312,17 @@ DList::releaseMemory(const ResourceUsage& size) {
     used_memory_ -= size;
 }
 
+DList::Shard&
+DList::shardOf(const ListNode* list_node) const {
+    // nodes are allocated next to each other, mix the bits of the address to spread them over the shards.
+    auto hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(list_node));
+    hash = (hash >> 4) * 0x9E3779B97F4A7C15ULL;
+    return *shards_[(hash >> 32) % shards_.size()];
+}
+
 void
 DList::touchItem(ListNode* list_node, std::optional<ResourceUsage> size) {
-    std::lock_guard<std::mutex> list_lock(list_mtx_);
-    popItem(list_node);
+    std::lock_guard<std::mutex> shard_lock(shardOf(list_node).mtx_);
     pushHead(list_node);
     if (size.has_value()) {
         used_memory_ += size.value();
@@ -248,7 +331,7 @@ DList::touchItem(ListNode* list_node, std::optional<ResourceUsage> size) {
 
 void
 DList::removeItem(ListNode* list_node, ResourceUsage size) {
-    std::lock_guard<std::mutex> list_lock(list_mtx_);
+    std::lock_guard<std::mutex> shard_lock(shardOf(list_node).mtx_);
     if (popItem(list_node)) {
         used_memory_ -= size;
     }
@@ -256,46 +339,41 @@ DList::removeItem(ListNode* list_node, ResourceUsage size) {
 
 void
 DList::pushHead(ListNode* list_node) {
-    if (head_ == nullptr) {
-        head_ = list_node;
-        tail_ = list_node;
-    } else {
-        list_node->prev_ = head_;
-        head_->next_ = list_node;
-        head_ = list_node;
-    }
+    shardOf(list_node).policy_->Touch(list_node);
 }
 
 bool
 DList::popItem(ListNode* list_node) {
-    if (list_node->prev_ == nullptr && list_node->next_ == nullptr &&
-        list_node != head_) {
-        // list_node is not in the list
-        return false;
-    }
-    if (head_ == tail_) {
-        head_ = tail_ = nullptr;
-        list_node->prev_ = list_node->next_ = nullptr;
-    } else if (head_ == list_node) {
-        head_ = list_node->prev_;
-        head_->next_ = nullptr;
-        list_node->prev_ = nullptr;
-    } else if (tail_ == list_node) {
-        tail_ = list_node->next_;
-        tail_->prev_ = nullptr;
-        list_node->next_ = nullptr;
-    } else {
-        list_node->prev_->next_ = list_node->next_;
-        list_node->next_->prev_ = list_node->prev_;
-        list_node->prev_ = list_node->next_ = nullptr;
-    }
-    return true;
+    return shardOf(list_node).policy_->Remove(list_node);
 }
 
 bool
 DList::IsEmpty() const {
-    std::lock_guard<std::mutex> list_lock(list_mtx_);
-    return head_ == nullptr;
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> shard_lock(shard->mtx_);
+        if (!shard->policy_->IsEmpty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+DList::recordHit() const {
+    internal::cache_policy_op_result_count_hit(
+        eviction_config_.eviction_policy)
+        .Increment();
+}
+
+void
+DList::recordMiss(const ResourceUsage& reload) const {
+    internal::cache_policy_op_result_count_miss(
+        eviction_config_.eviction_policy)
+        .Increment();
+    if (reload.memory_bytes > 0 || reload.file_bytes > 0) {
+        internal::cache_policy_reload_bytes(eviction_config_.eviction_policy)
+            .Increment(reload.memory_bytes + reload.file_bytes);
+    }
 }
 
 }  // namespace milvus::cachinglayer::internal
@@ -10,13 +10,18 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include <folly/futures/Future.h>
 #include <folly/futures/SharedPromise.h>
 
+#include "cachinglayer/lrucache/EvictionPolicy.h"
 #include "cachinglayer/lrucache/ListNode.h"
 #include "cachinglayer/Utils.h"
 
@@ -32,6 +37,14 @@ class DList {
           low_watermark_(low_watermark),
           high_watermark_(high_watermark),
           eviction_config_(eviction_config) {
+        auto shards = eviction_config.shards > 0
+                          ? eviction_config.shards
+                          : std::max<int64_t>(
+                                1, std::thread::hardware_concurrency());
+        for (int64_t i = 0; i < shards; ++i) {
+            shards_.push_back(std::make_unique<Shard>(
+                EvictionPolicy::Create(eviction_config.eviction_policy)));
+        }
         eviction_thread_ = std::thread(&DList::evictionLoop, this);
     }
 
@@ -60,7 +73,7 @@ class DList {
     bool
     IsEmpty() const;
 
-    // This method uses a global lock.
+    // Lock free if the cache can hold size, otherwise evicts under the global lock.
     bool
     reserveMemory(const ResourceUsage& size);
 
@@ -69,8 +82,8 @@ class DList {
     void
     releaseMemory(const ResourceUsage& size);
 
-    // Caller must guarantee that the current thread holds the lock of list_node->mtx_.
-    // touchItem is used in 2 places:
+    // Caller must guarantee that the current thread holds the lock of list_node->mtx_. Locks only the shard of
+    // list_node. touchItem is used in 2 places:
     // 1. when a loaded cell is pinned/unpinned, we need to touch it to refresh the LRU order.
     //    we don't update used_memory_ here.
     // 2. when a cell is loaded as a bonus, we need to touch it to insert into the LRU and update
@@ -79,8 +92,8 @@ class DList {
     touchItem(ListNode* list_node,
               std::optional<ResourceUsage> size = std::nullopt);
 
-    // Caller must guarantee that the current thread holds the lock of list_node->mtx_.
-    // Removes the node from the list and updates used_memory_.
+    // Caller must guarantee that the current thread holds the lock of list_node->mtx_. Locks only the shard of
+    // list_node. Removes the node from the list and updates used_memory_.
     void
     removeItem(ListNode* list_node, ResourceUsage size);
 
@@ -89,26 +102,49 @@ class DList {
         return eviction_config_;
     }
 
+    // Record the result of pinning a cell in the metrics of the eviction policy, thread safe without lock.
+    void
+    recordHit() const;
+
+    // reload is the size of the cell if it was evicted before and is loaded again.
+    void
+    recordMiss(const ResourceUsage& reload = {}) const;
+
  private:
     friend class DListTestFriend;
 
+    // A part of the list with its own lock and eviction order. A node always belongs to the same shard.
+    struct Shard {
+        explicit Shard(std::unique_ptr<EvictionPolicy> policy)
+            : policy_(std::move(policy)) {
+        }
+
+        mutable std::mutex mtx_;
+        // holds the nodes of the shard, must be accessed under the lock of mtx_.
+        std::unique_ptr<EvictionPolicy> policy_;
+    };
+
+    Shard&
+    shardOf(const ListNode* list_node) const;
+
     void
     evictionLoop();
 
     // Try to evict some items so that the resources of evicted items are larger than expected_eviction.
     // If we cannot achieve the goal, but we can evict min_eviction, we will still perform eviction.
     // If we cannot even evict min_eviction, nothing will be evicted and false will be returned.
-    // Must be called under the lock of list_mtx_.
+    // Must be called under the lock of list_mtx_, locks all the shards. The candidates of the shards are taken in
+    // turn, so the order of eviction is only approximately global.
     bool
     tryEvict(const ResourceUsage& expected_eviction,
              const ResourceUsage& min_eviction);
 
-    // Must be called under the lock of list_mtx_ and list_node->mtx_.
+    // Must be called under the lock of the shard of list_node and list_node->mtx_.
     // ListNode is guaranteed to be not in the list.
     void
     pushHead(ListNode* list_node);
 
-    // Must be called under the lock of list_mtx_ and list_node->mtx_.
+    // Must be called under the lock of the shard of list_node and list_node->mtx_.
     // If ListNode is not in the list, this function does nothing.
     // Returns true if ListNode is in the list and popped, false otherwise.
     bool
@@ -117,20 +153,16 @@ class DList {
     std::string
     usageInfo(const ResourceUsage& actively_pinned) const;
 
-    // head_ is the most recently used item, tail_ is the least recently used item.
-    // tail_ -> next -> ... -> head_
-    // tail_ <- prev <- ... <- head_
-    ListNode* head_ = nullptr;
-    ListNode* tail_ = nullptr;
-
-    // TODO(tiered storage 3): benchmark folly::DistributedMutex for this usecase.
+    // serializes eviction and guards the watermarks, the nodes are guarded by the locks of the shards.
     mutable std::mutex list_mtx_;
-    // access to used_memory_ and max_memory_ must be done under the lock of list_mtx_
+    // updated without lock if the cache can hold the update, max_memory_ is only written under the lock of
+    // list_mtx_.
     std::atomic<ResourceUsage> used_memory_{};
     ResourceUsage low_watermark_;
     ResourceUsage high_watermark_;
-    ResourceUsage max_memory_;
+    std::atomic<ResourceUsage> max_memory_;
     const EvictionConfig eviction_config_;
+    std::vector<std::unique_ptr<Shard>> shards_;
 
     std::thread eviction_thread_;
     std::condition_variable eviction_thread_cv_;
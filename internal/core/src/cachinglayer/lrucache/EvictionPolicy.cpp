@@ -0,0 +1,145 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+#include "cachinglayer/lrucache/EvictionPolicy.h"
+
+#include <memory>
+
+#include "cachinglayer/lrucache/ListNode.h"
+#include "common/EasyAssert.h"
+
+namespace milvus::cachinglayer::internal {
+
+void
+NodeList::PushHead(ListNode* list_node) {
+    if (head_ == nullptr) {
+        head_ = list_node;
+        tail_ = list_node;
+    } else {
+        list_node->prev_ = head_;
+        head_->next_ = list_node;
+        head_ = list_node;
+    }
+    list_node->list_ = this;
+    size_ += list_node->size();
+}
+
+bool
+NodeList::Pop(ListNode* list_node) {
+    if (!Contains(list_node)) {
+        return false;
+    }
+    if (head_ == tail_) {
+        head_ = tail_ = nullptr;
+    } else if (head_ == list_node) {
+        head_ = list_node->prev_;
+        head_->next_ = nullptr;
+    } else if (tail_ == list_node) {
+        tail_ = list_node->next_;
+        tail_->prev_ = nullptr;
+    } else {
+        list_node->prev_->next_ = list_node->next_;
+        list_node->next_->prev_ = list_node->prev_;
+    }
+    list_node->prev_ = list_node->next_ = nullptr;
+    list_node->list_ = nullptr;
+    size_ -= list_node->size();
+    return true;
+}
+
+bool
+NodeList::Contains(const ListNode* list_node) const {
+    return list_node->list_ == this;
+}
+
+std::unique_ptr<EvictionPolicy>
+EvictionPolicy::Create(CacheEvictionPolicy policy) {
+    switch (policy) {
+        case CacheEvictionPolicy::CacheEvictionPolicy_LRU:
+            return std::make_unique<LRUPolicy>();
+        case CacheEvictionPolicy::CacheEvictionPolicy_TwoQueue:
+            return std::make_unique<TwoQueuePolicy>();
+        default:
+            PanicInfo(ErrorCode::UnexpectedError,
+                      "Unknown cache eviction policy {}",
+                      static_cast<int>(policy));
+    }
+}
+
+void
+LRUPolicy::Touch(ListNode* list_node) {
+    list_.Pop(list_node);
+    list_.PushHead(list_node);
+}
+
+bool
+LRUPolicy::Remove(ListNode* list_node) {
+    return list_.Pop(list_node);
+}
+
+void
+LRUPolicy::ForEachCandidate(
+    const std::function<bool(ListNode*)>& visit) const {
+    for (auto it = list_.tail_; it != nullptr; it = it->next_) {
+        if (!visit(it)) {
+            return;
+        }
+    }
+}
+
+void
+TwoQueuePolicy::Touch(ListNode* list_node) {
+    if (protected_.Pop(list_node) || probation_.Pop(list_node)) {
+        protected_.PushHead(list_node);
+        shrinkProtected();
+    } else {
+        probation_.PushHead(list_node);
+    }
+}
+
+bool
+TwoQueuePolicy::Remove(ListNode* list_node) {
+    return probation_.Pop(list_node) || protected_.Pop(list_node);
+}
+
+void
+TwoQueuePolicy::ForEachCandidate(
+    const std::function<bool(ListNode*)>& visit) const {
+    for (auto it = probation_.tail_; it != nullptr; it = it->next_) {
+        if (!visit(it)) {
+            return;
+        }
+    }
+    for (auto it = protected_.tail_; it != nullptr; it = it->next_) {
+        if (!visit(it)) {
+            return;
+        }
+    }
+}
+
+void
+TwoQueuePolicy::shrinkProtected() {
+    auto over_limit = [this]() {
+        auto total = probation_.size_;
+        total += protected_.size_;
+        return protected_.size_.memory_bytes >
+                   kProtectedRatio * total.memory_bytes ||
+               protected_.size_.file_bytes >
+                   kProtectedRatio * total.file_bytes;
+    };
+    // the most recently promoted node is never demoted.
+    while (protected_.tail_ != protected_.head_ && over_limit()) {
+        auto list_node = protected_.tail_;
+        protected_.Pop(list_node);
+        probation_.PushHead(list_node);
+    }
+}
+
+}  // namespace milvus::cachinglayer::internal
@@ -0,0 +1,147 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "cachinglayer/Utils.h"
+
+namespace milvus::cachinglayer::internal {
+
+class ListNode;
+
+// An intrusive doubly linked list of ListNodes through their prev_ and next_, a node is in at most one NodeList.
+// tail_ -> next -> ... -> head_
+// tail_ <- prev <- ... <- head_
+struct NodeList {
+    // ListNode must not be in any list.
+    void
+    PushHead(ListNode* list_node);
+
+    // If ListNode is not in this list, this function does nothing.
+    // Returns true if ListNode is in this list and popped, false otherwise.
+    bool
+    Pop(ListNode* list_node);
+
+    bool
+    Contains(const ListNode* list_node) const;
+
+    bool
+    IsEmpty() const {
+        return head_ == nullptr;
+    }
+
+    ListNode* head_ = nullptr;
+    ListNode* tail_ = nullptr;
+    // total size of the nodes in the list
+    ResourceUsage size_{};
+};
+
+// EvictionPolicy decides the order in which DList evicts its unpinned nodes. All methods are called under the lock
+// of DList::list_mtx_, Touch and Remove also under the lock of list_node->mtx_.
+class EvictionPolicy {
+ public:
+    virtual ~EvictionPolicy() = default;
+
+    static std::unique_ptr<EvictionPolicy>
+    Create(CacheEvictionPolicy policy);
+
+    // Starts tracking ListNode, or records an access to it if it is tracked already.
+    virtual void
+    Touch(ListNode* list_node) = 0;
+
+    // Returns true if ListNode was tracked and is removed, false otherwise.
+    virtual bool
+    Remove(ListNode* list_node) = 0;
+
+    // Calls visit on the tracked nodes, the first to evict first, until visit returns false.
+    // visit must not touch or remove any node.
+    virtual void
+    ForEachCandidate(const std::function<bool(ListNode*)>& visit) const = 0;
+
+    virtual bool
+    IsEmpty() const = 0;
+};
+
+// Evicts the least recently touched node first.
+class LRUPolicy : public EvictionPolicy {
+ public:
+    void
+    Touch(ListNode* list_node) override;
+
+    bool
+    Remove(ListNode* list_node) override;
+
+    void
+    ForEachCandidate(
+        const std::function<bool(ListNode*)>& visit) const override;
+
+    bool
+    IsEmpty() const override {
+        return list_.IsEmpty();
+    }
+
+    // head_ is the most recently used item, tail_ is the least recently used item.
+    const NodeList&
+    list() const {
+        return list_;
+    }
+
+ private:
+    NodeList list_;
+};
+
+// A scan resistant policy after 2Q: a node enters the probation queue when it is loaded, and is promoted to the
+// protected queue when it is touched again, i.e. used again at least cache_touch_window later. Nodes are evicted
+// from the probation queue first, so a scan that uses every cell once, such as a count over a cold collection,
+// only cycles through probation and leaves the hot nodes in the protected queue alone. The protected queue holds
+// at most kProtectedRatio of the tracked memory and disk, beyond which its least recently used nodes are demoted
+// to the head of the probation queue.
+class TwoQueuePolicy : public EvictionPolicy {
+ public:
+    static constexpr double kProtectedRatio = 0.8;
+
+    void
+    Touch(ListNode* list_node) override;
+
+    bool
+    Remove(ListNode* list_node) override;
+
+    void
+    ForEachCandidate(
+        const std::function<bool(ListNode*)>& visit) const override;
+
+    bool
+    IsEmpty() const override {
+        return probation_.IsEmpty() && protected_.IsEmpty();
+    }
+
+    const NodeList&
+    probation() const {
+        return probation_;
+    }
+
+    const NodeList&
+    protected_list() const {
+        return protected_;
+    }
+
+ private:
+    // Demotes the least recently used protected nodes until the protected queue is within kProtectedRatio.
+    void
+    shrinkProtected();
+
+    NodeList probation_;
+    NodeList protected_;
+};
+
+}  // namespace milvus::cachinglayer::internal
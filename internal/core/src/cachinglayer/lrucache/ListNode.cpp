@@ -33,6 +33,9 @@ ListNode::NodePin::NodePin(ListNode* node) : node_(node) {
     }
 }
 
+ListNode::NodePin::NodePin(ListNode* node, std::adopt_lock_t) : node_(node) {
+}
+
 ListNode::NodePin::~NodePin() {
     if (node_) {
         node_->unpin();
@@ -76,7 +79,7 @@ ListNode::manual_evict() {
     if (state_ == State::NOT_LOADED) {
         return true;
     }
-    if (pin_count_.load() > 0) {
+    if (!begin_evict()) {
         LOG_ERROR(
             "manual_evict() called on a LOADED and pinned cell, aborting "
             "eviction.");
@@ -84,6 +87,7 @@ ListNode::manual_evict() {
     }
     // cell is LOADED
     clear_data();
+    end_evict();
     if (dlist_) {
         dlist_->removeItem(this, size_);
     }
@@ -97,6 +101,14 @@ ListNode::size() {
 
 std::pair<bool, folly::SemiFuture<ListNode::NodePin>>
 ListNode::pin() {
+    if (try_pin_loaded()) {
+        internal::cache_op_result_count_hit(size_.storage_type()).Increment();
+        if (dlist_) {
+            dlist_->recordHit();
+        }
+        thread_cache_stats().pins_++;
+        return std::make_pair(false, NodePin(this, std::adopt_lock));
+    }
     // must be called with lock acquired, and state must not be NOT_LOADED.
     auto read_op = [this]() -> std::pair<bool, folly::SemiFuture<NodePin>> {
         AssertInfo(state_ != State::NOT_LOADED,
@@ -111,9 +123,18 @@ ListNode::pin() {
         if (state_ == State::LOADED) {
             internal::cache_op_result_count_hit(size_.storage_type())
                 .Increment();
+            if (dlist_) {
+                dlist_->recordHit();
+            }
+            thread_cache_stats().pins_++;
             return std::make_pair(false, std::move(p));
         }
         internal::cache_op_result_count_miss(size_.storage_type()).Increment();
+        if (dlist_) {
+            dlist_->recordMiss();
+        }
+        thread_cache_stats().pins_++;
+        thread_cache_stats().misses_++;
         return std::make_pair(false,
                               load_promise_->getSemiFuture().deferValue(
                                   [this, p = std::move(p)](auto&&) mutable {
@@ -132,6 +153,11 @@ ListNode::pin() {
     }
     // need to load.
     internal::cache_op_result_count_miss(size_.storage_type()).Increment();
+    if (dlist_) {
+        dlist_->recordMiss(evicted_ ? size_ : ResourceUsage{});
+    }
+    thread_cache_stats().pins_++;
+    thread_cache_stats().misses_++;
     load_promise_ = std::make_unique<folly::SharedPromise<folly::Unit>>();
     state_ = State::LOADING;
     if (dlist_ && !dlist_->reserveMemory(size())) {
@@ -188,8 +214,44 @@ ListNode::state_to_string(State state) {
     throw std::invalid_argument("Invalid state");
 }
 
+bool
+ListNode::try_pin_loaded() {
+    auto count = pin_count_.load();
+    while (count >= 0) {
+        if (pin_count_.compare_exchange_weak(count, count + 1)) {
+            // DList evicts a node only after begin_evict() and sets it NOT_LOADED before end_evict(), thus
+            // a LOADED state seen after pinning can not be evicted anymore.
+            if (state_.load() == State::LOADED) {
+                return true;
+            }
+            pin_count_--;
+            return false;
+        }
+    }
+    return false;
+}
+
+bool
+ListNode::begin_evict() {
+    int expected = 0;
+    return pin_count_.compare_exchange_strong(expected, kEvicting);
+}
+
+void
+ListNode::end_evict() {
+    pin_count_.store(0);
+}
+
 void
 ListNode::unpin() {
+    // fast path: dropping a pin other than the last one of a LOADED cell needs no lock, the last one
+    // touches the node under the lock.
+    auto count = pin_count_.load();
+    while (count > 1 && state_.load() == State::LOADED) {
+        if (pin_count_.compare_exchange_weak(count, count - 1)) {
+            return;
+        }
+    }
     std::unique_lock<std::shared_mutex> lock(mtx_);
     AssertInfo(
         state_ == State::LOADED || state_ == State::ERROR,
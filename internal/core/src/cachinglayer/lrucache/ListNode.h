@@ -12,7 +12,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <climits>
 #include <memory>
+#include <mutex>
 
 #include <folly/ExceptionWrapper.h>
 #include <folly/futures/Future.h>
@@ -24,6 +26,7 @@
 namespace milvus::cachinglayer::internal {
 
 class DList;
+struct NodeList;
 
 // ListNode is not movable/copyable.
 class ListNode {
@@ -42,6 +45,8 @@ class ListNode {
 
      private:
         NodePin(ListNode* node);
+        // adopts a pin the caller has already added to pin_count_.
+        NodePin(ListNode* node, std::adopt_lock_t);
         friend class ListNode;
         ListNode* node_;
     };
@@ -121,8 +126,9 @@ class ListNode {
             // Even though this thread did not request loading this cell, translator still
             // decided to download it because the adjacent cells are requested.
             if (state_ == State::NOT_LOADED || state_ == State::ERROR) {
-                state_ = State::LOADED;
+                // the cell must be ready before it is LOADED, pin() may see the state without the lock.
                 cb();
+                state_ = State::LOADED;
                 // memory of this cell is not reserved, touch() to track it.
                 touch(true);
             } else if (state_ == State::LOADING) {
@@ -144,7 +150,8 @@ class ListNode {
     void
     set_error(folly::exception_wrapper error);
 
-    State state_{State::NOT_LOADED};
+    // written under the lock of mtx_, read without it by the lock-free fast path of pin().
+    std::atomic<State> state_{State::NOT_LOADED};
 
     static std::string
     state_to_string(State state);
@@ -154,6 +161,9 @@ class ListNode {
  private:
     friend class DList;
     friend class NodePin;
+    friend struct NodeList;
+    friend class LRUPolicy;
+    friend class TwoQueuePolicy;
 
     friend class MockListNode;
     friend class DListTest;
@@ -169,6 +179,21 @@ class ListNode {
     void
     unpin();
 
+    // Lock-free fast path of pin(): pins the cell if it is LOADED and not being evicted.
+    bool
+    try_pin_loaded();
+
+    // Called by DList during eviction under the lock of mtx_. Marks an unpinned node as being evicted, so that
+    // try_pin_loaded() fails until end_evict(). Returns false if the node is pinned.
+    bool
+    begin_evict();
+
+    void
+    end_evict();
+
+    // pin_count_ of a node being evicted.
+    static constexpr int kEvicting = INT_MIN;
+
     // must be called under the lock of mtx_.
     void
     touch(bool update_used_memory = true);
@@ -179,6 +204,11 @@ class ListNode {
     DList* dlist_;
     ListNode* prev_ = nullptr;
     ListNode* next_ = nullptr;
+    // the list of the eviction policy this node is in, nullptr if none.
+    NodeList* list_ = nullptr;
+    // whether the cell has been evicted, loading it again is a reload. must be accessed under the lock of mtx_.
+    bool evicted_ = false;
+    // kEvicting while DList evicts the node.
     std::atomic<int> pin_count_{0};
 
     std::unique_ptr<folly::SharedPromise<folly::Unit>> load_promise_{nullptr};
@@ -26,6 +26,7 @@
 #include "common/EasyAssert.h"
 #include "common/FieldDataInterface.h"
 #include "common/Json.h"
+#include "common/JsonShadowColumn.h"
 #include "common/Span.h"
 #include "knowhere/sparse_utils.h"
 #include "simdjson/common_defs.h"
@@ -56,7 +57,7 @@ class Chunk {
         return size_;
     }
 
-    size_t
+    virtual size_t
     CellByteSize() const {
         return size_;
     }
@@ -215,8 +216,31 @@ class StringChunk : public Chunk {
         return offsets_;
     }
 
+    // typed columns of frequent json paths, only set on json chunks
+    void
+    SetJsonShadowColumns(JsonShadowColumns shadow_columns) {
+        shadow_columns_ = std::move(shadow_columns);
+    }
+
+    const JsonShadowColumn*
+    GetJsonShadowColumn(const std::string& pointer) const {
+        auto it = shadow_columns_.find(pointer);
+        return it == shadow_columns_.end() ? nullptr : it->second.get();
+    }
+
+    // the shadow columns live on the heap next to the chunk data
+    size_t
+    CellByteSize() const override {
+        auto size = Chunk::CellByteSize();
+        for (const auto& [pointer, shadow] : shadow_columns_) {
+            size += pointer.size() + shadow->ByteSize();
+        }
+        return size;
+    }
+
  protected:
     uint32_t* offsets_;
+    JsonShadowColumns shadow_columns_;
 };
 
 using JSONChunk = StringChunk;
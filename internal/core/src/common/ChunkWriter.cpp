@@ -20,16 +20,25 @@
 #include "arrow/record_batch.h"
 #include "arrow/type_fwd.h"
 #include "common/Chunk.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/FieldDataInterface.h"
 #include "common/Types.h"
 #include "common/VectorTrait.h"
+#include "parquet/file_reader.h"
+#include "parquet/metadata.h"
 #include "simdjson/common_defs.h"
 #include "simdjson/padded_string.h"
 #include "storage/FileWriter.h"
 
 namespace milvus {
 
+void
+ChunkWriterBase::write_batches(std::shared_ptr<arrow::RecordBatchReader> reader,
+                               int64_t num_rows) {
+    write(read_single_column_batches(std::move(reader)));
+}
+
 void
 StringChunkWriter::write(const arrow::ArrayVector& array_vec) {
     auto size = 0;
@@ -92,6 +101,7 @@ void
 JSONChunkWriter::write(const arrow::ArrayVector& array_vec) {
     auto size = 0;
     std::vector<Json> jsons;
+    FixedVector<bool> valid;
     std::vector<std::pair<const uint8_t*, int64_t>> null_bitmaps;
     for (const auto& data : array_vec) {
         auto array = std::dynamic_pointer_cast<arrow::BinaryArray>(data);
@@ -100,6 +110,9 @@ JSONChunkWriter::write(const arrow::ArrayVector& array_vec) {
             auto json = Json(simdjson::padded_string(str));
             size += json.data().size();
             jsons.push_back(std::move(json));
+            if (nullable_) {
+                valid.push_back(array->IsValid(i));
+            }
         }
         if (nullable_) {
             auto null_bitmap_n = (data->length() + 7) / 8;
@@ -135,6 +148,9 @@ JSONChunkWriter::write(const arrow::ArrayVector& array_vec) {
     for (const auto& json : jsons) {
         target_->write(json.data().data(), json.data().size());
     }
+
+    shadow_columns_ =
+        BuildJsonShadowColumns(jsons, valid, JSON_SHADOW_COLUMN_MAX_PATHS);
 }
 
 std::unique_ptr<Chunk>
@@ -143,7 +159,9 @@ JSONChunkWriter::finish() {
     target_->write(padding, simdjson::SIMDJSON_PADDING);
 
     auto [data, size] = target_->get();
-    return std::make_unique<JSONChunk>(row_nums_, data, size, nullable_);
+    auto chunk = std::make_unique<JSONChunk>(row_nums_, data, size, nullable_);
+    chunk->SetJsonShadowColumns(std::move(shadow_columns_));
+    return chunk;
 }
 
 void
@@ -443,6 +461,34 @@ create_chunk(const FieldMeta& field_meta,
     return cw->finish();
 }
 
+namespace {
+std::unique_ptr<Chunk>
+write_chunk(const std::shared_ptr<ChunkWriterBase>& cw,
+            const ArrowDataWrapper& data) {
+    if (data.arrow_reader == nullptr) {
+        // the row count is unknown without the parquet metadata
+        cw->write(read_single_column_batches(data.reader));
+    } else {
+        auto num_rows =
+            data.arrow_reader->parquet_reader()->metadata()->num_rows();
+        cw->write_batches(data.reader, num_rows);
+    }
+    return cw->finish();
+}
+}  // namespace
+
+std::unique_ptr<Chunk>
+create_chunk(const FieldMeta& field_meta, const ArrowDataWrapper& data) {
+    return write_chunk(create_chunk_writer(field_meta), data);
+}
+
+std::unique_ptr<Chunk>
+create_chunk(const FieldMeta& field_meta,
+             const ArrowDataWrapper& data,
+             const std::string& file_path) {
+    return write_chunk(create_chunk_writer(field_meta, file_path), data);
+}
+
 arrow::ArrayVector
 read_single_column_batches(std::shared_ptr<arrow::RecordBatchReader> reader) {
     arrow::ArrayVector array_vec;
@@ -20,6 +20,7 @@
 #include "arrow/type_fwd.h"
 #include "common/ChunkTarget.h"
 #include "arrow/record_batch.h"
+#include "common/ArrowDataWrapper.h"
 #include "common/Chunk.h"
 #include "common/EasyAssert.h"
 #include "common/FieldDataInterface.h"
@@ -39,6 +40,13 @@ class ChunkWriterBase {
     virtual void
     write(const arrow::ArrayVector& data) = 0;
 
+    // Writes the batches of a single column reader holding num_rows rows.
+    // By default all the batches are decoded before the chunk is sized,
+    // writers that can size it from num_rows stream them one at a time.
+    virtual void
+    write_batches(std::shared_ptr<arrow::RecordBatchReader> reader,
+                  int64_t num_rows);
+
     virtual std::unique_ptr<Chunk>
     finish() = 0;
 
@@ -124,6 +132,40 @@ class ChunkWriter final : public ChunkWriterBase {
         }
     }
 
+    // Copies the values of each batch into the chunk as soon as it is
+    // decoded, so at most one batch is alive next to the chunk.
+    void
+    write_batches(std::shared_ptr<arrow::RecordBatchReader> reader,
+                  int64_t num_rows) override {
+        // the null bitmaps of all the batches precede the values and their
+        // size depends on the batch boundaries
+        if (nullable_) {
+            ChunkWriterBase::write_batches(std::move(reader), num_rows);
+            return;
+        }
+        auto size = num_rows * dim_ * sizeof(T);
+        if (!file_path_.empty()) {
+            target_ = std::make_shared<MmapChunkTarget>(file_path_);
+        } else {
+            target_ = std::make_shared<MemChunkTarget>(size);
+        }
+        row_nums_ = 0;
+        for (auto batch : *reader) {
+            AssertInfo(batch.ok(),
+                       "failed to read record batch: {}",
+                       batch.status().ToString());
+            auto column = batch.ValueOrDie()->column(0);
+            auto array = std::static_pointer_cast<ArrowType>(column);
+            target_->write(array->raw_values(),
+                           array->length() * dim_ * sizeof(T));
+            row_nums_ += array->length();
+        }
+        AssertInfo(row_nums_ == num_rows,
+                   "read {} rows from the record batches, expected {}",
+                   row_nums_,
+                   num_rows);
+    }
+
     std::unique_ptr<Chunk>
     finish() override {
         auto [data, size] = target_->get();
@@ -178,6 +220,14 @@ ChunkWriter<arrow::BooleanArray, bool>::write(
     }
 }
 
+// values are bit packed in arrow and widened to one byte per row
+template <>
+inline void
+ChunkWriter<arrow::BooleanArray, bool>::write_batches(
+    std::shared_ptr<arrow::RecordBatchReader> reader, int64_t num_rows) {
+    ChunkWriterBase::write_batches(std::move(reader), num_rows);
+}
+
 class StringChunkWriter : public ChunkWriterBase {
  public:
     using ChunkWriterBase::ChunkWriterBase;
@@ -198,6 +248,9 @@ class JSONChunkWriter : public ChunkWriterBase {
 
     std::unique_ptr<Chunk>
     finish() override;
+
+ private:
+    JsonShadowColumns shadow_columns_;
 };
 
 class ArrayChunkWriter : public ChunkWriterBase {
@@ -265,6 +318,16 @@ create_chunk(const FieldMeta& field_meta,
              const arrow::ArrayVector& array_vec,
              const std::string& file_path);
 
+// Builds the chunk straight from the record batches of a binlog reader,
+// without collecting them first where the chunk writer allows it.
+std::unique_ptr<Chunk>
+create_chunk(const FieldMeta& field_meta, const ArrowDataWrapper& data);
+
+std::unique_ptr<Chunk>
+create_chunk(const FieldMeta& field_meta,
+             const ArrowDataWrapper& data,
+             const std::string& file_path);
+
 arrow::ArrayVector
 read_single_column_batches(std::shared_ptr<arrow::RecordBatchReader> reader);
 
@@ -20,6 +20,7 @@
 namespace milvus {
 
 int64_t FILE_SLICE_SIZE = DEFAULT_INDEX_FILE_SLICE_SIZE;
+int64_t STORAGE_MULTIPART_SIZE = DEFAULT_STORAGE_MULTIPART_SIZE;
 float HIGH_PRIORITY_THREAD_CORE_COEFFICIENT =
     DEFAULT_HIGH_PRIORITY_THREAD_CORE_COEFFICIENT;
 float MIDDLE_PRIORITY_THREAD_CORE_COEFFICIENT =
@@ -28,6 +29,12 @@ float LOW_PRIORITY_THREAD_CORE_COEFFICIENT =
     DEFAULT_LOW_PRIORITY_THREAD_CORE_COEFFICIENT;
 int CPU_NUM = DEFAULT_CPU_NUM;
 int64_t EXEC_EVAL_EXPR_BATCH_SIZE = DEFAULT_EXEC_EVAL_EXPR_BATCH_SIZE;
+int64_t CACHE_READ_AHEAD_DEPTH = DEFAULT_CACHE_READ_AHEAD_DEPTH;
+int64_t BRUTE_FORCE_CHUNK_PARALLELISM = DEFAULT_BRUTE_FORCE_CHUNK_PARALLELISM;
+int64_t JSON_SHADOW_COLUMN_MAX_PATHS = DEFAULT_JSON_SHADOW_COLUMN_MAX_PATHS;
+int64_t EXEC_EVAL_EXPR_MAX_PARALLELISM = DEFAULT_EXEC_EVAL_EXPR_MAX_PARALLELISM;
+int64_t OUTPUT_FIELD_MAX_PARALLELISM = DEFAULT_OUTPUT_FIELD_MAX_PARALLELISM;
+bool QUERY_PROFILE_ENABLED = DEFAULT_QUERY_PROFILE_ENABLED;
 bool OPTIMIZE_EXPR_ENABLED = DEFAULT_OPTIMIZE_EXPR_ENABLED;
 
 int64_t JSON_KEY_STATS_COMMIT_INTERVAL = DEFAULT_JSON_KEY_STATS_COMMIT_INTERVAL;
@@ -40,6 +47,13 @@ SetIndexSliceSize(const int64_t size) {
     LOG_INFO("set config index slice size (byte): {}", FILE_SLICE_SIZE);
 }
 
+void
+SetStorageMultipartSize(const int64_t size) {
+    STORAGE_MULTIPART_SIZE = size << 20;
+    LOG_INFO("set config storage multipart size (byte): {}",
+             STORAGE_MULTIPART_SIZE);
+}
+
 void
 SetHighPriorityThreadCoreCoefficient(const float coefficient) {
     HIGH_PRIORITY_THREAD_CORE_COEFFICIENT = coefficient;
@@ -67,6 +81,46 @@ SetDefaultExecEvalExprBatchSize(int64_t val) {
     LOG_INFO("set default expr eval batch size: {}", EXEC_EVAL_EXPR_BATCH_SIZE);
 }
 
+void
+SetDefaultCacheReadAheadDepth(int64_t val) {
+    CACHE_READ_AHEAD_DEPTH = val;
+    LOG_INFO("set default cache read ahead depth: {}", CACHE_READ_AHEAD_DEPTH);
+}
+
+void
+SetDefaultBruteForceChunkParallelism(int64_t val) {
+    BRUTE_FORCE_CHUNK_PARALLELISM = val;
+    LOG_INFO("set default brute force chunk parallelism: {}",
+             BRUTE_FORCE_CHUNK_PARALLELISM);
+}
+
+void
+SetDefaultJsonShadowColumnMaxPaths(int64_t val) {
+    JSON_SHADOW_COLUMN_MAX_PATHS = val;
+    LOG_INFO("set default json shadow column max paths: {}",
+             JSON_SHADOW_COLUMN_MAX_PATHS);
+}
+
+void
+SetDefaultExecEvalExprMaxParallelism(int64_t val) {
+    EXEC_EVAL_EXPR_MAX_PARALLELISM = val;
+    LOG_INFO("set default expr eval max parallelism: {}",
+             EXEC_EVAL_EXPR_MAX_PARALLELISM);
+}
+
+void
+SetDefaultOutputFieldMaxParallelism(int64_t val) {
+    OUTPUT_FIELD_MAX_PARALLELISM = val;
+    LOG_INFO("set default output field max parallelism: {}",
+             OUTPUT_FIELD_MAX_PARALLELISM);
+}
+
+void
+SetDefaultQueryProfileEnable(bool val) {
+    QUERY_PROFILE_ENABLED = val;
+    LOG_INFO("set default query profile enabled: {}", QUERY_PROFILE_ENABLED);
+}
+
 void
 SetCpuNum(const int num) {
     CPU_NUM = num;
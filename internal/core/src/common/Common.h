@@ -24,11 +24,18 @@
 namespace milvus {
 
 extern int64_t FILE_SLICE_SIZE;
+extern int64_t STORAGE_MULTIPART_SIZE;
 extern float HIGH_PRIORITY_THREAD_CORE_COEFFICIENT;
 extern float MIDDLE_PRIORITY_THREAD_CORE_COEFFICIENT;
 extern float LOW_PRIORITY_THREAD_CORE_COEFFICIENT;
 extern int CPU_NUM;
 extern int64_t EXEC_EVAL_EXPR_BATCH_SIZE;
+extern int64_t CACHE_READ_AHEAD_DEPTH;
+extern int64_t BRUTE_FORCE_CHUNK_PARALLELISM;
+extern int64_t JSON_SHADOW_COLUMN_MAX_PATHS;
+extern int64_t EXEC_EVAL_EXPR_MAX_PARALLELISM;
+extern int64_t OUTPUT_FIELD_MAX_PARALLELISM;
+extern bool QUERY_PROFILE_ENABLED;
 extern int64_t JSON_KEY_STATS_COMMIT_INTERVAL;
 extern bool OPTIMIZE_EXPR_ENABLED;
 extern bool GROWING_JSON_KEY_STATS_ENABLED;
@@ -37,6 +44,9 @@ extern bool CONFIG_PARAM_TYPE_CHECK_ENABLED;
 void
 SetIndexSliceSize(const int64_t size);
 
+void
+SetStorageMultipartSize(const int64_t size);
+
 void
 SetHighPriorityThreadCoreCoefficient(const float coefficient);
 
@@ -55,6 +65,24 @@ SetDefaultExecEvalExprBatchSize(int64_t val);
 void
 SetDefaultOptimizeExprEnable(bool val);
 
+void
+SetDefaultCacheReadAheadDepth(int64_t val);
+
+void
+SetDefaultBruteForceChunkParallelism(int64_t val);
+
+void
+SetDefaultJsonShadowColumnMaxPaths(int64_t val);
+
+void
+SetDefaultExecEvalExprMaxParallelism(int64_t val);
+
+void
+SetDefaultOutputFieldMaxParallelism(int64_t val);
+
+void
+SetDefaultQueryProfileEnable(bool val);
+
 void
 SetDefaultJSONKeyStatsCommitInterval(int64_t val);
 
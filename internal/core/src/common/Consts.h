@@ -62,11 +62,37 @@ const float DEFAULT_MIDDLE_PRIORITY_THREAD_CORE_COEFFICIENT = 5.0;
 const float DEFAULT_LOW_PRIORITY_THREAD_CORE_COEFFICIENT = 1.0;
 
 const int64_t DEFAULT_INDEX_FILE_SLICE_SIZE = 16 << 20;  // bytes
+// objects larger than this are read and written in parts of this size
+// concurrently, 0 to always use a single request
+const int64_t DEFAULT_STORAGE_MULTIPART_SIZE = 0;  // bytes
 
 const int DEFAULT_CPU_NUM = 1;
 
 const int64_t DEFAULT_EXEC_EVAL_EXPR_BATCH_SIZE = 8192;
 
+// number of chunks pinned ahead of a sequential column scan, 0 to disable.
+const int64_t DEFAULT_CACHE_READ_AHEAD_DEPTH = 0;
+
+// number of chunk ranges a sealed brute force search is split into, 1 to
+// search the chunks sequentially.
+const int64_t DEFAULT_BRUTE_FORCE_CHUNK_PARALLELISM = 1;
+
+// max number of json paths per sealed chunk extracted into typed shadow
+// columns, 0 to disable.
+const int64_t DEFAULT_JSON_SHADOW_COLUMN_MAX_PATHS = 0;
+
+// max number of drivers evaluating the filter of one segment concurrently, 1
+// to evaluate the batches sequentially.
+const int64_t DEFAULT_EXEC_EVAL_EXPR_MAX_PARALLELISM = 1;
+
+// max number of threads materializing the output fields of one segment
+// result concurrently, 1 to fill the fields sequentially.
+const int64_t DEFAULT_OUTPUT_FIELD_MAX_PARALLELISM = 1;
+
+// whether queries collect per operator and per expr stats into a profile
+// returned with their results.
+const bool DEFAULT_QUERY_PROFILE_ENABLED = false;
+
 constexpr const char* RADIUS = knowhere::meta::RADIUS;
 constexpr const char* RANGE_FILTER = knowhere::meta::RANGE_FILTER;
 
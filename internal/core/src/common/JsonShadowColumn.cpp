@@ -0,0 +1,398 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "common/JsonShadowColumn.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include <boost/algorithm/string/replace.hpp>
+
+namespace milvus {
+
+namespace {
+// rows parsed to pick the paths of a chunk
+constexpr int64_t kJsonShadowSampleRows = 1024;
+constexpr int kJsonShadowMaxDepth = 2;
+
+// res = mask & (values op val), nothing matches if no row has the type
+template <typename T, typename Values>
+void
+CompareValues(const Values& values,
+              const TargetBitmap& mask,
+              bitset::CompareOpType op,
+              const T& val,
+              int64_t offset,
+              int64_t size,
+              TargetBitmapView res) {
+    if (values.empty()) {
+        res.reset(0, size);
+        return;
+    }
+    res.inplace_compare_val<T>(values.data() + offset, size, val, op);
+    res.inplace_and(mask.view(offset, size), size);
+}
+
+template <typename T, typename Values>
+void
+RangeValues(const Values& values,
+            const TargetBitmap& mask,
+            const T& lower,
+            const T& upper,
+            bitset::RangeType range,
+            int64_t offset,
+            int64_t size,
+            TargetBitmapView res) {
+    if (values.empty()) {
+        res.reset(0, size);
+        return;
+    }
+    res.inplace_within_range_val<T>(
+        lower, upper, values.data() + offset, size, range);
+    res.inplace_and(mask.view(offset, size), size);
+}
+
+void
+CollectScalarPaths(simdjson::dom::object object,
+                   const std::string& prefix,
+                   int depth,
+                   std::unordered_map<std::string, int64_t>& counts) {
+    for (auto field : object) {
+        auto key = std::string(field.key);
+        boost::replace_all(key, "~", "~0");
+        boost::replace_all(key, "/", "~1");
+        auto pointer = prefix + "/" + key;
+        switch (field.value.type()) {
+            case simdjson::dom::element_type::OBJECT:
+                if (depth < kJsonShadowMaxDepth) {
+                    CollectScalarPaths(field.value.get_object().value(),
+                                       pointer,
+                                       depth + 1,
+                                       counts);
+                }
+                break;
+            case simdjson::dom::element_type::ARRAY:
+            case simdjson::dom::element_type::NULL_VALUE:
+                break;
+            default:
+                counts[pointer]++;
+        }
+    }
+}
+}  // namespace
+
+JsonShadowColumn::JsonShadowColumn(int64_t row_nums)
+    : row_nums_(row_nums),
+      valid_(row_nums, true),
+      int_mask_(row_nums, false),
+      number_mask_(row_nums, false),
+      string_mask_(row_nums, false),
+      bool_mask_(row_nums, false) {
+}
+
+void
+JsonShadowColumn::Set(int64_t row, simdjson::dom::element value) {
+    switch (value.type()) {
+        case simdjson::dom::element_type::INT64: {
+            if (ints_.empty()) {
+                ints_.resize(row_nums_);
+            }
+            if (doubles_.empty()) {
+                doubles_.resize(row_nums_);
+            }
+            ints_[row] = value.get_int64().value();
+            doubles_[row] = static_cast<double>(ints_[row]);
+            int_mask_.set(row);
+            number_mask_.set(row);
+            break;
+        }
+        // unsigned values only get here beyond the int64 range, where
+        // Json::at<int64_t> fails and the row compares as a double
+        case simdjson::dom::element_type::UINT64:
+        case simdjson::dom::element_type::DOUBLE: {
+            if (doubles_.empty()) {
+                doubles_.resize(row_nums_);
+            }
+            doubles_[row] = value.get_double().value();
+            number_mask_.set(row);
+            break;
+        }
+        case simdjson::dom::element_type::STRING: {
+            if (strings_.empty()) {
+                strings_.resize(row_nums_);
+            }
+            strings_[row] = std::string(value.get_string().value());
+            string_mask_.set(row);
+            break;
+        }
+        case simdjson::dom::element_type::BOOL: {
+            if (bools_.empty()) {
+                bools_.resize(row_nums_, false);
+            }
+            bools_[row] = value.get_bool().value();
+            bool_mask_.set(row);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void
+JsonShadowColumn::SetNull(int64_t row) {
+    valid_.reset(row);
+}
+
+int64_t
+JsonShadowColumn::TypedRowNums() const {
+    return number_mask_.count() + string_mask_.count() + bool_mask_.count();
+}
+
+size_t
+JsonShadowColumn::ByteSize() const {
+    size_t size = valid_.size_in_bytes() * 5;
+    size += ints_.size() * sizeof(int64_t);
+    size += doubles_.size() * sizeof(double);
+    size += bools_.size() * sizeof(bool);
+    size += strings_.size() * sizeof(std::string);
+    for (const auto& str : strings_) {
+        // short strings are stored inline
+        if (str.capacity() >= sizeof(std::string)) {
+            size += str.capacity() + 1;
+        }
+    }
+    return size;
+}
+
+template <typename T>
+const TargetBitmap&
+JsonShadowColumn::TypeMask() const {
+    if constexpr (std::is_same_v<T, int64_t> || std::is_same_v<T, double>) {
+        return number_mask_;
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return string_mask_;
+    } else {
+        static_assert(std::is_same_v<T, bool>, "unsupported shadow type");
+        return bool_mask_;
+    }
+}
+
+void
+JsonShadowColumn::ApplyValid(int64_t offset,
+                             int64_t size,
+                             TargetBitmapView res,
+                             TargetBitmapView valid_res) const {
+    auto valid = valid_.view(offset, size);
+    res.inplace_and(valid, size);
+    valid_res.inplace_and(valid, size);
+}
+
+template <typename T>
+void
+JsonShadowColumn::Compare(bitset::CompareOpType op,
+                          const T& val,
+                          int64_t offset,
+                          int64_t size,
+                          TargetBitmapView res,
+                          TargetBitmapView valid_res) const {
+    if constexpr (std::is_same_v<T, int64_t>) {
+        CompareValues(ints_, int_mask_, op, val, offset, size, res);
+        // Json::at<int64_t> falls back to at<double> for non int rows
+        TargetBitmap doubles(size, false);
+        CompareValues(doubles_,
+                      number_mask_,
+                      op,
+                      static_cast<double>(val),
+                      offset,
+                      size,
+                      doubles.view());
+        doubles.inplace_sub(int_mask_.view(offset, size), size);
+        res.inplace_or(doubles, size);
+    } else if constexpr (std::is_same_v<T, double>) {
+        CompareValues(doubles_, number_mask_, op, val, offset, size, res);
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        CompareValues(strings_, string_mask_, op, val, offset, size, res);
+    } else {
+        CompareValues(bools_, bool_mask_, op, val, offset, size, res);
+    }
+    if (op == bitset::CompareOpType::NE) {
+        TargetBitmap other_types(size, true);
+        other_types.inplace_sub(TypeMask<T>().view(offset, size), size);
+        res.inplace_or(other_types, size);
+    }
+    ApplyValid(offset, size, res, valid_res);
+}
+
+template <typename T>
+void
+JsonShadowColumn::WithinRange(const T& lower,
+                              const T& upper,
+                              bitset::RangeType range,
+                              int64_t offset,
+                              int64_t size,
+                              TargetBitmapView res,
+                              TargetBitmapView valid_res) const {
+    if constexpr (std::is_same_v<T, int64_t>) {
+        RangeValues(
+            ints_, int_mask_, lower, upper, range, offset, size, res);
+        TargetBitmap doubles(size, false);
+        RangeValues(doubles_,
+                    number_mask_,
+                    static_cast<double>(lower),
+                    static_cast<double>(upper),
+                    range,
+                    offset,
+                    size,
+                    doubles.view());
+        doubles.inplace_sub(int_mask_.view(offset, size), size);
+        res.inplace_or(doubles, size);
+    } else if constexpr (std::is_same_v<T, double>) {
+        RangeValues(
+            doubles_, number_mask_, lower, upper, range, offset, size, res);
+    } else {
+        static_assert(std::is_same_v<T, std::string>,
+                      "unsupported shadow range type");
+        RangeValues(
+            strings_, string_mask_, lower, upper, range, offset, size, res);
+    }
+    ApplyValid(offset, size, res, valid_res);
+}
+
+template void
+JsonShadowColumn::Compare<int64_t>(bitset::CompareOpType,
+                                   const int64_t&,
+                                   int64_t,
+                                   int64_t,
+                                   TargetBitmapView,
+                                   TargetBitmapView) const;
+template void
+JsonShadowColumn::Compare<double>(bitset::CompareOpType,
+                                  const double&,
+                                  int64_t,
+                                  int64_t,
+                                  TargetBitmapView,
+                                  TargetBitmapView) const;
+template void
+JsonShadowColumn::Compare<std::string>(bitset::CompareOpType,
+                                       const std::string&,
+                                       int64_t,
+                                       int64_t,
+                                       TargetBitmapView,
+                                       TargetBitmapView) const;
+template void
+JsonShadowColumn::Compare<bool>(bitset::CompareOpType,
+                                const bool&,
+                                int64_t,
+                                int64_t,
+                                TargetBitmapView,
+                                TargetBitmapView) const;
+template void
+JsonShadowColumn::WithinRange<int64_t>(const int64_t&,
+                                       const int64_t&,
+                                       bitset::RangeType,
+                                       int64_t,
+                                       int64_t,
+                                       TargetBitmapView,
+                                       TargetBitmapView) const;
+template void
+JsonShadowColumn::WithinRange<double>(const double&,
+                                      const double&,
+                                      bitset::RangeType,
+                                      int64_t,
+                                      int64_t,
+                                      TargetBitmapView,
+                                      TargetBitmapView) const;
+template void
+JsonShadowColumn::WithinRange<std::string>(const std::string&,
+                                           const std::string&,
+                                           bitset::RangeType,
+                                           int64_t,
+                                           int64_t,
+                                           TargetBitmapView,
+                                           TargetBitmapView) const;
+
+JsonShadowColumns
+BuildJsonShadowColumns(const std::vector<Json>& jsons,
+                       const FixedVector<bool>& valid,
+                       int64_t max_paths) {
+    JsonShadowColumns columns;
+    if (max_paths <= 0 || jsons.empty()) {
+        return columns;
+    }
+    auto has_value = [&](size_t row) {
+        return (valid.empty() || valid[row]) && jsons[row].size() > 0;
+    };
+
+    std::unordered_map<std::string, int64_t> counts;
+    int64_t sampled = 0;
+    for (size_t row = 0;
+         row < jsons.size() && sampled < kJsonShadowSampleRows;
+         ++row) {
+        if (!has_value(row)) {
+            continue;
+        }
+        sampled++;
+        simdjson::dom::object object;
+        if (jsons[row].dom_doc().get_object().get(object) ==
+            simdjson::SUCCESS) {
+            CollectScalarPaths(object, "", 1, counts);
+        }
+    }
+
+    std::vector<std::pair<std::string, int64_t>> paths;
+    for (auto& [pointer, count] : counts) {
+        if (count * 2 >= sampled) {
+            paths.emplace_back(pointer, count);
+        }
+    }
+    std::sort(paths.begin(), paths.end(), [](const auto& a, const auto& b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+    if (static_cast<int64_t>(paths.size()) > max_paths) {
+        paths.resize(max_paths);
+    }
+    if (paths.empty()) {
+        return columns;
+    }
+
+    int64_t row_nums = jsons.size();
+    std::vector<std::shared_ptr<JsonShadowColumn>> shadows;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        shadows.push_back(std::make_shared<JsonShadowColumn>(row_nums));
+    }
+    // one parse per row for all the paths
+    for (int64_t row = 0; row < row_nums; ++row) {
+        if (!valid.empty() && !valid[row]) {
+            for (auto& shadow : shadows) {
+                shadow->SetNull(row);
+            }
+            continue;
+        }
+        if (jsons[row].size() == 0) {
+            continue;
+        }
+        auto doc = jsons[row].dom_doc();
+        for (size_t i = 0; i < paths.size(); ++i) {
+            simdjson::dom::element value;
+            if (doc.at_pointer(paths[i].first).get(value) ==
+                simdjson::SUCCESS) {
+                shadows[i]->Set(row, value);
+            }
+        }
+    }
+    for (size_t i = 0; i < paths.size(); ++i) {
+        columns.emplace(std::move(paths[i].first), std::move(shadows[i]));
+    }
+    return columns;
+}
+
+}  // namespace milvus
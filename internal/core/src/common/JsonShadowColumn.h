@@ -0,0 +1,119 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/Json.h"
+#include "common/Types.h"
+#include "simdjson/dom.h"
+
+namespace milvus {
+
+// The values of one json path, extracted once from every row of a sealed
+// json chunk so that filters on the path compare typed arrays instead of
+// parsing each document.
+//
+// Every row holds at most one typed value. Rows where the path is missing or
+// holds null, an array or an object have no type bit set. Numbers keep the
+// row wise Json::at semantics: doubles_ holds every numeric row, ints_ only
+// the rows that are integers fitting in int64.
+class JsonShadowColumn {
+ public:
+    explicit JsonShadowColumn(int64_t row_nums);
+
+    // set a row from the element found at the path
+    void
+    Set(int64_t row, simdjson::dom::element value);
+
+    // null rows never match and are reported as invalid
+    void
+    SetNull(int64_t row);
+
+    int64_t
+    RowNums() const {
+        return row_nums_;
+    }
+
+    // number of rows holding a scalar value
+    int64_t
+    TypedRowNums() const;
+
+    // heap bytes of the column, counted in the size of its chunk
+    size_t
+    ByteSize() const;
+
+    // Evaluates `value op val` for rows [offset, offset + size) with the same
+    // result as comparing Json::at<T> row by row: rows holding another type
+    // only match NE. T is one of int64_t, double, std::string and bool.
+    template <typename T>
+    void
+    Compare(bitset::CompareOpType op,
+            const T& val,
+            int64_t offset,
+            int64_t size,
+            TargetBitmapView res,
+            TargetBitmapView valid_res) const;
+
+    template <typename T>
+    void
+    WithinRange(const T& lower,
+                const T& upper,
+                bitset::RangeType range,
+                int64_t offset,
+                int64_t size,
+                TargetBitmapView res,
+                TargetBitmapView valid_res) const;
+
+ private:
+    template <typename T>
+    const TargetBitmap&
+    TypeMask() const;
+
+    void
+    ApplyValid(int64_t offset,
+               int64_t size,
+               TargetBitmapView res,
+               TargetBitmapView valid_res) const;
+
+    int64_t row_nums_;
+    TargetBitmap valid_;
+    TargetBitmap int_mask_;
+    // int and double rows
+    TargetBitmap number_mask_;
+    TargetBitmap string_mask_;
+    TargetBitmap bool_mask_;
+    // allocated on the first row of the type
+    std::vector<int64_t> ints_;
+    std::vector<double> doubles_;
+    std::vector<std::string> strings_;
+    FixedVector<bool> bools_;
+};
+
+// json pointer -> shadow column
+using JsonShadowColumns =
+    std::unordered_map<std::string, std::shared_ptr<const JsonShadowColumn>>;
+
+// Extracts up to max_paths shadow columns from the rows of a json chunk.
+// Queries are unknown at seal time, so the paths are the object keys, nested
+// at most two levels, that hold a scalar in at least half of the sampled
+// rows, most frequent first. valid is empty for non nullable fields.
+JsonShadowColumns
+BuildJsonShadowColumns(const std::vector<Json>& jsons,
+                       const FixedVector<bool>& valid,
+                       int64_t max_paths);
+
+}  // namespace milvus
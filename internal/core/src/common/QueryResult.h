@@ -215,6 +215,9 @@ struct SearchResult {
     //Vector iterators, used for group by
     std::optional<std::vector<std::shared_ptr<VectorIterator>>>
         vector_iterators_;
+
+    // json execution profile of the segment, empty unless profiled
+    std::string exec_profile_;
 };
 
 using SearchResultPtr = std::shared_ptr<SearchResult>;
@@ -229,6 +232,8 @@ struct RetrieveResult {
     std::vector<int64_t> result_offsets_;
     std::vector<DataArray> field_data_;
     bool has_more_result = true;
+    // json execution profile of the segment, empty unless profiled
+    std::string exec_profile_;
 };
 
 using RetrieveResultPtr = std::shared_ptr<RetrieveResult>;
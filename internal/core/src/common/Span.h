@@ -43,6 +43,19 @@ class SpanBase {
           row_count_(row_count),
           element_sizeof_(element_sizeof) {
     }
+    // validity in bitmap form, bit `valid_bitmap_offset + i` of the words is
+    // the validity of row i.
+    explicit SpanBase(const void* data,
+                      const uint64_t* valid_bitmap,
+                      int64_t valid_bitmap_offset,
+                      int64_t row_count,
+                      int64_t element_sizeof)
+        : data_(data),
+          valid_bitmap_(valid_bitmap),
+          valid_bitmap_offset_(valid_bitmap_offset),
+          row_count_(row_count),
+          element_sizeof_(element_sizeof) {
+    }
 
     int64_t
     row_count() const {
@@ -64,9 +77,21 @@ class SpanBase {
         return valid_data_;
     }
 
+    const uint64_t*
+    valid_bitmap() const {
+        return valid_bitmap_;
+    }
+
+    int64_t
+    valid_bitmap_offset() const {
+        return valid_bitmap_offset_;
+    }
+
  private:
     const void* data_;
     const bool* valid_data_{nullptr};
+    const uint64_t* valid_bitmap_{nullptr};
+    int64_t valid_bitmap_offset_{0};
     int64_t row_count_;
     int64_t element_sizeof_;
 };
@@ -90,6 +115,13 @@ class Span<T,
     }
 
     operator SpanBase() const {
+        if (valid_bitmap_ != nullptr) {
+            return SpanBase(data_,
+                            valid_bitmap_,
+                            valid_bitmap_offset_,
+                            row_count_,
+                            sizeof(T));
+        }
         return SpanBase(data_, valid_data_, row_count_, sizeof(T));
     }
 
@@ -98,6 +130,8 @@ class Span<T,
                base.valid_data(),
                base.row_count()) {
         assert(base.element_sizeof() == sizeof(T));
+        valid_bitmap_ = base.valid_bitmap();
+        valid_bitmap_offset_ = base.valid_bitmap_offset();
     }
 
     int64_t
@@ -115,6 +149,35 @@ class Span<T,
         return valid_data_;
     }
 
+    // set instead of valid_data() when the validity is bit packed, see
+    // SpanBase.
+    const uint64_t*
+    valid_bitmap() const {
+        return valid_bitmap_;
+    }
+
+    int64_t
+    valid_bitmap_offset() const {
+        return valid_bitmap_offset_;
+    }
+
+    bool
+    nullable() const {
+        return valid_data_ != nullptr || valid_bitmap_ != nullptr;
+    }
+
+    bool
+    is_valid(int64_t offset) const {
+        if (valid_data_ != nullptr) {
+            return valid_data_[offset];
+        }
+        if (valid_bitmap_ != nullptr) {
+            auto bit = valid_bitmap_offset_ + offset;
+            return (valid_bitmap_[bit >> 6] >> (bit & 63)) & 1;
+        }
+        return true;
+    }
+
     const T&
     operator[](int64_t offset) const {
         return data_[offset];
@@ -128,6 +191,8 @@ class Span<T,
  private:
     const T* data_;
     const bool* valid_data_;
+    const uint64_t* valid_bitmap_{nullptr};
+    int64_t valid_bitmap_offset_{0};
     int64_t row_count_;
 };
 
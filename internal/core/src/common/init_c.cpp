@@ -20,7 +20,8 @@
 #include "common/Tracer.h"
 
 std::once_flag flag1, flag2, flag3, flag4, flag5, flag6, flag7, flag8, flag9,
-    flag10;
+    flag10, flag11, flag12, flag13, flag14, flag15, flag16,
+    flag17;
 std::once_flag traceFlag;
 
 void
@@ -29,6 +30,14 @@ InitIndexSliceSize(const int64_t size) {
         flag1, [](int64_t size) { milvus::SetIndexSliceSize(size); }, size);
 }
 
+void
+InitStorageMultipartSize(const int64_t size) {
+    std::call_once(
+        flag16,
+        [](int64_t size) { milvus::SetStorageMultipartSize(size); },
+        size);
+}
+
 void
 InitHighPriorityThreadCoreCoefficient(const float value) {
     std::call_once(
@@ -79,6 +88,54 @@ InitDefaultOptimizeExprEnable(bool val) {
         val);
 }
 
+void
+InitDefaultCacheReadAheadDepth(int64_t val) {
+    std::call_once(
+        flag11,
+        [](int64_t val) { milvus::SetDefaultCacheReadAheadDepth(val); },
+        val);
+}
+
+void
+InitDefaultBruteForceChunkParallelism(int64_t val) {
+    std::call_once(
+        flag12,
+        [](int64_t val) { milvus::SetDefaultBruteForceChunkParallelism(val); },
+        val);
+}
+
+void
+InitDefaultJsonShadowColumnMaxPaths(int64_t val) {
+    std::call_once(
+        flag13,
+        [](int64_t val) { milvus::SetDefaultJsonShadowColumnMaxPaths(val); },
+        val);
+}
+
+void
+InitDefaultExprEvalMaxParallelism(int64_t val) {
+    std::call_once(
+        flag14,
+        [](int64_t val) { milvus::SetDefaultExecEvalExprMaxParallelism(val); },
+        val);
+}
+
+void
+InitDefaultOutputFieldMaxParallelism(int64_t val) {
+    std::call_once(
+        flag17,
+        [](int64_t val) { milvus::SetDefaultOutputFieldMaxParallelism(val); },
+        val);
+}
+
+void
+InitDefaultQueryProfileEnable(bool val) {
+    std::call_once(
+        flag15,
+        [](bool val) { milvus::SetDefaultQueryProfileEnable(val); },
+        val);
+}
+
 void
 InitDefaultJSONKeyStatsCommitInterval(int64_t val) {
     std::call_once(
@@ -27,6 +27,9 @@ extern "C" {
 void
 InitIndexSliceSize(const int64_t);
 
+void
+InitStorageMultipartSize(const int64_t);
+
 void
 InitHighPriorityThreadCoreCoefficient(const float);
 
@@ -51,6 +54,24 @@ SetTrace(CTraceConfig* config);
 void
 InitDefaultOptimizeExprEnable(bool val);
 
+void
+InitDefaultCacheReadAheadDepth(int64_t val);
+
+void
+InitDefaultBruteForceChunkParallelism(int64_t val);
+
+void
+InitDefaultJsonShadowColumnMaxPaths(int64_t val);
+
+void
+InitDefaultExprEvalMaxParallelism(int64_t val);
+
+void
+InitDefaultOutputFieldMaxParallelism(int64_t val);
+
+void
+InitDefaultQueryProfileEnable(bool val);
+
 void
 InitDefaultJSONKeyStatsCommitInterval(int64_t val);
 
@@ -39,6 +39,13 @@ enum CacheWarmupPolicy {
 
 typedef enum CacheWarmupPolicy CacheWarmupPolicy;
 
+enum CacheEvictionPolicy {
+    CacheEvictionPolicy_LRU = 0,
+    CacheEvictionPolicy_TwoQueue = 1,
+};
+
+typedef enum CacheEvictionPolicy CacheEvictionPolicy;
+
 // pure C don't support that we use schemapb.DataType directly.
 // Note: the value of all enumerations must match the corresponding schemapb.DataType.
 // TODO: what if there are increments in schemapb.DataType.
@@ -114,6 +121,9 @@ typedef struct CMmapConfig {
     bool scalar_field_enable_mmap;
     bool vector_index_enable_mmap;
     bool vector_field_enable_mmap;
+    bool anon_arena_enable;
+    const char* huge_page_mode;
+    bool numa_local;
 } CMmapConfig;
 
 typedef struct CTraceConfig {
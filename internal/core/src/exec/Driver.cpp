@@ -155,7 +155,11 @@ Driver::Close() {
         return;
     }
 
+    const auto& profile = ctx_->task_->query_context()->profile();
     for (auto& op : operators_) {
+        if (profile) {
+            profile->AddOperator(op->Profile());
+        }
         op->Close();
     }
 
@@ -200,6 +204,10 @@ Driver::RunInternal(std::shared_ptr<Driver>& self,
     try {
         int num_operators = operators_.size();
         ContinueFuture future;
+        bool profiled = ctx_->task_->query_context()->profile() != nullptr;
+        auto op_stats = [profiled](Operator* op) {
+            return profiled ? &op->stats() : nullptr;
+        };
 
         for (;;) {
             for (int32_t i = num_operators - 1; i >= 0; --i) {
@@ -234,6 +242,7 @@ Driver::RunInternal(std::shared_ptr<Driver>& self,
                     if (needs_input) {
                         RowVectorPtr result;
                         {
+                            ProfileScope<OperatorStats> scope(op_stats(op));
                             CALL_OPERATOR(
                                 result = op->GetOutput(), op, "GetOutput");
                             if (result) {
@@ -246,6 +255,14 @@ Driver::RunInternal(std::shared_ptr<Driver>& self,
                             }
                         }
                         if (result) {
+                            if (profiled) {
+                                op->stats().output_batches_++;
+                                op->stats().output_rows_ += result->size();
+                                next_op->stats().input_batches_++;
+                                next_op->stats().input_rows_ += result->size();
+                            }
+                            ProfileScope<OperatorStats> scope(
+                                op_stats(next_op));
                             CALL_OPERATOR(
                                 next_op->AddInput(result), next_op, "AddInput");
                             i += 2;
@@ -275,6 +292,7 @@ Driver::RunInternal(std::shared_ptr<Driver>& self,
                     }
                 } else {
                     {
+                        ProfileScope<OperatorStats> scope(op_stats(op));
                         CALL_OPERATOR(
                             result = op->GetOutput(), op, "GetOutput");
                         if (result) {
@@ -283,6 +301,10 @@ Driver::RunInternal(std::shared_ptr<Driver>& self,
                                 fmt::format("GetOutput must return nullptr or "
                                             "a non-empty vector: {}",
                                             op->get_operator_type()));
+                            if (profiled) {
+                                op->stats().output_batches_++;
+                                op->stats().output_rows_ += result->size();
+                            }
                             blocking_reason_ = BlockingReason::kWaitForConsumer;
                             return StopReason::kBlock;
                         }
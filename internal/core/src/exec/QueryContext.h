@@ -27,6 +27,7 @@
 #include "common/Common.h"
 #include "common/Types.h"
 #include "common/Exception.h"
+#include "exec/QueryProfile.h"
 #include "segcore/SegmentInterface.h"
 
 namespace milvus {
@@ -119,6 +120,13 @@ class QueryConfig : public MemConfig {
     static constexpr const char* kExprEvalBatchSize =
         "expression.eval_batch_size";
 
+    // Max number of drivers evaluating the filter of a segment concurrently.
+    static constexpr const char* kExprEvalMaxParallelism =
+        "expression.eval_max_parallelism";
+
+    // Whether to collect a QueryProfile while executing the query.
+    static constexpr const char* kQueryProfileEnabled = "query.profile_enabled";
+
     QueryConfig(const std::unordered_map<std::string, std::string>& values)
         : MemConfig(values) {
     }
@@ -135,6 +143,18 @@ class QueryConfig : public MemConfig {
         return BaseConfig::Get<int64_t>(kExprEvalBatchSize,
                                         EXEC_EVAL_EXPR_BATCH_SIZE);
     }
+
+    int64_t
+    get_expr_eval_max_parallelism() const {
+        return BaseConfig::Get<int64_t>(kExprEvalMaxParallelism,
+                                        EXEC_EVAL_EXPR_MAX_PARALLELISM);
+    }
+
+    bool
+    get_query_profile_enabled() const {
+        return BaseConfig::Get<bool>(kQueryProfileEnabled,
+                                     QUERY_PROFILE_ENABLED);
+    }
 };
 
 class Context {
@@ -192,6 +212,9 @@ class QueryContext : public Context {
           query_config_(query_config),
           executor_(executor),
           consistency_level_(consistency_level) {
+        if (query_config_->get_query_profile_enabled()) {
+            profile_ = std::make_shared<QueryProfile>();
+        }
     }
 
     folly::Executor*
@@ -284,6 +307,12 @@ class QueryContext : public Context {
         return consistency_level_;
     }
 
+    // nullptr unless profiling is enabled for the query
+    const std::shared_ptr<QueryProfile>&
+    profile() const {
+        return profile_;
+    }
+
  private:
     folly::Executor* executor_;
     //folly::Executor::KeepAlive<> executor_keepalive_;
@@ -307,6 +336,8 @@ class QueryContext : public Context {
     milvus::RetrieveResult retrieve_result_;
 
     int32_t consistency_level_ = 0;
+
+    std::shared_ptr<QueryProfile> profile_;
 };
 
 // Represent the state of one thread of query execution.
@@ -0,0 +1,126 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "QueryProfile.h"
+
+#include "common/EasyAssert.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+std::string
+ExprPath(const ExprStats& stats) {
+    if (stats.index_batches_ > 0 && stats.data_batches_ > 0) {
+        return "mixed";
+    }
+    if (stats.index_batches_ > 0) {
+        return "index";
+    }
+    if (stats.data_batches_ > 0) {
+        return "data";
+    }
+    return "";
+}
+}  // namespace
+
+void
+ExprStats::Merge(const ExprStats& other) {
+    wall_ns_ += other.wall_ns_;
+    batches_ += other.batches_;
+    input_rows_ += other.input_rows_;
+    output_rows_ += other.output_rows_;
+    index_batches_ += other.index_batches_;
+    data_batches_ += other.data_batches_;
+    skipped_chunks_ += other.skipped_chunks_;
+    cache_pins_ += other.cache_pins_;
+    cache_misses_ += other.cache_misses_;
+}
+
+void
+MergeExprProfiles(std::vector<ExprProfile>& into,
+                  const std::vector<ExprProfile>& from) {
+    if (from.empty()) {
+        return;
+    }
+    if (into.empty()) {
+        into = from;
+        return;
+    }
+    AssertInfo(into.size() == from.size(),
+               "can not merge profiles of {} and {} exprs",
+               into.size(),
+               from.size());
+    for (size_t i = 0; i < into.size(); ++i) {
+        into[i].stats_.Merge(from[i].stats_);
+    }
+}
+
+void
+QueryProfile::AddOperator(OperatorProfile profile) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    operators_.push_back(std::move(profile));
+}
+
+std::vector<OperatorProfile>
+QueryProfile::operators() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return operators_;
+}
+
+nlohmann::json
+QueryProfile::ToJson() const {
+    auto json = nlohmann::json::array();
+    for (const auto& op : operators()) {
+        auto exprs = nlohmann::json::array();
+        for (const auto& expr : op.exprs_) {
+            const auto& stats = expr.stats_;
+            exprs.push_back({
+                {"name", expr.name_},
+                {"expr", expr.expr_},
+                {"depth", expr.depth_},
+                {"wall_ns", stats.wall_ns_},
+                {"batches", stats.batches_},
+                {"input_rows", stats.input_rows_},
+                {"output_rows", stats.output_rows_},
+                {"path", ExprPath(stats)},
+                {"index_batches", stats.index_batches_},
+                {"data_batches", stats.data_batches_},
+                {"skipped_chunks", stats.skipped_chunks_},
+                {"cache_pins", stats.cache_pins_},
+                {"cache_misses", stats.cache_misses_},
+            });
+        }
+        const auto& stats = op.stats_;
+        json.push_back({
+            {"operator", op.type_},
+            {"plannode_id", op.plannode_id_},
+            {"operator_id", op.operator_id_},
+            {"wall_ns", stats.wall_ns_},
+            {"input_batches", stats.input_batches_},
+            {"input_rows", stats.input_rows_},
+            {"output_batches", stats.output_batches_},
+            {"output_rows", stats.output_rows_},
+            {"cache_pins", stats.cache_pins_},
+            {"cache_misses", stats.cache_misses_},
+            {"exprs", exprs},
+        });
+    }
+    return json;
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,148 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "cachinglayer/Utils.h"
+
+namespace milvus {
+namespace exec {
+
+struct ExprStats {
+    // including the time spent in the inputs of the expr
+    int64_t wall_ns_{0};
+    int64_t batches_{0};
+    int64_t input_rows_{0};
+    // rows the expr evaluated to true
+    int64_t output_rows_{0};
+    // batches of a column expr answered by a scalar index or by a raw data
+    // scan, both are 0 for the other exprs
+    int64_t index_batches_{0};
+    int64_t data_batches_{0};
+    // chunks ruled out by the skip index without being scanned
+    int64_t skipped_chunks_{0};
+    int64_t cache_pins_{0};
+    int64_t cache_misses_{0};
+
+    void
+    Merge(const ExprStats& other);
+};
+
+struct ExprProfile {
+    std::string name_;
+    std::string expr_;
+    // 0 for the root of a filter, children follow their parent
+    int32_t depth_{0};
+    ExprStats stats_;
+};
+
+struct OperatorStats {
+    // time spent in AddInput and GetOutput
+    int64_t wall_ns_{0};
+    int64_t input_batches_{0};
+    int64_t input_rows_{0};
+    int64_t output_batches_{0};
+    int64_t output_rows_{0};
+    int64_t cache_pins_{0};
+    int64_t cache_misses_{0};
+};
+
+struct OperatorProfile {
+    std::string type_;
+    std::string plannode_id_;
+    int32_t operator_id_{0};
+    OperatorStats stats_;
+    // exprs of filter operators, in pre order
+    std::vector<ExprProfile> exprs_;
+};
+
+// Adds the exprs of from to those of the same shaped into, used when several
+// copies of a filter evaluate parts of the rows.
+void
+MergeExprProfiles(std::vector<ExprProfile>& into,
+                  const std::vector<ExprProfile>& from);
+
+// Adds the wall time and the cache traffic of the calling thread between
+// its construction and destruction to stats, if stats is not nullptr.
+template <typename Stats>
+class ProfileScope {
+ public:
+    explicit ProfileScope(Stats* stats) : stats_(stats) {
+        if (stats_ != nullptr) {
+            auto& cache_stats = cachinglayer::thread_cache_stats();
+            pins_ = cache_stats.pins_;
+            misses_ = cache_stats.misses_;
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ProfileScope() {
+        if (stats_ != nullptr) {
+            auto end = std::chrono::steady_clock::now();
+            stats_->wall_ns_ +=
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end -
+                                                                     start_)
+                    .count();
+            auto& cache_stats = cachinglayer::thread_cache_stats();
+            stats_->cache_pins_ += cache_stats.pins_ - pins_;
+            stats_->cache_misses_ += cache_stats.misses_ - misses_;
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope&
+    operator=(const ProfileScope&) = delete;
+
+ private:
+    Stats* stats_;
+    std::chrono::steady_clock::time_point start_;
+    int64_t pins_{0};
+    int64_t misses_{0};
+};
+
+// Execution profile of one segment query, filled by the drivers as they
+// close their operators.
+class QueryProfile {
+ public:
+    void
+    AddOperator(OperatorProfile profile);
+
+    std::vector<OperatorProfile>
+    operators() const;
+
+    nlohmann::json
+    ToJson() const;
+
+    std::string
+    ToString() const {
+        return ToJson().dump();
+    }
+
+ private:
+    mutable std::mutex mutex_;
+    std::vector<OperatorProfile> operators_;
+};
+
+}  // namespace exec
+}  // namespace milvus
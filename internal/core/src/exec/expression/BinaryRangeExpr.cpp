@@ -260,7 +260,17 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForIndex() {
             return std::move(
                 func(index_ptr, val1, val2, lower_inclusive, upper_inclusive));
         };
-    auto res = ProcessIndexChunks<T>(execute_sub_batch, val1, val2);
+    auto execute_window = [lower_inclusive, upper_inclusive](
+                              Index* index_ptr,
+                              int64_t offset,
+                              TargetBitmapView res,
+                              HighPrecisionType val1,
+                              HighPrecisionType val2) {
+        index_ptr->RangeWindow(
+            val1, lower_inclusive, val2, upper_inclusive, offset, res);
+    };
+    auto res = ProcessIndexChunksByWindow<T>(
+        execute_sub_batch, execute_window, val1, val2);
     AssertInfo(res->size() == real_batch_size,
                "internal error: expr processed rows {} not equal "
                "expect batch size {}",
@@ -523,6 +533,37 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForJson(EvalCtx& context) {
         }
         processed_cursor += size;
     };
+
+    // chunks sealed with a shadow column of the path are compared with the
+    // bitset kernels instead of parsing every row
+    auto range_type =
+        lower_inclusive
+            ? (upper_inclusive ? milvus::bitset::RangeType::IncInc
+                               : milvus::bitset::RangeType::IncExc)
+            : (upper_inclusive ? milvus::bitset::RangeType::ExcInc
+                               : milvus::bitset::RangeType::ExcExc);
+    auto shadow_func = [this,
+                        field_id,
+                        pointer,
+                        range_type,
+                        val1,
+                        val2,
+                        &processed_cursor](int64_t chunk_id,
+                                           int64_t data_pos,
+                                           int64_t size,
+                                           TargetBitmapView res,
+                                           TargetBitmapView valid_res) {
+        auto pw = segment_->GetJsonShadowColumn(field_id, chunk_id, pointer);
+        auto shadow = pw.get();
+        if (shadow == nullptr) {
+            return false;
+        }
+        shadow->WithinRange<ValueType>(
+            val1, val2, range_type, data_pos, size, res, valid_res);
+        processed_cursor += size;
+        return true;
+    };
+
     int64_t processed_size;
     if (has_offset_input_) {
         processed_size = ProcessDataByOffsets<milvus::Json>(execute_sub_batch,
@@ -533,8 +574,13 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForJson(EvalCtx& context) {
                                                             val1,
                                                             val2);
     } else {
-        processed_size = ProcessDataChunks<milvus::Json>(
-            execute_sub_batch, std::nullptr_t{}, res, valid_res, val1, val2);
+        processed_size = ProcessJsonDataChunks(execute_sub_batch,
+                                               std::nullptr_t{},
+                                               shadow_func,
+                                               res,
+                                               valid_res,
+                                               val1,
+                                               val2);
     }
     AssertInfo(processed_size == real_batch_size,
                "internal error: expr processed rows {} not equal "
@@ -257,6 +257,7 @@ class PhyBinaryRangeFilterExpr : public SegmentExpr {
                       batch_size,
                       consistency_level),
           expr_(expr) {
+        TryUseInterimIndex();
     }
 
     void
@@ -37,7 +37,7 @@ PhyCallExpr::Eval(EvalCtx& context, VectorPtr& result) {
     std::vector<VectorPtr> args;
     for (auto& input : this->inputs_) {
         VectorPtr arg_result;
-        input->Eval(context, arg_result);
+        input->ProfiledEval(context, arg_result);
         args.push_back(std::move(arg_result));
     }
     RowVector row_vector(std::move(args));
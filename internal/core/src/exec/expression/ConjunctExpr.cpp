@@ -98,7 +98,7 @@ PhyConjunctFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
     }
     for (int i = 0; i < input_order_.size(); ++i) {
         VectorPtr input_result;
-        inputs_[input_order_[i]]->Eval(context, input_result);
+        inputs_[input_order_[i]]->ProfiledEval(context, input_result);
         if (i == 0) {
             result = input_result;
             auto all_flat_result = GetColumnVector(result);
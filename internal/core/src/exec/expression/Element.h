@@ -22,6 +22,7 @@
 
 #include "common/Types.h"
 #include "exec/expression/EvalCtx.h"
+#include "exec/expression/TermSet.h"
 #include "exec/expression/VectorFunction.h"
 #include "exec/expression/Utils.h"
 #include "exec/QueryContext.h"
@@ -172,6 +173,33 @@ class SortVectorElement : public MultiElement {
     bool sorted_{false};
 };
 
+// Sorted values for skip index checks plus a TermSet for the per row
+// membership test. Hot loops that know T call Contains() directly and skip
+// the virtual In() and its variant.
+template <typename T>
+class TermSetElement : public SortVectorElement<T> {
+ public:
+    explicit TermSetElement(const std::vector<T>& values)
+        : SortVectorElement<T>(values), set_(values) {
+    }
+
+    bool
+    In(const MultiElement::ValueType& value) const override {
+        if (std::holds_alternative<T>(value)) {
+            return set_.Contains(std::get<T>(value));
+        }
+        return false;
+    }
+
+    bool
+    Contains(const T& value) const {
+        return set_.Contains(value);
+    }
+
+ private:
+    TermSet<T> set_;
+};
+
 template <typename T>
 class FlatVectorElement : public MultiElement {
  public:
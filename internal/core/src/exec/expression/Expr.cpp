@@ -49,7 +49,50 @@ ExprSet::Eval(int32_t begin,
     results.resize(exprs_.size());
 
     for (size_t i = begin; i < end; ++i) {
-        exprs_[i]->Eval(context, results[i]);
+        exprs_[i]->ProfiledEval(context, results[i]);
+    }
+}
+
+void
+Expr::ProfiledEval(EvalCtx& context, VectorPtr& result) {
+    auto exec_context = context.get_exec_context();
+    if (exec_context == nullptr ||
+        !exec_context->get_query_context()->profile()) {
+        Eval(context, result);
+        return;
+    }
+    {
+        ProfileScope<ExprStats> scope(&stats_);
+        Eval(context, result);
+    }
+    stats_.batches_++;
+    if (IsSource()) {
+        if (IsIndexPath()) {
+            stats_.index_batches_++;
+        } else {
+            stats_.data_batches_++;
+        }
+    }
+    if (auto col_vec = std::dynamic_pointer_cast<ColumnVector>(result)) {
+        stats_.input_rows_ += col_vec->size();
+        if (col_vec->IsBitmap()) {
+            TargetBitmapView view(col_vec->GetRawData(), col_vec->size());
+            stats_.output_rows_ += view.count();
+        }
+    }
+}
+
+void
+Expr::CollectProfiles(int32_t depth,
+                      std::vector<ExprProfile>& profiles) const {
+    ExprProfile profile;
+    profile.name_ = name_;
+    profile.expr_ = ToString();
+    profile.depth_ = depth;
+    profile.stats_ = stats_;
+    profiles.push_back(std::move(profile));
+    for (const auto& input : inputs_) {
+        input->CollectProfiles(depth + 1, profiles);
     }
 }
 
@@ -28,6 +28,7 @@
 #include "exec/expression/VectorFunction.h"
 #include "exec/expression/Utils.h"
 #include "exec/QueryContext.h"
+#include "exec/QueryProfile.h"
 #include "expr/ITypeExpr.h"
 #include "index/Index.h"
 #include "index/JsonFlatIndex.h"
@@ -77,6 +78,27 @@ class Expr {
     Eval(EvalCtx& context, VectorPtr& result) {
     }
 
+    // Eval that also records the ExprStats of the call when the query is
+    // profiled. Parents evaluate their inputs through it.
+    void
+    ProfiledEval(EvalCtx& context, VectorPtr& result);
+
+    // whether the batches are answered by a scalar index rather than by
+    // scanning the raw data, only meaningful for source exprs
+    virtual bool
+    IsIndexPath() const {
+        return false;
+    }
+
+    const ExprStats&
+    stats() const {
+        return stats_;
+    }
+
+    // appends the profile of the expr and of its inputs, in pre order
+    void
+    CollectProfiles(int32_t depth, std::vector<ExprProfile>& profiles) const;
+
     // Only move cursor to next batch
     // but not do real eval for optimization
     virtual void
@@ -123,6 +145,8 @@ class Expr {
     // whether we have offset input and do expr filtering on these data
     // default is false which means we will do expr filtering on the total segment data
     bool has_offset_input_ = false;
+
+    ExprStats stats_;
 };
 
 using ExprPtr = std::shared_ptr<milvus::exec::Expr>;
@@ -268,7 +292,7 @@ class SegmentExpr : public Expr {
 
     void
     MoveCursorForIndex() {
-        AssertInfo(segment_->type() == SegmentType::Sealed,
+        AssertInfo(segment_->type() == SegmentType::Sealed || is_interim_index_,
                    "index mode only for sealed segment");
         auto size =
             std::min(active_count_ - current_index_chunk_pos_, batch_size_);
@@ -276,6 +300,56 @@ class SegmentExpr : public Expr {
         current_index_chunk_pos_ += size;
     }
 
+    // Switches an expr on a growing segment to the interim scalar index of
+    // its field, if the index covers all the active rows. The index answers
+    // for the whole segment as one chunk, like a sealed segment index.
+    void
+    TryUseInterimIndex() {
+        if (!is_index_mode_ && segment_->type() == SegmentType::Growing &&
+            segment_->HasInterimScalarIndex(field_id_, active_count_)) {
+            is_index_mode_ = true;
+            is_interim_index_ = true;
+            num_index_chunk_ = 1;
+        }
+    }
+
+    // rows of an index chunk
+    int64_t
+    IndexChunkRows() const {
+        return is_interim_index_ ? active_count_ : size_per_chunk_;
+    }
+
+    // scalar indexes answer for the whole segment at once
+    bool
+    IsIndexMode() const {
+        return is_index_mode_;
+    }
+
+    // whether the first Eval computes and caches the result of the whole
+    // segment, which every copy of this expr would compute again
+    virtual bool
+    CachesWholeSegment() const {
+        return IsIndexMode();
+    }
+
+    bool
+    IsIndexPath() const override {
+        return is_index_mode_ && use_index_;
+    }
+
+    // whether the skip index rules out chunk_id, counted in the stats
+    bool
+    SkipChunk(const std::function<bool(const milvus::SkipIndex&, FieldId, int)>&
+                  skip_func,
+              int64_t chunk_id) {
+        if (skip_func &&
+            skip_func(segment_->GetSkipIndex(), field_id_, chunk_id)) {
+            stats_.skipped_chunks_++;
+            return true;
+        }
+        return false;
+    }
+
     void
     MoveCursor() override {
         // when we specify input, do not maintain states
@@ -305,6 +379,27 @@ class SegmentExpr : public Expr {
         }
     }
 
+    // Growing segments keep validity bit packed, their spans carry a bitmap
+    // instead of valid_data(). Funcs take them as having no nulls, so their
+    // validity of rows [pos, pos + size) is anded into the results a word at
+    // a time afterwards.
+    template <typename T>
+    void
+    ApplyValidBitmap(const Span<T>& chunk,
+                     int64_t pos,
+                     TargetBitmapView res,
+                     TargetBitmapView valid_res,
+                     const int size) {
+        if (chunk.valid_bitmap() != nullptr) {
+            // the view is only read
+            TargetBitmapView valid(const_cast<uint64_t*>(chunk.valid_bitmap()),
+                                   chunk.valid_bitmap_offset() + pos,
+                                   size);
+            res.inplace_and(valid, size);
+            valid_res.inplace_and(valid, size);
+        }
+    }
+
     int64_t
     GetNextBatchSize() {
         auto current_chunk = is_index_mode_ && use_index_ ? current_index_chunk_
@@ -344,11 +439,10 @@ class SegmentExpr : public Expr {
         auto need_size =
             std::min(active_count_ - current_data_chunk_pos_, batch_size_);
 
-        auto& skip_index = segment_->GetSkipIndex();
         auto pw = segment_->get_batch_views<T>(
             field_id_, 0, current_data_chunk_pos_, need_size);
         auto views_info = pw.get();
-        if (!skip_func || !skip_func(skip_index, field_id_, 0)) {
+        if (!SkipChunk(skip_func, 0)) {
             // first is the raw data, second is valid_data
             // use valid_data to see if raw data is null
             func(views_info.first.data(),
@@ -517,8 +611,12 @@ class SegmentExpr : public Expr {
                                 valid_res + processed_size,
                                 values...);
                         } else {
-                            res[processed_size] = valid_res[processed_size] =
-                                (valid_data[0]);
+                            ApplyValidData(valid_data.empty()
+                                               ? nullptr
+                                               : valid_data.data(),
+                                           res + processed_size,
+                                           valid_res + processed_size,
+                                           1);
                         }
                         processed_size++;
                     }
@@ -605,6 +703,11 @@ class SegmentExpr : public Expr {
                                    valid_res + processed_size,
                                    1);
                 }
+                ApplyValidBitmap(chunk,
+                                 chunk_offset,
+                                 res + processed_size,
+                                 valid_res + processed_size,
+                                 1);
                 processed_size++;
             }
         }
@@ -643,14 +746,13 @@ class SegmentExpr : public Expr {
 
             size = std::min(size, batch_size_ - processed_size);
 
-            auto& skip_index = segment_->GetSkipIndex();
             auto pw = segment_->chunk_data<T>(field_id_, i);
             auto chunk = pw.get();
             const bool* valid_data = chunk.valid_data();
             if (valid_data != nullptr) {
                 valid_data += data_pos;
             }
-            if (!skip_func || !skip_func(skip_index, field_id_, i)) {
+            if (!SkipChunk(skip_func, i)) {
                 const T* data = chunk.data() + data_pos;
                 func(data,
                      valid_data,
@@ -665,6 +767,11 @@ class SegmentExpr : public Expr {
                                valid_res + processed_size,
                                size);
             }
+            ApplyValidBitmap(chunk,
+                             data_pos,
+                             res + processed_size,
+                             valid_res + processed_size,
+                             size);
 
             processed_size += size;
             if (processed_size >= batch_size_) {
@@ -677,6 +784,55 @@ class SegmentExpr : public Expr {
         return processed_size;
     }
 
+    // Pins chunks ahead of a sequential raw data scan in the background. Chunks pruned
+    // by the skip index are left out of the declared sequence.
+    struct DataReadAhead {
+        std::unique_ptr<ReadAheadHandle> handle_{nullptr};
+        // ascending
+        std::vector<int64_t> chunk_ids_;
+
+        void
+        Advance(int64_t chunk_id) {
+            if (handle_ == nullptr) {
+                return;
+            }
+            // a pruned chunk is not scanned, the read ahead pin of the next
+            // kept chunk must be held until the scanner gets there.
+            auto it = std::lower_bound(
+                chunk_ids_.begin(), chunk_ids_.end(), chunk_id);
+            if (it == chunk_ids_.end() || *it != chunk_id) {
+                return;
+            }
+            handle_->Advance(std::distance(chunk_ids_.begin(), it));
+        }
+    };
+
+    DataReadAhead
+    MakeDataReadAhead(
+        int64_t start_chunk,
+        const std::function<bool(const milvus::SkipIndex&, FieldId, int)>&
+            skip_func) {
+        DataReadAhead read_ahead;
+        auto& skip_index = segment_->GetSkipIndex();
+        for (int64_t i = start_chunk; i < num_data_chunk_; i++) {
+            if (!skip_func || !skip_func(skip_index, field_id_, i)) {
+                read_ahead.chunk_ids_.push_back(i);
+            }
+        }
+        read_ahead.handle_ =
+            segment_->read_ahead_chunks(field_id_, read_ahead.chunk_ids_);
+        return read_ahead;
+    }
+
+    // Evaluates rows [data_pos, data_pos + size) of a chunk without reading
+    // its raw data, e.g. from a json shadow column, and fills res and
+    // valid_res of exactly size rows. Returns false to use the row wise func.
+    using ChunkFunc = std::function<bool(int64_t chunk_id,
+                                         int64_t data_pos,
+                                         int64_t size,
+                                         TargetBitmapView res,
+                                         TargetBitmapView valid_res)>;
+
     // If process_all_chunks is true, all chunks will be processed and no inner state will be changed.
     template <typename T, typename FUNC, typename... ValTypes>
     int64_t
@@ -686,16 +842,29 @@ class SegmentExpr : public Expr {
         TargetBitmapView res,
         TargetBitmapView valid_res,
         bool process_all_chunks,
+        const ChunkFunc& chunk_func,
         ValTypes... values) {
         int64_t processed_size = 0;
 
         size_t start_chunk = process_all_chunks ? 0 : current_data_chunk_;
 
+        // the batched scan keeps its read ahead across batches.
+        DataReadAhead all_chunks_read_ahead;
+        DataReadAhead* read_ahead = &data_read_ahead_;
+        if (process_all_chunks) {
+            all_chunks_read_ahead = MakeDataReadAhead(0, skip_func);
+            read_ahead = &all_chunks_read_ahead;
+        } else if (!data_read_ahead_initialized_) {
+            data_read_ahead_ = MakeDataReadAhead(start_chunk, skip_func);
+            data_read_ahead_initialized_ = true;
+        }
+
         for (size_t i = start_chunk; i < num_data_chunk_; i++) {
             auto data_pos =
                 process_all_chunks
                     ? 0
                     : (i == current_data_chunk_ ? current_data_chunk_pos_ : 0);
+            read_ahead->Advance(i);
 
             // if segment is chunked, type won't be growing
             int64_t size = segment_->chunk_size(field_id_, i) - data_pos;
@@ -707,13 +876,20 @@ class SegmentExpr : public Expr {
             if (size == 0)
                 continue;  //do not go empty-loop at the bound of the chunk
 
-            auto& skip_index = segment_->GetSkipIndex();
-            if (!skip_func || !skip_func(skip_index, field_id_, i)) {
+            if (!SkipChunk(skip_func, i)) {
+                bool evaluated =
+                    chunk_func && chunk_func(i,
+                                             data_pos,
+                                             size,
+                                             res.view(processed_size, size),
+                                             valid_res.view(processed_size,
+                                                            size));
                 bool is_seal = false;
                 if constexpr (std::is_same_v<T, std::string_view> ||
                               std::is_same_v<T, Json> ||
                               std::is_same_v<T, ArrayView>) {
-                    if (segment_->type() == SegmentType::Sealed) {
+                    if (!evaluated &&
+                        segment_->type() == SegmentType::Sealed) {
                         // first is the raw data, second is valid_data
                         // use valid_data to see if raw data is null
                         auto pw = segment_->get_batch_views<T>(
@@ -730,7 +906,7 @@ class SegmentExpr : public Expr {
                         is_seal = true;
                     }
                 }
-                if (!is_seal) {
+                if (!is_seal && !evaluated) {
                     auto pw = segment_->chunk_data<T>(field_id_, i);
                     auto chunk = pw.get();
                     const T* data = chunk.data() + data_pos;
@@ -749,7 +925,8 @@ class SegmentExpr : public Expr {
             } else {
                 const bool* valid_data;
                 if constexpr (std::is_same_v<T, std::string_view> ||
-                              std::is_same_v<T, Json>) {
+                              std::is_same_v<T, Json> ||
+                              std::is_same_v<T, ArrayView>) {
                     auto pw = segment_->get_batch_views<T>(
                         field_id_, i, data_pos, size);
                     valid_data = pw.get().second.data();
@@ -792,7 +969,7 @@ class SegmentExpr : public Expr {
         TargetBitmapView valid_res,
         ValTypes... values) {
         return ProcessMultipleChunksCommon<T>(
-            func, skip_func, res, valid_res, false, values...);
+            func, skip_func, res, valid_res, false, nullptr, values...);
     }
 
     template <typename T, typename FUNC, typename... ValTypes>
@@ -804,7 +981,7 @@ class SegmentExpr : public Expr {
         TargetBitmapView valid_res,
         ValTypes... values) {
         return ProcessMultipleChunksCommon<T>(
-            func, skip_func, res, valid_res, true, values...);
+            func, skip_func, res, valid_res, true, nullptr, values...);
     }
 
     template <typename T, typename FUNC, typename... ValTypes>
@@ -824,6 +1001,26 @@ class SegmentExpr : public Expr {
         }
     }
 
+    // ProcessDataChunks for json columns, chunk_func is tried on every chunk
+    // of a chunked segment before the rows are parsed.
+    template <typename FUNC, typename... ValTypes>
+    int64_t
+    ProcessJsonDataChunks(
+        FUNC func,
+        std::function<bool(const milvus::SkipIndex&, FieldId, int)> skip_func,
+        const ChunkFunc& chunk_func,
+        TargetBitmapView res,
+        TargetBitmapView valid_res,
+        ValTypes... values) {
+        if (segment_->is_chunked()) {
+            return ProcessMultipleChunksCommon<milvus::Json>(
+                func, skip_func, res, valid_res, false, chunk_func, values...);
+        } else {
+            return ProcessDataChunksForSingleChunk<milvus::Json>(
+                func, skip_func, res, valid_res, values...);
+        }
+    }
+
     template <typename T, typename FUNC, typename... ValTypes>
     int64_t
     ProcessAllDataChunk(
@@ -850,7 +1047,7 @@ class SegmentExpr : public Expr {
         auto data_pos =
             chunk_id == current_index_chunk_ ? current_index_chunk_pos_ : 0;
         auto size = std::min(
-            std::min(size_per_chunk_ - data_pos, batch_size_ - processed_rows),
+            std::min(IndexChunkRows() - data_pos, batch_size_ - processed_rows),
             int64_t(chunk_res.size()));
 
         //        result.insert(result.end(),
@@ -938,6 +1135,66 @@ class SegmentExpr : public Expr {
                                               std::move(valid_result));
     }
 
+    // Same as ProcessIndexChunks, but if the index can answer for a row
+    // window, window_func(index, offset, res, values...) evaluates only the
+    // current batch into res instead of caching a result for the whole
+    // chunk. Falls back to ProcessIndexChunks with func otherwise.
+    template <typename T,
+              typename FUNC,
+              typename WINDOW_FUNC,
+              typename... ValTypes>
+    VectorPtr
+    ProcessIndexChunksByWindow(FUNC func,
+                               WINDOW_FUNC window_func,
+                               ValTypes... values) {
+        typedef std::
+            conditional_t<std::is_same_v<T, std::string_view>, std::string, T>
+                IndexInnerType;
+        using Index = index::ScalarIndex<IndexInnerType>;
+        if (field_type_ == DataType::JSON ||
+            current_index_chunk_ >= num_index_chunk_) {
+            return ProcessIndexChunks<T>(func, values...);
+        }
+        {
+            auto pw = segment_->chunk_scalar_index<IndexInnerType>(
+                field_id_, current_index_chunk_);
+            if (!pw.get()->SupportWindowQuery()) {
+                return ProcessIndexChunks<T>(func, values...);
+            }
+        }
+
+        TargetBitmap result;
+        TargetBitmap valid_result;
+        int processed_rows = 0;
+        for (size_t i = current_index_chunk_; i < num_index_chunk_; i++) {
+            auto pw = segment_->chunk_scalar_index<IndexInnerType>(field_id_, i);
+            auto index_ptr = const_cast<Index*>(pw.get());
+            auto data_pos =
+                i == current_index_chunk_ ? current_index_chunk_pos_ : 0;
+            auto size = std::min(
+                std::min(IndexChunkRows() - data_pos,
+                         batch_size_ - processed_rows),
+                index_ptr->Count() - data_pos);
+
+            TargetBitmap chunk_res(size);
+            TargetBitmap chunk_valid_res(size);
+            window_func(index_ptr, data_pos, chunk_res.view(), values...);
+            index_ptr->IsNotNullWindow(data_pos, chunk_valid_res.view());
+            result.append(chunk_res);
+            valid_result.append(chunk_valid_res);
+
+            if (processed_rows + size >= batch_size_) {
+                current_index_chunk_ = i;
+                current_index_chunk_pos_ = data_pos + size;
+                break;
+            }
+            processed_rows += size;
+        }
+
+        return std::make_shared<ColumnVector>(std::move(result),
+                                              std::move(valid_result));
+    }
+
     template <typename T>
     TargetBitmap
     ProcessChunksForValid(bool use_index) {
@@ -1065,12 +1322,10 @@ class SegmentExpr : public Expr {
                 }();
                 auto pw = segment_->chunk_data<T>(field_id_, chunk_id);
                 auto chunk = pw.get();
-                const bool* valid_data = chunk.valid_data();
-                if (valid_data != nullptr) {
-                    valid_result[i] = valid_data[chunk_offset];
-                } else {
+                if (!chunk.nullable()) {
                     break;
                 }
+                valid_result[i] = chunk.is_valid(chunk_offset);
             }
         }
         return valid_result;
@@ -1121,15 +1376,22 @@ class SegmentExpr : public Expr {
             if (!access_sealed_variable_column) {
                 auto pw = segment_->chunk_data<T>(field_id_, i);
                 auto chunk = pw.get();
-                const bool* valid_data = chunk.valid_data();
-                if (valid_data == nullptr) {
+                if (!chunk.nullable()) {
                     return valid_result;
                 }
-                valid_data += data_pos;
+                const bool* valid_data = chunk.valid_data();
+                if (valid_data != nullptr) {
+                    valid_data += data_pos;
+                }
                 ApplyValidData(valid_data,
                                valid_result + processed_size,
                                valid_result + processed_size,
                                size);
+                ApplyValidBitmap(chunk,
+                                 data_pos,
+                                 valid_result + processed_size,
+                                 valid_result + processed_size,
+                                 size);
             }
 
             processed_size += size;
@@ -1150,7 +1412,7 @@ class SegmentExpr : public Expr {
         auto data_pos =
             chunk_id == current_index_chunk_ ? current_index_chunk_pos_ : 0;
         auto size = std::min(
-            std::min(size_per_chunk_ - data_pos, batch_size_ - processed_rows),
+            std::min(IndexChunkRows() - data_pos, batch_size_ - processed_rows),
             int64_t(chunk_valid_res.size()));
 
         valid_result.append(chunk_valid_res, data_pos, size);
@@ -1264,6 +1526,10 @@ class SegmentExpr : public Expr {
         using Index = index::ScalarIndex<IndexInnerType>;
         if (op == OpType::Match || op == OpType::InnerMatch ||
             op == OpType::PostfixMatch) {
+            // the interim index would look up every row in the raw data
+            if (is_interim_index_) {
+                return false;
+            }
             auto pw = segment_->chunk_scalar_index<IndexInnerType>(
                 field_id_, current_index_chunk_);
             auto* index_ptr = const_cast<Index*>(pw.get());
@@ -1340,6 +1606,8 @@ class SegmentExpr : public Expr {
     bool allow_any_json_cast_type_{false};
     bool is_json_contains_{false};
     bool is_index_mode_{false};
+    // the index is the interim scalar index of a growing segment
+    bool is_interim_index_{false};
     bool is_data_mode_{false};
     // sometimes need to skip index and using raw data
     // default true means use index as much as possible
@@ -1369,6 +1637,10 @@ class SegmentExpr : public Expr {
 
     // Cache for ngram match.
     std::shared_ptr<TargetBitmap> cached_ngram_match_res_{nullptr};
+
+    // Read ahead of the batched raw data scan on chunked segments.
+    DataReadAhead data_read_ahead_{};
+    bool data_read_ahead_initialized_{false};
 };
 
 bool
@@ -1442,6 +1714,16 @@ class ExprSet {
         return exprs_[index];
     }
 
+    // profiles of the exprs and of their inputs, in pre order
+    std::vector<ExprProfile>
+    Profiles() const {
+        std::vector<ExprProfile> profiles;
+        for (const auto& expr : exprs_) {
+            expr->CollectProfiles(0, profiles);
+        }
+        return profiles;
+    }
+
  private:
     std::vector<std::shared_ptr<Expr>> exprs_;
     ExecContext* exec_ctx_;
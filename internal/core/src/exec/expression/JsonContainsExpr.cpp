@@ -255,18 +255,28 @@ PhyJsonContainsFilterExpr::ExecArrayContains(EvalCtx& context) {
             processed_cursor += size;
         };
 
+    auto sorted_vals =
+        std::dynamic_pointer_cast<SortVectorElement<GetType>>(arg_set_);
+    auto skip_index_func = [sorted_vals](const SkipIndex& skip_index,
+                                         FieldId field_id,
+                                         int64_t chunk_id) {
+        return sorted_vals != nullptr &&
+               skip_index.CanSkipTerm<GetType>(
+                   field_id, chunk_id, sorted_vals->values_);
+    };
+
     int64_t processed_size;
     if (has_offset_input_) {
         processed_size =
             ProcessDataByOffsets<milvus::ArrayView>(execute_sub_batch,
-                                                    std::nullptr_t{},
+                                                    skip_index_func,
                                                     input,
                                                     res,
                                                     valid_res,
                                                     arg_set_);
     } else {
         processed_size = ProcessDataChunks<milvus::ArrayView>(
-            execute_sub_batch, std::nullptr_t{}, res, valid_res, arg_set_);
+            execute_sub_batch, skip_index_func, res, valid_res, arg_set_);
     }
     AssertInfo(processed_size == real_batch_size,
                "internal error: expr processed rows {} not equal "
@@ -772,18 +782,29 @@ PhyJsonContainsFilterExpr::ExecArrayContainsAll(EvalCtx& context) {
             }
             processed_cursor += size;
         };
+
+    // a chunk missing any one of the elements has no row containing all
+    std::vector<GetType> required(elements.begin(), elements.end());
+    auto skip_index_func = [required = std::move(required)](
+                               const SkipIndex& skip_index,
+                               FieldId field_id,
+                               int64_t chunk_id) {
+        return skip_index.CanSkipContainsAll<GetType>(
+            field_id, chunk_id, required);
+    };
+
     int64_t processed_size;
     if (has_offset_input_) {
         processed_size =
             ProcessDataByOffsets<milvus::ArrayView>(execute_sub_batch,
-                                                    std::nullptr_t{},
+                                                    skip_index_func,
                                                     input,
                                                     res,
                                                     valid_res,
                                                     elements);
     } else {
         processed_size = ProcessDataChunks<milvus::ArrayView>(
-            execute_sub_batch, std::nullptr_t{}, res, valid_res, elements);
+            execute_sub_batch, skip_index_func, res, valid_res, elements);
     }
     AssertInfo(processed_size == real_batch_size,
                "internal error: expr processed rows {} not equal "
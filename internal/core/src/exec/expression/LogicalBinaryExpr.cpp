@@ -26,9 +26,9 @@ PhyLogicalBinaryExpr::Eval(EvalCtx& context, VectorPtr& result) {
         "logical binary expr must have 2 inputs, but {} inputs are provided",
         inputs_.size());
     VectorPtr left;
-    inputs_[0]->Eval(context, left);
+    inputs_[0]->ProfiledEval(context, left);
     VectorPtr right;
-    inputs_[1]->Eval(context, right);
+    inputs_[1]->ProfiledEval(context, right);
     auto lflat = GetColumnVector(left);
     auto rflat = GetColumnVector(right);
     auto size = left->size();
@@ -25,7 +25,7 @@ PhyLogicalUnaryExpr::Eval(EvalCtx& context, VectorPtr& result) {
                "logical unary expr must has one input, but now {}",
                inputs_.size());
 
-    inputs_[0]->Eval(context, result);
+    inputs_[0]->ProfiledEval(context, result);
     if (expr_->op_type_ == milvus::expr::LogicalUnaryExpr::OpType::LogicalNot) {
         auto flat_vec = GetColumnVector(result);
         TargetBitmapView data(flat_vec->GetRawData(), flat_vec->size());
@@ -325,18 +325,26 @@ PhyTermFilterExpr::ExecTermArrayVariableInField(EvalCtx& context) {
         processed_cursor += size;
     };
 
+    // ARRAY chunk metrics summarize the elements of all rows
+    auto skip_index_func = [target_val](const SkipIndex& skip_index,
+                                        FieldId field_id,
+                                        int64_t chunk_id) {
+        return skip_index.CanSkipTerm<ValueType>(
+            field_id, chunk_id, std::vector<ValueType>{target_val});
+    };
+
     int64_t processed_size;
     if (has_offset_input_) {
         processed_size =
             ProcessDataByOffsets<milvus::ArrayView>(execute_sub_batch,
-                                                    std::nullptr_t{},
+                                                    skip_index_func,
                                                     input,
                                                     res,
                                                     valid_res,
                                                     target_val);
     } else {
         processed_size = ProcessDataChunks<milvus::ArrayView>(
-            execute_sub_batch, std::nullptr_t{}, res, valid_res, target_val);
+            execute_sub_batch, skip_index_func, res, valid_res, target_val);
     }
     AssertInfo(processed_size == real_batch_size,
                "internal error: expr processed rows {} not equal "
@@ -417,11 +425,22 @@ PhyTermFilterExpr::ExecTermArrayFieldInVariable(EvalCtx& context) {
         processed_cursor += size;
     };
 
+    // the element at index has to be one of the elements of the chunk
+    auto sorted_vals =
+        std::dynamic_pointer_cast<SortVectorElement<ValueType>>(arg_set_);
+    auto skip_index_func = [sorted_vals](const SkipIndex& skip_index,
+                                         FieldId field_id,
+                                         int64_t chunk_id) {
+        return sorted_vals != nullptr &&
+               skip_index.CanSkipTerm<ValueType>(
+                   field_id, chunk_id, sorted_vals->values_);
+    };
+
     int64_t processed_size;
     if (has_offset_input_) {
         processed_size =
             ProcessDataByOffsets<milvus::ArrayView>(execute_sub_batch,
-                                                    std::nullptr_t{},
+                                                    skip_index_func,
                                                     input,
                                                     res,
                                                     valid_res,
@@ -429,7 +448,7 @@ PhyTermFilterExpr::ExecTermArrayFieldInVariable(EvalCtx& context) {
                                                     arg_set_);
     } else {
         processed_size = ProcessDataChunks<milvus::ArrayView>(execute_sub_batch,
-                                                              std::nullptr_t{},
+                                                              skip_index_func,
                                                               res,
                                                               valid_res,
                                                               index,
@@ -877,7 +896,14 @@ PhyTermFilterExpr::ExecVisitorImplForIndex() {
         TermIndexFunc<T> func;
         return func(index_ptr, vals.size(), vals.data());
     };
-    auto res = ProcessIndexChunks<T>(execute_sub_batch, vals);
+    auto execute_window = [](Index* index_ptr,
+                             int64_t offset,
+                             TargetBitmapView res,
+                             const std::vector<IndexInnerType>& vals) {
+        index_ptr->InWindow(vals.size(), vals.data(), offset, res);
+    };
+    auto res =
+        ProcessIndexChunksByWindow<T>(execute_sub_batch, execute_window, vals);
     AssertInfo(res->size() == real_batch_size,
                "internal error: expr processed rows {} not equal "
                "expect batch size {}",
@@ -904,7 +930,14 @@ PhyTermFilterExpr::ExecVisitorImplForIndex<bool>() {
         TermIndexFunc<bool> func;
         return std::move(func(index_ptr, vals.size(), (bool*)vals.data()));
     };
-    auto res = ProcessIndexChunks<bool>(execute_sub_batch, vals);
+    auto execute_window = [](Index* index_ptr,
+                             int64_t offset,
+                             TargetBitmapView res,
+                             const std::vector<uint8_t>& vals) {
+        index_ptr->InWindow(vals.size(), (bool*)vals.data(), offset, res);
+    };
+    auto res = ProcessIndexChunksByWindow<bool>(
+        execute_sub_batch, execute_window, vals);
     return res;
 }
 
@@ -936,7 +969,7 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
                 vals.emplace_back(converted_val);
             }
         }
-        arg_set_ = std::make_shared<SortVectorElement<T>>(vals);
+        arg_set_ = std::make_shared<TermSetElement<T>>(vals);
         arg_inited_ = true;
     }
 
@@ -952,6 +985,7 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
             TargetBitmapView valid_res,
             const std::shared_ptr<MultiElement>& vals) {
         bool has_bitmap_input = !bitmap_input.empty();
+        const auto& term_set = static_cast<const TermSetElement<T>&>(*vals);
         for (size_t i = 0; i < size; ++i) {
             auto offset = i;
             if constexpr (filter_type == FilterType::random) {
@@ -964,21 +998,32 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
             if (has_bitmap_input && !bitmap_input[i + processed_cursor]) {
                 continue;
             }
-            res[i] = vals->In(data[offset]);
+            res[i] = term_set.Contains(data[offset]);
         }
         processed_cursor += size;
     };
+
+    auto sorted_vals =
+        std::dynamic_pointer_cast<SortVectorElement<T>>(arg_set_);
+    auto skip_index_func = [sorted_vals](const SkipIndex& skip_index,
+                                         FieldId field_id,
+                                         int64_t chunk_id) {
+        return sorted_vals != nullptr &&
+               skip_index.CanSkipTerm<T>(
+                   field_id, chunk_id, sorted_vals->values_);
+    };
+
     int64_t processed_size;
     if (has_offset_input_) {
         processed_size = ProcessDataByOffsets<T>(execute_sub_batch,
-                                                 std::nullptr_t{},
+                                                 skip_index_func,
                                                  input,
                                                  res,
                                                  valid_res,
                                                  arg_set_);
     } else {
         processed_size = ProcessDataChunks<T>(
-            execute_sub_batch, std::nullptr_t{}, res, valid_res, arg_set_);
+            execute_sub_batch, skip_index_func, res, valid_res, arg_set_);
     }
     AssertInfo(processed_size == real_batch_size,
                "internal error: expr processed rows {} not equal "
@@ -72,11 +72,30 @@ class PhyTermFilterExpr : public SegmentExpr {
                       consistency_level),
           expr_(expr),
           query_timestamp_(timestamp) {
+        TryUseInterimIndex();
     }
 
     void
     Eval(EvalCtx& context, VectorPtr& result) override;
 
+    void
+    MoveCursor() override {
+        // the pk path reads cached_bits_ by row offset, not by chunk
+        if (is_pk_field_ && !has_offset_input_) {
+            current_data_chunk_pos_ = std::min(
+                active_count_, current_data_chunk_pos_ + batch_size_);
+            return;
+        }
+        SegmentExpr::MoveCursor();
+    }
+
+    // the pk path looks up all the terms in the segment at once
+    bool
+    CachesWholeSegment() const override {
+        return (is_pk_field_ && !has_offset_input_) ||
+               SegmentExpr::CachesWholeSegment();
+    }
+
     bool
     IsSource() const override {
         return true;
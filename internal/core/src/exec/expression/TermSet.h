@@ -0,0 +1,287 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace milvus {
+namespace exec {
+
+// Membership test for the values of an IN list, laid out by list size and
+// value type:
+//  - kLinear: up to a few values scanned without branches, which the
+//    compiler turns into a vectorized compare
+//  - kBitmap: integers spanning a narrow range, one bit per value of the
+//    range
+//  - kHash: open addressing table with linear probing, behind a small bloom
+//    filter so that the rows missing the list, usually most of them, rarely
+//    touch the table
+// Contains(x) matches exactly the values v of the list with v == x.
+template <typename T>
+class TermSet {
+ public:
+    // std::string_view lists point into the plan, the set keeps its own copy
+    using Key = std::
+        conditional_t<std::is_same_v<T, std::string_view>, std::string, T>;
+
+    enum class Kind { kLinear, kBitmap, kHash };
+
+    static constexpr bool kIsString = std::is_same_v<Key, std::string>;
+    static constexpr size_t kLinearMaxSize = kIsString ? 8 : 16;
+    // a bitmap is used while it costs at most 64 bits per value, or 64KB
+    static constexpr uint64_t kBitmapBitsPerValue = 64;
+    static constexpr uint64_t kBitmapMinBits = uint64_t(1) << 19;
+
+    explicit TermSet(const std::vector<T>& values) {
+        std::vector<Key> keys;
+        keys.reserve(values.size());
+        for (const auto& value : values) {
+            if constexpr (std::is_floating_point_v<Key>) {
+                // NaN never equals a row
+                if (std::isnan(value)) {
+                    continue;
+                }
+            }
+            keys.emplace_back(value);
+        }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        size_ = keys.size();
+
+        if (keys.size() <= kLinearMaxSize || std::is_same_v<Key, bool>) {
+            kind_ = Kind::kLinear;
+            linear_ = std::move(keys);
+            return;
+        }
+        if constexpr (std::is_integral_v<Key> && !std::is_same_v<Key, bool>) {
+            auto range = static_cast<uint64_t>(keys.back()) -
+                         static_cast<uint64_t>(keys.front()) + 1;
+            if (range != 0 &&
+                range <= std::max(kBitmapMinBits,
+                                  keys.size() * kBitmapBitsPerValue)) {
+                kind_ = Kind::kBitmap;
+                BuildBitmap(keys, range);
+                return;
+            }
+        }
+        kind_ = Kind::kHash;
+        BuildHash(std::move(keys));
+    }
+
+    Kind
+    kind() const {
+        return kind_;
+    }
+
+    size_t
+    size() const {
+        return size_;
+    }
+
+    template <typename U>
+    bool
+    Contains(const U& value) const {
+        switch (kind_) {
+            case Kind::kLinear:
+                return LinearContains(value);
+            case Kind::kBitmap:
+                return BitmapContains(value);
+            default:
+                return HashContains(value);
+        }
+    }
+
+ private:
+    template <typename U>
+    bool
+    LinearContains(const U& value) const {
+        if constexpr (kIsString) {
+            for (const auto& key : linear_) {
+                if (key == value) {
+                    return true;
+                }
+            }
+            return false;
+        } else {
+            // no early exit, so that the loop vectorizes
+            int found = 0;
+            for (size_t i = 0; i < linear_.size(); ++i) {
+                found |= (linear_[i] == value);
+            }
+            return found != 0;
+        }
+    }
+
+    template <typename U>
+    bool
+    BitmapContains(const U& value) const {
+        if constexpr (std::is_integral_v<Key> && !std::is_same_v<Key, bool>) {
+            auto delta = static_cast<uint64_t>(static_cast<Key>(value)) -
+                         static_cast<uint64_t>(min_);
+            return delta < range_ &&
+                   ((bitmap_[delta >> 6] >> (delta & 63)) & 1);
+        } else {
+            return false;
+        }
+    }
+
+    template <typename U>
+    bool
+    HashContains(const U& value) const {
+        auto hash = Hash(value);
+        auto bloom_a = hash & bloom_mask_;
+        auto bloom_b = (hash >> 32) & bloom_mask_;
+        if (!((bloom_[bloom_a >> 6] >> (bloom_a & 63)) & 1) ||
+            !((bloom_[bloom_b >> 6] >> (bloom_b & 63)) & 1)) {
+            return false;
+        }
+        for (auto i = hash & slot_mask_;; i = (i + 1) & slot_mask_) {
+            const auto& slot = slots_[i];
+            if (!slot.used_) {
+                return false;
+            }
+            if constexpr (kIsString) {
+                if (slot.hash_ == hash && keys_[slot.index_] == value) {
+                    return true;
+                }
+            } else {
+                if (slot.key_ == value) {
+                    return true;
+                }
+            }
+        }
+    }
+
+    template <typename U>
+    static uint64_t
+    Hash(const U& value) {
+        uint64_t h;
+        if constexpr (kIsString) {
+            h = std::hash<std::string_view>{}(std::string_view(value));
+        } else if constexpr (std::is_floating_point_v<Key>) {
+            // -0.0 == 0.0 must land in the same slot
+            auto key = static_cast<Key>(value);
+            if (key == 0) {
+                key = 0;
+            }
+            if constexpr (sizeof(Key) == sizeof(uint32_t)) {
+                uint32_t bits;
+                std::memcpy(&bits, &key, sizeof(bits));
+                h = bits;
+            } else {
+                std::memcpy(&h, &key, sizeof(h));
+            }
+        } else {
+            h = static_cast<uint64_t>(static_cast<Key>(value));
+        }
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    void
+    BuildBitmap(const std::vector<Key>& keys, uint64_t range) {
+        min_ = keys.front();
+        range_ = range;
+        bitmap_.assign((range + 63) / 64, 0);
+        for (const auto& key : keys) {
+            auto delta =
+                static_cast<uint64_t>(key) - static_cast<uint64_t>(min_);
+            bitmap_[delta >> 6] |= uint64_t(1) << (delta & 63);
+        }
+    }
+
+    void
+    BuildHash(std::vector<Key> keys) {
+        // load factor at most 1/2, about 8 bloom bits per value
+        size_t capacity = 16;
+        while (capacity < keys.size() * 2) {
+            capacity <<= 1;
+        }
+        slots_.assign(capacity, Slot{});
+        slot_mask_ = capacity - 1;
+        size_t bloom_bits = 512;
+        while (bloom_bits < keys.size() * 8) {
+            bloom_bits <<= 1;
+        }
+        bloom_.assign(bloom_bits / 64, 0);
+        bloom_mask_ = bloom_bits - 1;
+
+        for (size_t index = 0; index < keys.size(); ++index) {
+            auto hash = Hash(keys[index]);
+            auto bloom_a = hash & bloom_mask_;
+            auto bloom_b = (hash >> 32) & bloom_mask_;
+            bloom_[bloom_a >> 6] |= uint64_t(1) << (bloom_a & 63);
+            bloom_[bloom_b >> 6] |= uint64_t(1) << (bloom_b & 63);
+            auto i = hash & slot_mask_;
+            while (slots_[i].used_) {
+                i = (i + 1) & slot_mask_;
+            }
+            auto& slot = slots_[i];
+            slot.used_ = true;
+            if constexpr (kIsString) {
+                slot.hash_ = hash;
+                slot.index_ = index;
+            } else {
+                slot.key_ = keys[index];
+            }
+        }
+        if constexpr (kIsString) {
+            keys_ = std::move(keys);
+        }
+    }
+
+    struct StringSlot {
+        bool used_{false};
+        uint64_t hash_{0};
+        size_t index_{0};
+    };
+    struct ValueSlot {
+        bool used_{false};
+        Key key_{};
+    };
+    using Slot = std::conditional_t<kIsString, StringSlot, ValueSlot>;
+
+    Kind kind_{Kind::kLinear};
+    size_t size_{0};
+    // kLinear
+    std::vector<Key> linear_;
+    // kBitmap
+    Key min_{};
+    uint64_t range_{0};
+    std::vector<uint64_t> bitmap_;
+    // kHash, string keys live in keys_ and slots index them
+    std::vector<Slot> slots_;
+    uint64_t slot_mask_{0};
+    std::vector<uint64_t> bloom_;
+    uint64_t bloom_mask_{0};
+    std::vector<Key> keys_;
+};
+
+}  // namespace exec
+}  // namespace milvus
@@ -25,6 +25,30 @@
 #include <boost/regex.hpp>
 namespace milvus {
 namespace exec {
+
+namespace {
+// the bitset kernel op of a plain comparison
+std::optional<milvus::bitset::CompareOpType>
+ToCompareOpType(proto::plan::OpType op_type) {
+    switch (op_type) {
+        case proto::plan::GreaterThan:
+            return milvus::bitset::CompareOpType::GT;
+        case proto::plan::GreaterEqual:
+            return milvus::bitset::CompareOpType::GE;
+        case proto::plan::LessThan:
+            return milvus::bitset::CompareOpType::LT;
+        case proto::plan::LessEqual:
+            return milvus::bitset::CompareOpType::LE;
+        case proto::plan::Equal:
+            return milvus::bitset::CompareOpType::EQ;
+        case proto::plan::NotEqual:
+            return milvus::bitset::CompareOpType::NE;
+        default:
+            return std::nullopt;
+    }
+}
+}  // namespace
+
 template <typename T>
 bool
 PhyUnaryRangeFilterExpr::CanUseIndexForArray() {
@@ -925,14 +949,56 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
         }
         processed_cursor += size;
     };
+
+    auto skip_index_func = [pointer, op_type, val](const SkipIndex& skip_index,
+                                                   FieldId field_id,
+                                                   int64_t chunk_id) {
+        return skip_index.CanSkipJsonUnaryRange<ExprValueType>(
+            field_id, chunk_id, pointer, op_type, val);
+    };
+
+    // chunks sealed with a shadow column of the path are compared with the
+    // bitset kernels instead of parsing every row
+    ChunkFunc shadow_func = nullptr;
+    if constexpr (!std::is_same_v<ExprValueType, proto::plan::Array>) {
+        auto compare_op = ToCompareOpType(op_type);
+        if (compare_op.has_value()) {
+            shadow_func = [this,
+                           field_id,
+                           pointer,
+                           compare_op = compare_op.value(),
+                           val,
+                           &processed_cursor](int64_t chunk_id,
+                                              int64_t data_pos,
+                                              int64_t size,
+                                              TargetBitmapView res,
+                                              TargetBitmapView valid_res) {
+                auto pw =
+                    segment_->GetJsonShadowColumn(field_id, chunk_id, pointer);
+                auto shadow = pw.get();
+                if (shadow == nullptr) {
+                    return false;
+                }
+                shadow->Compare<ExprValueType>(
+                    compare_op, val, data_pos, size, res, valid_res);
+                processed_cursor += size;
+                return true;
+            };
+        }
+    }
+
     int64_t processed_size;
     if (has_offset_input_) {
         processed_size = ProcessDataByOffsets<milvus::Json>(
-            execute_sub_batch, std::nullptr_t{}, input, res, valid_res, val);
+            execute_sub_batch, skip_index_func, input, res, valid_res, val);
 
     } else {
-        processed_size = ProcessDataChunks<milvus::Json>(
-            execute_sub_batch, std::nullptr_t{}, res, valid_res, val);
+        processed_size = ProcessJsonDataChunks(execute_sub_batch,
+                                               skip_index_func,
+                                               shadow_func,
+                                               res,
+                                               valid_res,
+                                               val);
     }
     AssertInfo(processed_size == real_batch_size,
                "internal error: expr processed rows {} not equal "
@@ -1583,7 +1649,38 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForIndex() {
         return res;
     };
     IndexInnerType val = value_arg_.GetValue<IndexInnerType>();
-    auto res = ProcessIndexChunks<T>(execute_sub_batch, val);
+    VectorPtr res;
+    switch (op_type) {
+        case proto::plan::GreaterThan:
+        case proto::plan::GreaterEqual:
+        case proto::plan::LessThan:
+        case proto::plan::LessEqual:
+        case proto::plan::Equal:
+        case proto::plan::NotEqual: {
+            auto execute_window = [op_type](Index* index_ptr,
+                                            int64_t offset,
+                                            TargetBitmapView res,
+                                            IndexInnerType val) {
+                switch (op_type) {
+                    case proto::plan::Equal:
+                        index_ptr->InWindow(1, &val, offset, res);
+                        break;
+                    case proto::plan::NotEqual:
+                        index_ptr->NotInWindow(1, &val, offset, res);
+                        break;
+                    default:
+                        index_ptr->RangeWindow(val, op_type, offset, res);
+                        break;
+                }
+            };
+            res = ProcessIndexChunksByWindow<T>(
+                execute_sub_batch, execute_window, val);
+            break;
+        }
+        default:
+            res = ProcessIndexChunks<T>(execute_sub_batch, val);
+            break;
+    }
     AssertInfo(res->size() == real_batch_size,
                "internal error: expr processed rows {} not equal "
                "expect batch size {}",
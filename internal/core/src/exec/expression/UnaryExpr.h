@@ -405,6 +405,7 @@ class PhyUnaryRangeFilterExpr : public SegmentExpr {
                       batch_size,
                       consistency_level),
           expr_(expr) {
+        TryUseInterimIndex();
     }
 
     void
@@ -419,6 +420,14 @@ class PhyUnaryRangeFilterExpr : public SegmentExpr {
         return true;
     }
 
+    // text matches query the text index for the whole segment at once
+    bool
+    CachesWholeSegment() const override {
+        return expr_->op_type_ == proto::plan::OpType::TextMatch ||
+               expr_->op_type_ == proto::plan::OpType::PhraseMatch ||
+               SegmentExpr::CachesWholeSegment();
+    }
+
     std::string
     ToString() const {
         return fmt::format("{}", expr_->ToString());
@@ -16,10 +16,45 @@
 
 #include "FilterBitsNode.h"
 
+#include <algorithm>
+#include <atomic>
+
+#include "common/Utils.h"
+#include "futures/Executor.h"
+#include "futures/ParallelFor.h"
 #include "monitor/prometheus_client.h"
 
 namespace milvus {
 namespace exec {
+
+namespace {
+// batches per morsel, the unit of rows a driver claims at a time
+constexpr int64_t kMorselBatches = 4;
+
+bool
+CachesWholeSegment(const std::shared_ptr<Expr>& expr) {
+    if (auto segment_expr = std::dynamic_pointer_cast<SegmentExpr>(expr)) {
+        if (segment_expr->CachesWholeSegment()) {
+            return true;
+        }
+    }
+    for (const auto& input : expr->GetInputsRef()) {
+        if (CachesWholeSegment(input)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// One driver of a parallel filter, with its own compiled exprs and thus its
+// own cursors.
+struct FilterDriver {
+    std::unique_ptr<ExprSet> exprs_;
+    // batches the cursors of exprs_ have passed
+    int64_t next_batch_{0};
+};
+}  // namespace
+
 PhyFilterBitsNode::PhyFilterBitsNode(
     int32_t operator_id,
     DriverContext* driverctx,
@@ -31,9 +66,8 @@ PhyFilterBitsNode::PhyFilterBitsNode(
                "PhyFilterBitsNode") {
     ExecContext* exec_context = operator_context_->get_exec_context();
     query_context_ = exec_context->get_query_context();
-    std::vector<expr::TypedExprPtr> filters;
-    filters.emplace_back(filter->filter());
-    exprs_ = std::make_unique<ExprSet>(filters, exec_context);
+    filters_.emplace_back(filter->filter());
+    exprs_ = std::make_unique<ExprSet>(filters_, exec_context);
     need_process_rows_ = query_context_->get_active_count();
     num_processed_rows_ = 0;
 }
@@ -57,6 +91,136 @@ PhyFilterBitsNode::IsFinished() {
     return AllInputProcessed();
 }
 
+int64_t
+PhyFilterBitsNode::EvalBatch(ExprSet& exprs,
+                             EvalCtx& eval_ctx,
+                             std::vector<VectorPtr>& results,
+                             TargetBitmap& bitset,
+                             TargetBitmap& valid_bitset) {
+    exprs.Eval(0, 1, true, eval_ctx, results);
+
+    AssertInfo(results.size() == 1 && results[0] != nullptr,
+               "PhyFilterBitsNode result size should be size one and not "
+               "be nullptr");
+
+    if (auto col_vec = std::dynamic_pointer_cast<ColumnVector>(results[0])) {
+        if (col_vec->IsBitmap()) {
+            auto col_vec_size = col_vec->size();
+            TargetBitmapView view(col_vec->GetRawData(), col_vec_size);
+            bitset.append(view);
+            TargetBitmapView valid_view(col_vec->GetValidRawData(),
+                                        col_vec_size);
+            valid_bitset.append(valid_view);
+            return col_vec_size;
+        } else {
+            PanicInfo(ExprInvalid, "PhyFilterBitsNode result should be bitmap");
+        }
+    } else {
+        PanicInfo(ExprInvalid,
+                  "PhyFilterBitsNode result should be ColumnVector");
+    }
+}
+
+int64_t
+PhyFilterBitsNode::Parallelism(int64_t batch_size) const {
+    auto budget =
+        query_context_->query_config()->get_expr_eval_max_parallelism();
+    auto num_morsels =
+        upper_div(need_process_rows_ - num_processed_rows_,
+                  batch_size * kMorselBatches);
+    auto parallelism = std::min(budget, num_morsels);
+    if (parallelism <= 1) {
+        return 1;
+    }
+    // index, pk term and text match exprs evaluate the whole segment at
+    // once, every driver would repeat the lookup
+    for (const auto& expr : exprs_->exprs()) {
+        if (CachesWholeSegment(expr)) {
+            return 1;
+        }
+    }
+    return parallelism;
+}
+
+// Splits the rows into morsels of kMorselBatches batches. Each driver claims
+// the next morsel from a shared counter, so it only moves forward: it skips
+// the batches of morsels taken by others with MoveCursor and evaluates its
+// own with a private EvalCtx. The drivers run through futures::ParallelFor,
+// the per-morsel bitsets are stitched in row order afterwards.
+void
+PhyFilterBitsNode::EvalInParallel(int64_t parallelism,
+                                  int64_t batch_size,
+                                  TargetBitmap& bitset,
+                                  TargetBitmap& valid_bitset) {
+    auto exec_context = operator_context_->get_exec_context();
+    auto morsel_rows = batch_size * kMorselBatches;
+    auto num_morsels = upper_div(need_process_rows_, morsel_rows);
+    std::vector<TargetBitmap> morsel_bitsets(num_morsels);
+    std::vector<TargetBitmap> morsel_valid_bitsets(num_morsels);
+    std::atomic<int64_t> next_morsel{0};
+
+    // compiled up front by this thread, workers only evaluate
+    std::vector<FilterDriver> drivers(parallelism);
+    for (auto& driver : drivers) {
+        driver.exprs_ = std::make_unique<ExprSet>(filters_, exec_context);
+    }
+
+    auto run = [&](int64_t i) {
+        auto& driver = drivers[i];
+        EvalCtx eval_ctx(exec_context, driver.exprs_.get());
+        std::vector<VectorPtr> results;
+        for (auto morsel = next_morsel.fetch_add(1); morsel < num_morsels;
+             morsel = next_morsel.fetch_add(1)) {
+            for (; driver.next_batch_ < morsel * kMorselBatches;
+                 ++driver.next_batch_) {
+                for (const auto& expr : driver.exprs_->exprs()) {
+                    expr->MoveCursor();
+                }
+            }
+            auto rows = std::min(morsel_rows,
+                                 need_process_rows_ - morsel * morsel_rows);
+            int64_t processed = 0;
+            while (processed < rows) {
+                processed += EvalBatch(*driver.exprs_,
+                                       eval_ctx,
+                                       results,
+                                       morsel_bitsets[morsel],
+                                       morsel_valid_bitsets[morsel]);
+                driver.next_batch_++;
+            }
+            AssertInfo(processed == rows,
+                       "morsel {} evaluated {} rows, expected {}",
+                       morsel,
+                       processed,
+                       rows);
+        }
+    };
+    milvus::futures::ParallelFor(
+        milvus::futures::getGlobalCPUExecutor(), parallelism, run);
+    if (query_context_->profile()) {
+        for (auto& driver : drivers) {
+            MergeExprProfiles(parallel_expr_profiles_,
+                              driver.exprs_->Profiles());
+        }
+    }
+
+    bitset.reserve(need_process_rows_);
+    valid_bitset.reserve(need_process_rows_);
+    for (int64_t i = 0; i < num_morsels; ++i) {
+        bitset.append(morsel_bitsets[i]);
+        valid_bitset.append(morsel_valid_bitsets[i]);
+    }
+    num_processed_rows_ = need_process_rows_;
+}
+
+OperatorProfile
+PhyFilterBitsNode::Profile() const {
+    auto profile = Operator::Profile();
+    profile.exprs_ = exprs_->Profiles();
+    MergeExprProfiles(profile.exprs_, parallel_expr_profiles_);
+    return profile;
+}
+
 RowVectorPtr
 PhyFilterBitsNode::GetOutput() {
     if (AllInputProcessed()) {
@@ -66,34 +230,17 @@ PhyFilterBitsNode::GetOutput() {
     std::chrono::high_resolution_clock::time_point scalar_start =
         std::chrono::high_resolution_clock::now();
 
-    EvalCtx eval_ctx(operator_context_->get_exec_context(), exprs_.get());
-
     TargetBitmap bitset;
     TargetBitmap valid_bitset;
-    while (num_processed_rows_ < need_process_rows_) {
-        exprs_->Eval(0, 1, true, eval_ctx, results_);
-
-        AssertInfo(results_.size() == 1 && results_[0] != nullptr,
-                   "PhyFilterBitsNode result size should be size one and not "
-                   "be nullptr");
-
-        if (auto col_vec =
-                std::dynamic_pointer_cast<ColumnVector>(results_[0])) {
-            if (col_vec->IsBitmap()) {
-                auto col_vec_size = col_vec->size();
-                TargetBitmapView view(col_vec->GetRawData(), col_vec_size);
-                bitset.append(view);
-                TargetBitmapView valid_view(col_vec->GetValidRawData(),
-                                            col_vec_size);
-                valid_bitset.append(valid_view);
-                num_processed_rows_ += col_vec_size;
-            } else {
-                PanicInfo(ExprInvalid,
-                          "PhyFilterBitsNode result should be bitmap");
-            }
-        } else {
-            PanicInfo(ExprInvalid,
-                      "PhyFilterBitsNode result should be ColumnVector");
+    auto batch_size = query_context_->query_config()->get_expr_batch_size();
+    auto parallelism = num_processed_rows_ == 0 ? Parallelism(batch_size) : 1;
+    if (parallelism > 1) {
+        EvalInParallel(parallelism, batch_size, bitset, valid_bitset);
+    } else {
+        EvalCtx eval_ctx(operator_context_->get_exec_context(), exprs_.get());
+        while (num_processed_rows_ < need_process_rows_) {
+            num_processed_rows_ += EvalBatch(
+                *exprs_, eval_ctx, results_, bitset, valid_bitset);
         }
     }
     bitset.flip();
@@ -58,6 +58,9 @@ class PhyFilterBitsNode : public Operator {
         exprs_->Clear();
     }
 
+    OperatorProfile
+    Profile() const override;
+
     BlockingReason
     IsBlocked(ContinueFuture* /* unused */) override {
         return BlockingReason::kNotBlocked;
@@ -72,7 +75,29 @@ class PhyFilterBitsNode : public Operator {
     }
 
  private:
+    // appends the result of the next batch of exprs to bitset
+    int64_t
+    EvalBatch(ExprSet& exprs,
+              EvalCtx& eval_ctx,
+              std::vector<VectorPtr>& results,
+              TargetBitmap& bitset,
+              TargetBitmap& valid_bitset);
+
+    // number of drivers for the filter, 1 to evaluate it sequentially
+    int64_t
+    Parallelism(int64_t batch_size) const;
+
+    void
+    EvalInParallel(int64_t parallelism,
+                   int64_t batch_size,
+                   TargetBitmap& bitset,
+                   TargetBitmap& valid_bitset);
+
+ private:
+    std::vector<expr::TypedExprPtr> filters_;
     std::unique_ptr<ExprSet> exprs_;
+    // merged from the drivers of EvalInParallel when profiled
+    std::vector<ExprProfile> parallel_expr_profiles_;
     QueryContext* query_context_;
     int64_t num_processed_rows_;
     int64_t need_process_rows_;
@@ -53,6 +53,13 @@ PhyIterativeFilterNode::IsFinished() {
     return is_finished_;
 }
 
+OperatorProfile
+PhyIterativeFilterNode::Profile() const {
+    auto profile = Operator::Profile();
+    profile.exprs_ = exprs_->Profiles();
+    return profile;
+}
+
 template <bool large_is_better>
 inline size_t
 find_binsert_position(const std::vector<float>& distances,
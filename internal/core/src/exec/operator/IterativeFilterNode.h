@@ -61,6 +61,9 @@ class PhyIterativeFilterNode : public Operator {
         exprs_->Clear();
     }
 
+    OperatorProfile
+    Profile() const override;
+
     BlockingReason
     IsBlocked(ContinueFuture* /* unused */) override {
         return BlockingReason::kNotBlocked;
@@ -26,6 +26,7 @@
 #include "exec/Driver.h"
 #include "exec/Task.h"
 #include "exec/QueryContext.h"
+#include "exec/QueryProfile.h"
 #include "plan/PlanNode.h"
 
 namespace milvus {
@@ -158,6 +159,23 @@ class Operator {
         return "Base Operator";
     }
 
+    // filled by the driver when the query is profiled
+    OperatorStats&
+    stats() {
+        return stats_;
+    }
+
+    // called by the driver before Close
+    virtual OperatorProfile
+    Profile() const {
+        OperatorProfile profile;
+        profile.type_ = get_operator_type();
+        profile.plannode_id_ = get_plannode_id();
+        profile.operator_id_ = get_operator_id();
+        profile.stats_ = stats_;
+        return profile;
+    }
+
  protected:
     std::unique_ptr<OperatorContext> operator_context_;
 
@@ -168,6 +186,8 @@ class Operator {
     bool no_more_input_{false};
 
     std::vector<VectorPtr> results_;
+
+    OperatorStats stats_;
 };
 
 class SourceOperator : public Operator {
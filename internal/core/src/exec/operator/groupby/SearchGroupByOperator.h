@@ -122,7 +122,7 @@ class SealedDataGetter : public DataGetter<T> {
             } else {
                 auto pw = segment_.chunk_data<T>(field_id_, chunk_id);
                 auto& span = pw.get();
-                if (span.valid_data() && !span.valid_data()[inner_offset]) {
+                if (!span.is_valid(inner_offset)) {
                     return std::nullopt;
                 }
                 auto raw = span.operator[](inner_offset);
@@ -28,4 +28,12 @@ getGlobalCPUExecutor() {
     return &executor;
 }
 
+folly::CPUThreadPoolExecutor*
+getGlobalIOExecutor() {
+    auto thread_num = std::thread::hardware_concurrency();
+    static folly::CPUThreadPoolExecutor executor(
+        thread_num, std::make_shared<folly::NamedThreadFactory>("MILVUS_IO_"));
+    return &executor;
+}
+
 };  // namespace milvus::futures
\ No newline at end of file
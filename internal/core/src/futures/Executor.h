@@ -27,4 +27,10 @@ const int HIGH = 0;
 folly::CPUThreadPoolExecutor*
 getGlobalCPUExecutor();
 
+// For tasks that block on I/O, e.g. pinning cache cells that may be loaded
+// from remote storage, so that they do not hold the threads of the CPU
+// executor.
+folly::CPUThreadPoolExecutor*
+getGlobalIOExecutor();
+
 };  // namespace milvus::futures
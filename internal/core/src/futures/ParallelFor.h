@@ -0,0 +1,89 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <vector>
+
+#include <folly/ExceptionWrapper.h>
+#include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/synchronization/Baton.h>
+
+#include "futures/Executor.h"
+
+namespace milvus::futures {
+
+namespace detail {
+// A worker of ParallelFor, run by whichever thread claims it first.
+struct ParallelWorker {
+    std::atomic<bool> claimed_{false};
+    folly::Baton<> done_;
+    folly::exception_wrapper error_;
+};
+}  // namespace detail
+
+// Runs fn(worker) for every worker in [0, parallelism). Workers from 1 on
+// are queued on the executor, while the calling thread runs worker 0 and
+// then every worker no executor thread has claimed yet. So the caller never
+// waits on a queued task, and makes progress even if the executor is
+// saturated, e.g. by callers that are its own threads. Returns once all the
+// workers are done, and rethrows the first exception in worker order.
+template <typename Fn>
+void
+ParallelFor(folly::CPUThreadPoolExecutor* executor,
+            int64_t parallelism,
+            const Fn& fn,
+            int8_t priority = ExecutePriority::HIGH) {
+    // the queued tasks may outlive this call, they only touch the workers
+    auto workers =
+        std::make_shared<std::vector<detail::ParallelWorker>>(parallelism);
+    // only invoked by the thread that claimed the worker, and the caller
+    // waits for all of them, so fn is still alive.
+    auto run = [&fn](detail::ParallelWorker& worker, int64_t i) {
+        try {
+            fn(i);
+        } catch (...) {
+            worker.error_ = folly::exception_wrapper(std::current_exception());
+        }
+        worker.done_.post();
+    };
+
+    for (int64_t i = 1; i < parallelism; ++i) {
+        executor->addWithPriority(
+            [workers, i, run]() {
+                auto& worker = (*workers)[i];
+                if (!worker.claimed_.exchange(true)) {
+                    run(worker, i);
+                }
+            },
+            priority);
+    }
+    for (int64_t i = 0; i < parallelism; ++i) {
+        auto& worker = (*workers)[i];
+        if (!worker.claimed_.exchange(true)) {
+            run(worker, i);
+        }
+    }
+    for (auto& worker : *workers) {
+        worker.done_.wait();
+    }
+    for (auto& worker : *workers) {
+        if (worker.error_) {
+            worker.error_.throw_exception();
+        }
+    }
+}
+
+}  // namespace milvus::futures
@@ -1071,6 +1071,181 @@ BitmapIndex<T>::RangeForRoaring(const T lower_value,
     return res;
 }
 
+namespace {
+// Or the rows of one value's bitmap that fall into the window into res;
+// window holds [offset, offset + res.size()).
+void
+OrWindow(const roaring::Roaring& rows,
+         const roaring::Roaring& window,
+         int64_t offset,
+         TargetBitmapView res) {
+    for (const auto& v : rows & window) {
+        res.set(v - offset);
+    }
+}
+
+void
+OrWindow(const TargetBitmap& rows,
+         const roaring::Roaring& window,
+         int64_t offset,
+         TargetBitmapView res) {
+    res.inplace_or(rows.view(offset, res.size()), res.size());
+}
+
+template <typename Map, typename T>
+std::pair<typename Map::const_iterator, typename Map::const_iterator>
+MapRange(const Map& bitmaps, const T& value, OpType op) {
+    auto lb = bitmaps.begin();
+    auto ub = bitmaps.end();
+    switch (op) {
+        case OpType::LessThan:
+            ub = bitmaps.lower_bound(value);
+            break;
+        case OpType::LessEqual:
+            ub = bitmaps.upper_bound(value);
+            break;
+        case OpType::GreaterThan:
+            lb = bitmaps.upper_bound(value);
+            break;
+        case OpType::GreaterEqual:
+            lb = bitmaps.lower_bound(value);
+            break;
+        default:
+            PanicInfo(OpTypeInvalid,
+                      fmt::format("Invalid OperatorType: {}", op));
+    }
+    return {lb, ub};
+}
+
+template <typename Map, typename T>
+std::pair<typename Map::const_iterator, typename Map::const_iterator>
+MapRange(const Map& bitmaps,
+         const T& lower_value,
+         bool lb_inclusive,
+         const T& upper_value,
+         bool ub_inclusive) {
+    auto lb = lb_inclusive ? bitmaps.lower_bound(lower_value)
+                           : bitmaps.upper_bound(lower_value);
+    auto ub = ub_inclusive ? bitmaps.upper_bound(upper_value)
+                           : bitmaps.lower_bound(upper_value);
+    return {lb, ub};
+}
+
+roaring::Roaring
+WindowRows(int64_t offset, size_t size) {
+    roaring::Roaring window;
+    window.addRange(offset, offset + size);
+    return window;
+}
+}  // namespace
+
+template <typename T>
+template <typename Fn>
+void
+BitmapIndex<T>::VisitBitmaps(Fn&& fn) {
+    if (is_mmap_) {
+        fn(bitmap_info_map_);
+    } else if (build_mode_ == BitmapIndexBuildMode::ROARING) {
+        fn(data_);
+    } else {
+        fn(bitsets_);
+    }
+}
+
+template <typename T>
+void
+BitmapIndex<T>::PrepareWindow(int64_t offset, TargetBitmapView res) {
+    AssertInfo(is_built_, "index has not been built");
+    AssertInfo(offset >= 0 && offset + res.size() <= total_num_rows_,
+               "window [{}, {}) out of range, num rows: {}",
+               offset,
+               offset + res.size(),
+               total_num_rows_);
+    res.reset();
+}
+
+template <typename T>
+void
+BitmapIndex<T>::InWindow(const size_t n,
+                         const T* values,
+                         int64_t offset,
+                         TargetBitmapView res) {
+    PrepareWindow(offset, res);
+    auto window = WindowRows(offset, res.size());
+    VisitBitmaps([&](const auto& bitmaps) {
+        for (size_t i = 0; i < n; ++i) {
+            auto it = bitmaps.find(values[i]);
+            if (it != bitmaps.end()) {
+                OrWindow(it->second, window, offset, res);
+            }
+        }
+    });
+}
+
+template <typename T>
+void
+BitmapIndex<T>::NotInWindow(const size_t n,
+                            const T* values,
+                            int64_t offset,
+                            TargetBitmapView res) {
+    InWindow(n, values, offset, res);
+    res.flip();
+    // NotIn(null) and In(null) is both false, need to mask with IsNotNull operate
+    res &= valid_bitset_.view(offset, res.size());
+}
+
+template <typename T>
+void
+BitmapIndex<T>::RangeWindow(const T value,
+                            OpType op,
+                            int64_t offset,
+                            TargetBitmapView res) {
+    PrepareWindow(offset, res);
+    if (ShouldSkip(value, value, op)) {
+        return;
+    }
+    auto window = WindowRows(offset, res.size());
+    VisitBitmaps([&](const auto& bitmaps) {
+        auto [lb, ub] = MapRange(bitmaps, value, op);
+        for (; lb != ub; ++lb) {
+            OrWindow(lb->second, window, offset, res);
+        }
+    });
+}
+
+template <typename T>
+void
+BitmapIndex<T>::RangeWindow(const T lower_value,
+                            bool lb_inclusive,
+                            const T upper_value,
+                            bool ub_inclusive,
+                            int64_t offset,
+                            TargetBitmapView res) {
+    PrepareWindow(offset, res);
+    if (lower_value > upper_value ||
+        (lower_value == upper_value && !(lb_inclusive && ub_inclusive))) {
+        return;
+    }
+    if (ShouldSkip(lower_value, upper_value, OpType::Range)) {
+        return;
+    }
+    auto window = WindowRows(offset, res.size());
+    VisitBitmaps([&](const auto& bitmaps) {
+        auto [lb, ub] = MapRange(
+            bitmaps, lower_value, lb_inclusive, upper_value, ub_inclusive);
+        for (; lb != ub; ++lb) {
+            OrWindow(lb->second, window, offset, res);
+        }
+    });
+}
+
+template <typename T>
+void
+BitmapIndex<T>::IsNotNullWindow(int64_t offset, TargetBitmapView res) {
+    PrepareWindow(offset, res);
+    res.inplace_or(valid_bitset_.view(offset, res.size()), res.size());
+}
+
 template <typename T>
 T
 BitmapIndex<T>::Reverse_Lookup_InCache(size_t idx) const {
@@ -105,6 +105,40 @@ class BitmapIndex : public ScalarIndex<T> {
           T upper_bound_value,
           bool ub_inclusive) override;
 
+    bool
+    SupportWindowQuery() const override {
+        return true;
+    }
+
+    void
+    InWindow(size_t n,
+             const T* values,
+             int64_t offset,
+             TargetBitmapView res) override;
+
+    void
+    NotInWindow(size_t n,
+                const T* values,
+                int64_t offset,
+                TargetBitmapView res) override;
+
+    void
+    RangeWindow(T value,
+                OpType op,
+                int64_t offset,
+                TargetBitmapView res) override;
+
+    void
+    RangeWindow(T lower_bound_value,
+                bool lb_inclusive,
+                T upper_bound_value,
+                bool ub_inclusive,
+                int64_t offset,
+                TargetBitmapView res) override;
+
+    void
+    IsNotNullWindow(int64_t offset, TargetBitmapView res) override;
+
     std::optional<T>
     Reverse_Lookup(size_t offset) const override;
 
@@ -248,6 +282,16 @@ class BitmapIndex : public ScalarIndex<T> {
                  T upper_bound_value,
                  bool ub_inclusive);
 
+    // Call fn with whichever value -> rows map serves queries in the
+    // current load mode.
+    template <typename Fn>
+    void
+    VisitBitmaps(Fn&& fn);
+
+    // Reset res and check that it fits into the index at offset.
+    void
+    PrepareWindow(int64_t offset, TargetBitmapView res);
+
     void
     MMapIndexData(const std::string& filepath,
                   const uint8_t* data,
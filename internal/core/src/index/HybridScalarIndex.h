@@ -143,6 +143,55 @@ class HybridScalarIndex : public ScalarIndex<T> {
             lower_bound_value, lb_inclusive, upper_bound_value, ub_inclusive);
     }
 
+    bool
+    SupportWindowQuery() const override {
+        return internal_index_->SupportWindowQuery();
+    }
+
+    void
+    InWindow(size_t n,
+             const T* values,
+             int64_t offset,
+             TargetBitmapView res) override {
+        internal_index_->InWindow(n, values, offset, res);
+    }
+
+    void
+    NotInWindow(size_t n,
+                const T* values,
+                int64_t offset,
+                TargetBitmapView res) override {
+        internal_index_->NotInWindow(n, values, offset, res);
+    }
+
+    void
+    RangeWindow(T value,
+                OpType op,
+                int64_t offset,
+                TargetBitmapView res) override {
+        internal_index_->RangeWindow(value, op, offset, res);
+    }
+
+    void
+    RangeWindow(T lower_bound_value,
+                bool lb_inclusive,
+                T upper_bound_value,
+                bool ub_inclusive,
+                int64_t offset,
+                TargetBitmapView res) override {
+        internal_index_->RangeWindow(lower_bound_value,
+                                     lb_inclusive,
+                                     upper_bound_value,
+                                     ub_inclusive,
+                                     offset,
+                                     res);
+    }
+
+    void
+    IsNotNullWindow(int64_t offset, TargetBitmapView res) override {
+        internal_index_->IsNotNullWindow(offset, res);
+    }
+
     std::optional<T>
     Reverse_Lookup(size_t offset) const override {
         return internal_index_->Reverse_Lookup(offset);
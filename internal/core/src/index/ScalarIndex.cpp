@@ -70,6 +70,68 @@ ScalarIndex<T>::Query(const DatasetPtr& dataset) {
     }
 }
 
+namespace {
+void
+CopyWindow(const TargetBitmap& full, int64_t offset, TargetBitmapView res) {
+    AssertInfo(offset >= 0 && offset + res.size() <= full.size(),
+               "window [{}, {}) out of range, num rows: {}",
+               offset,
+               offset + res.size(),
+               full.size());
+    res.reset();
+    res.inplace_or(full.view(offset, res.size()), res.size());
+}
+}  // namespace
+
+template <typename T>
+void
+ScalarIndex<T>::InWindow(size_t n,
+                         const T* values,
+                         int64_t offset,
+                         TargetBitmapView res) {
+    CopyWindow(In(n, values), offset, res);
+}
+
+template <typename T>
+void
+ScalarIndex<T>::NotInWindow(size_t n,
+                            const T* values,
+                            int64_t offset,
+                            TargetBitmapView res) {
+    CopyWindow(NotIn(n, values), offset, res);
+}
+
+template <typename T>
+void
+ScalarIndex<T>::RangeWindow(T value,
+                            OpType op,
+                            int64_t offset,
+                            TargetBitmapView res) {
+    CopyWindow(Range(value, op), offset, res);
+}
+
+template <typename T>
+void
+ScalarIndex<T>::RangeWindow(T lower_bound_value,
+                            bool lb_inclusive,
+                            T upper_bound_value,
+                            bool ub_inclusive,
+                            int64_t offset,
+                            TargetBitmapView res) {
+    CopyWindow(Range(lower_bound_value,
+                     lb_inclusive,
+                     upper_bound_value,
+                     ub_inclusive),
+               offset,
+               res);
+}
+
+template <typename T>
+void
+ScalarIndex<T>::IsNotNullWindow(int64_t offset, TargetBitmapView res) {
+    CopyWindow(IsNotNull(), offset, res);
+}
+
 template <>
 void
 ScalarIndex<std::string>::BuildWithRawDataForUT(size_t n,
@@ -118,6 +118,39 @@ class ScalarIndex : public IndexBase {
           T upper_bound_value,
           bool ub_inclusive) = 0;
 
+    // Windowed variants of the predicates above: only rows in
+    // [offset, offset + res.size()) are evaluated and the answer is written
+    // into res, so a batched caller never materializes a segment-sized
+    // bitmap. The defaults evaluate the whole segment and copy the window
+    // out; indexes that can do better override them and SupportWindowQuery.
+    virtual bool
+    SupportWindowQuery() const {
+        return false;
+    }
+
+    virtual void
+    InWindow(size_t n, const T* values, int64_t offset, TargetBitmapView res);
+
+    virtual void
+    NotInWindow(size_t n,
+                const T* values,
+                int64_t offset,
+                TargetBitmapView res);
+
+    virtual void
+    RangeWindow(T value, OpType op, int64_t offset, TargetBitmapView res);
+
+    virtual void
+    RangeWindow(T lower_bound_value,
+                bool lb_inclusive,
+                T upper_bound_value,
+                bool ub_inclusive,
+                int64_t offset,
+                TargetBitmapView res);
+
+    virtual void
+    IsNotNullWindow(int64_t offset, TargetBitmapView res);
+
     virtual std::optional<T>
     Reverse_Lookup(size_t offset) const = 0;
 
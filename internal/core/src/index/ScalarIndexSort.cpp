@@ -279,57 +279,54 @@ ScalarIndexSort<T>::IsNotNull() {
 }
 
 template <typename T>
-const TargetBitmap
-ScalarIndexSort<T>::Range(const T value, const OpType op) {
-    AssertInfo(is_built_, "index has not been built");
-    TargetBitmap bitset(Count());
-    auto lb = data_.begin();
-    auto ub = data_.end();
+std::pair<size_t, size_t>
+ScalarIndexSort<T>::RangePositions(const T value, const OpType op) {
+    size_t lb = 0;
+    size_t ub = data_.size();
     if (ShouldSkip(value, value, op)) {
-        return bitset;
+        return {0, 0};
     }
     switch (op) {
         case OpType::LessThan:
             ub = std::lower_bound(
-                data_.begin(), data_.end(), IndexStructure<T>(value));
+                     data_.begin(), data_.end(), IndexStructure<T>(value)) -
+                 data_.begin();
             break;
         case OpType::LessEqual:
             ub = std::upper_bound(
-                data_.begin(), data_.end(), IndexStructure<T>(value));
+                     data_.begin(), data_.end(), IndexStructure<T>(value)) -
+                 data_.begin();
             break;
         case OpType::GreaterThan:
             lb = std::upper_bound(
-                data_.begin(), data_.end(), IndexStructure<T>(value));
+                     data_.begin(), data_.end(), IndexStructure<T>(value)) -
+                 data_.begin();
             break;
         case OpType::GreaterEqual:
             lb = std::lower_bound(
-                data_.begin(), data_.end(), IndexStructure<T>(value));
+                     data_.begin(), data_.end(), IndexStructure<T>(value)) -
+                 data_.begin();
             break;
         default:
             PanicInfo(OpTypeInvalid,
                       fmt::format("Invalid OperatorType: {}", op));
     }
-    for (; lb < ub; ++lb) {
-        bitset[lb->idx_] = true;
-    }
-    return bitset;
+    return {lb, std::max(lb, ub)};
 }
 
 template <typename T>
-const TargetBitmap
-ScalarIndexSort<T>::Range(T lower_bound_value,
-                          bool lb_inclusive,
-                          T upper_bound_value,
-                          bool ub_inclusive) {
-    AssertInfo(is_built_, "index has not been built");
-    TargetBitmap bitset(Count());
+std::pair<size_t, size_t>
+ScalarIndexSort<T>::RangePositions(T lower_bound_value,
+                                   bool lb_inclusive,
+                                   T upper_bound_value,
+                                   bool ub_inclusive) {
     if (lower_bound_value > upper_bound_value ||
         (lower_bound_value == upper_bound_value &&
          !(lb_inclusive && ub_inclusive))) {
-        return bitset;
+        return {0, 0};
     }
     if (ShouldSkip(lower_bound_value, upper_bound_value, OpType::Range)) {
-        return bitset;
+        return {0, 0};
     }
     auto lb = data_.begin();
     auto ub = data_.end();
@@ -347,12 +344,160 @@ ScalarIndexSort<T>::Range(T lower_bound_value,
         ub = std::lower_bound(
             data_.begin(), data_.end(), IndexStructure<T>(upper_bound_value));
     }
+    size_t first = lb - data_.begin();
+    return {first, std::max<size_t>(first, ub - data_.begin())};
+}
+
+template <typename T>
+const TargetBitmap
+ScalarIndexSort<T>::Range(const T value, const OpType op) {
+    AssertInfo(is_built_, "index has not been built");
+    TargetBitmap bitset(Count());
+    auto [lb, ub] = RangePositions(value, op);
+    for (; lb < ub; ++lb) {
+        bitset[data_[lb].idx_] = true;
+    }
+    return bitset;
+}
+
+template <typename T>
+const TargetBitmap
+ScalarIndexSort<T>::Range(T lower_bound_value,
+                          bool lb_inclusive,
+                          T upper_bound_value,
+                          bool ub_inclusive) {
+    AssertInfo(is_built_, "index has not been built");
+    TargetBitmap bitset(Count());
+    auto [lb, ub] = RangePositions(
+        lower_bound_value, lb_inclusive, upper_bound_value, ub_inclusive);
     for (; lb < ub; ++lb) {
-        bitset[lb->idx_] = true;
+        bitset[data_[lb].idx_] = true;
     }
     return bitset;
 }
 
+template <typename T>
+void
+ScalarIndexSort<T>::FillWindow(
+    const std::vector<std::pair<size_t, size_t>>& ranges,
+    int64_t offset,
+    TargetBitmapView res) {
+    AssertInfo(is_built_, "index has not been built");
+    const int64_t len = res.size();
+    AssertInfo(offset >= 0 &&
+                   static_cast<size_t>(offset + len) <= total_num_rows_,
+               "window [{}, {}) out of range, num rows: {}",
+               offset,
+               offset + len,
+               total_num_rows_);
+    res.reset();
+
+    size_t matched = 0;
+    for (const auto& [first, last] : ranges) {
+        matched += last - first;
+    }
+    if (matched == 0) {
+        return;
+    }
+
+    // Few matches: walk them and keep those inside the window.
+    if (matched < static_cast<size_t>(len)) {
+        for (const auto& [first, last] : ranges) {
+            for (auto pos = first; pos < last; ++pos) {
+                auto row = static_cast<int64_t>(data_[pos].idx_) - offset;
+                if (row >= 0 && row < len) {
+                    res[row] = true;
+                }
+            }
+        }
+        return;
+    }
+
+    // Otherwise test the sorted position of every valid row in the window.
+    for (int64_t i = 0; i < len; ++i) {
+        auto row = offset + i;
+        if (!valid_bitset_[row]) {
+            continue;
+        }
+        size_t pos = idx_to_offsets_[row];
+        if (ranges.size() == 1) {
+            res[i] = pos >= ranges[0].first && pos < ranges[0].second;
+            continue;
+        }
+        auto it = std::upper_bound(
+            ranges.begin(),
+            ranges.end(),
+            pos,
+            [](size_t p, const auto& range) { return p < range.first; });
+        res[i] = it != ranges.begin() && pos < std::prev(it)->second;
+    }
+}
+
+template <typename T>
+void
+ScalarIndexSort<T>::InWindow(size_t n,
+                             const T* values,
+                             int64_t offset,
+                             TargetBitmapView res) {
+    std::vector<std::pair<size_t, size_t>> ranges;
+    ranges.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        auto [lb, ub] = RangePositions(values[i], true, values[i], true);
+        if (lb < ub) {
+            ranges.emplace_back(lb, ub);
+        }
+    }
+    // equal values yield equal ranges, distinct values never overlap
+    std::sort(ranges.begin(), ranges.end());
+    ranges.erase(std::unique(ranges.begin(), ranges.end()), ranges.end());
+    FillWindow(ranges, offset, res);
+}
+
+template <typename T>
+void
+ScalarIndexSort<T>::NotInWindow(size_t n,
+                                const T* values,
+                                int64_t offset,
+                                TargetBitmapView res) {
+    InWindow(n, values, offset, res);
+    res.flip();
+    // NotIn(null) and In(null) is both false, need to mask with IsNotNull operate
+    res &= valid_bitset_.view(offset, res.size());
+}
+
+template <typename T>
+void
+ScalarIndexSort<T>::RangeWindow(T value,
+                                OpType op,
+                                int64_t offset,
+                                TargetBitmapView res) {
+    FillWindow({RangePositions(value, op)}, offset, res);
+}
+
+template <typename T>
+void
+ScalarIndexSort<T>::RangeWindow(T lower_bound_value,
+                                bool lb_inclusive,
+                                T upper_bound_value,
+                                bool ub_inclusive,
+                                int64_t offset,
+                                TargetBitmapView res) {
+    FillWindow({RangePositions(lower_bound_value,
+                               lb_inclusive,
+                               upper_bound_value,
+                               ub_inclusive)},
+               offset,
+               res);
+}
+
+template <typename T>
+void
+ScalarIndexSort<T>::IsNotNullWindow(int64_t offset, TargetBitmapView res) {
+    AssertInfo(is_built_, "index has not been built");
+    res.reset();
+    res.inplace_or(valid_bitset_.view(offset, res.size()), res.size());
+}
+
 template <typename T>
 std::optional<T>
 ScalarIndexSort<T>::Reverse_Lookup(size_t idx) const {
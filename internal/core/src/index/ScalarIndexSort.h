@@ -82,6 +82,40 @@ class ScalarIndexSort : public ScalarIndex<T> {
           T upper_bound_value,
           bool ub_inclusive) override;
 
+    bool
+    SupportWindowQuery() const override {
+        return true;
+    }
+
+    void
+    InWindow(size_t n,
+             const T* values,
+             int64_t offset,
+             TargetBitmapView res) override;
+
+    void
+    NotInWindow(size_t n,
+                const T* values,
+                int64_t offset,
+                TargetBitmapView res) override;
+
+    void
+    RangeWindow(T value,
+                OpType op,
+                int64_t offset,
+                TargetBitmapView res) override;
+
+    void
+    RangeWindow(T lower_bound_value,
+                bool lb_inclusive,
+                T upper_bound_value,
+                bool ub_inclusive,
+                int64_t offset,
+                TargetBitmapView res) override;
+
+    void
+    IsNotNullWindow(int64_t offset, TargetBitmapView res) override;
+
     std::optional<T>
     Reverse_Lookup(size_t offset) const override;
 
@@ -105,6 +139,23 @@ class ScalarIndexSort : public ScalarIndex<T> {
     bool
     ShouldSkip(const T lower_value, const T upper_value, const OpType op);
 
+    // [first, last) positions in data_ whose values satisfy the predicate.
+    std::pair<size_t, size_t>
+    RangePositions(T value, OpType op);
+
+    std::pair<size_t, size_t>
+    RangePositions(T lower_bound_value,
+                   bool lb_inclusive,
+                   T upper_bound_value,
+                   bool ub_inclusive);
+
+    // Set res[i] for rows offset + i whose position in data_ falls into one
+    // of the sorted, disjoint ranges.
+    void
+    FillWindow(const std::vector<std::pair<size_t, size_t>>& ranges,
+               int64_t offset,
+               TargetBitmapView res);
+
  public:
     const std::vector<IndexStructure<T>>&
     GetData() {
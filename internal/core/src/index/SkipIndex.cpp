@@ -33,6 +33,323 @@ SkipIndex::GetFieldChunkMetrics(milvus::FieldId field_id, int chunk_id) const {
         &defaultFieldChunkMetrics);
 }
 
+namespace {
+constexpr int64_t kBloomBitsPerValue = 10;
+constexpr int64_t kBloomMinBits = 512;
+constexpr int64_t kBloomMaxBits = int64_t(1) << 20;
+constexpr int kBloomProbes = 4;
+// memory of a node of json_paths_ besides the key and value
+constexpr int64_t kJsonPathNodeOverhead = 32;
+
+int64_t
+BloomNumBits(int64_t num_values) {
+    int64_t num_bits = kBloomMinBits;
+    while (num_bits < num_values * kBloomBitsPerValue &&
+           num_bits < kBloomMaxBits) {
+        num_bits <<= 1;
+    }
+    return num_bits;
+}
+
+std::string
+EscapeJsonKey(std::string_view key) {
+    std::string escaped;
+    escaped.reserve(key.size());
+    for (auto c : key) {
+        if (c == '~') {
+            escaped += "~0";
+        } else if (c == '/') {
+            escaped += "~1";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+template <typename T>
+void
+UpdateRange(bool first, const T& value, T& min, T& max) {
+    if (first || value < min) {
+        min = value;
+    }
+    if (first || value > max) {
+        max = value;
+    }
+}
+
+void
+UpdateJsonPathMetrics(JsonPathMetrics& metrics, simdjson::dom::element value) {
+    auto& types = metrics.types_;
+    switch (value.type()) {
+        case simdjson::dom::element_type::INT64: {
+            UpdateRange<int64_t>(!(types & JsonPathMetrics::kInt),
+                                 value.get_int64().value(),
+                                 metrics.min_int_,
+                                 metrics.max_int_);
+            types |= JsonPathMetrics::kInt;
+            break;
+        }
+        case simdjson::dom::element_type::UINT64:
+        case simdjson::dom::element_type::DOUBLE: {
+            UpdateRange<double>(!(types & JsonPathMetrics::kDouble),
+                                value.get_double().value(),
+                                metrics.min_double_,
+                                metrics.max_double_);
+            types |= JsonPathMetrics::kDouble;
+            break;
+        }
+        case simdjson::dom::element_type::STRING: {
+            std::string_view str = value.get_string().value();
+            if ((types & JsonPathMetrics::kLongString) ||
+                str.size() > JSON_METRICS_MAX_STRING_SIZE) {
+                // keeps the size of the statistics bounded
+                metrics.min_string_ = std::string();
+                metrics.max_string_ = std::string();
+                types |= JsonPathMetrics::kString;
+                types |= JsonPathMetrics::kLongString;
+                break;
+            }
+            bool first = !(types & JsonPathMetrics::kString);
+            if (first || str < metrics.min_string_) {
+                metrics.min_string_ = str;
+            }
+            if (first || str > metrics.max_string_) {
+                metrics.max_string_ = str;
+            }
+            types |= JsonPathMetrics::kString;
+            break;
+        }
+        case simdjson::dom::element_type::BOOL:
+            types |= JsonPathMetrics::kBool;
+            break;
+        case simdjson::dom::element_type::ARRAY:
+            types |= JsonPathMetrics::kArray;
+            break;
+        case simdjson::dom::element_type::OBJECT:
+            types |= JsonPathMetrics::kObject;
+            break;
+        case simdjson::dom::element_type::NULL_VALUE:
+            types |= JsonPathMetrics::kNull;
+            break;
+    }
+}
+
+// Record every key of object, at depth levels below the root, and recurse
+// into nested objects up to JSON_METRICS_MAX_DEPTH.
+void
+CollectJsonPaths(simdjson::dom::object object,
+                 const std::string& prefix,
+                 int depth,
+                 FieldChunkMetrics& metrics) {
+    for (auto field : object) {
+        auto path = prefix + "/" + EscapeJsonKey(field.key);
+        auto it = metrics.json_paths_.find(path);
+        if (it == metrics.json_paths_.end()) {
+            if (metrics.json_paths_.size() >= JSON_METRICS_MAX_PATHS ||
+                path.size() > JSON_METRICS_MAX_PATH_SIZE) {
+                metrics.json_paths_complete_ = false;
+                continue;
+            }
+            it = metrics.json_paths_.emplace(path, JsonPathMetrics{}).first;
+        }
+        UpdateJsonPathMetrics(it->second, field.value);
+        if (field.value.is_object() && depth + 1 < JSON_METRICS_MAX_DEPTH) {
+            CollectJsonPaths(
+                field.value.get_object().value(), path, depth + 1, metrics);
+        }
+    }
+}
+}  // namespace
+
+ChunkBloomFilter::ChunkBloomFilter(int64_t num_values) {
+    auto num_bits = BloomNumBits(num_values);
+    bits_.resize(num_bits / 64, 0);
+    mask_ = num_bits - 1;
+}
+
+size_t
+ChunkBloomFilter::EstimatedByteSize(int64_t num_values) {
+    return BloomNumBits(num_values) / 8;
+}
+
+size_t
+ChunkBloomFilter::MaxByteSize() {
+    return kBloomMaxBits / 8;
+}
+
+void
+ChunkBloomFilter::Add(uint64_t hash) {
+    uint64_t delta = (hash >> 17) | (hash << 47) | 1;
+    for (int i = 0; i < kBloomProbes; ++i) {
+        auto bit = hash & mask_;
+        bits_[bit >> 6] |= uint64_t(1) << (bit & 63);
+        hash += delta;
+    }
+}
+
+bool
+ChunkBloomFilter::MayContain(uint64_t hash) const {
+    if (bits_.empty()) {
+        return true;
+    }
+    uint64_t delta = (hash >> 17) | (hash << 47) | 1;
+    for (int i = 0; i < kBloomProbes; ++i) {
+        auto bit = hash & mask_;
+        if (!(bits_[bit >> 6] & (uint64_t(1) << (bit & 63)))) {
+            return false;
+        }
+        hash += delta;
+    }
+    return true;
+}
+
+ChunkBloomFilter
+FieldChunkMetricsTranslator::BuildStringBloomFilter(const StringChunk* chunk) {
+    auto row_count = chunk->RowNums();
+    ChunkBloomFilter bloom(row_count);
+    for (int64_t i = 0; i < row_count; ++i) {
+        if (chunk->isValid(i)) {
+            bloom.Add(ChunkBloomFilter::Hash((*chunk)[i]));
+        }
+    }
+    return bloom;
+}
+
+void
+FieldChunkMetricsTranslator::FillJsonMetrics(const StringChunk* chunk,
+                                             FieldChunkMetrics& metrics) {
+    thread_local simdjson::dom::parser parser;
+    auto row_count = chunk->RowNums();
+    int64_t null_count = 0;
+    metrics.json_paths_complete_ = true;
+    for (int64_t i = 0; i < row_count; ++i) {
+        if (!chunk->isValid(i)) {
+            null_count++;
+            continue;
+        }
+        auto json = (*chunk)[i];
+        auto doc = parser.parse(json.data(), json.size());
+        if (doc.error()) {
+            // statistics must cover every row, give up on this chunk
+            metrics.json_paths_.clear();
+            metrics.json_paths_complete_ = false;
+            break;
+        }
+        auto root = doc.value();
+        if (root.is_object()) {
+            CollectJsonPaths(root.get_object().value(), "", 0, metrics);
+        } else if (root.is_array()) {
+            // pointers may index into the root array
+            metrics.json_paths_complete_ = false;
+        }
+    }
+    metrics.null_count_ = null_count;
+    metrics.hasValue_ = null_count != row_count;
+}
+
+void
+FieldChunkMetricsTranslator::FillArrayMetrics(const ArrayChunk* chunk,
+                                              FieldChunkMetrics& metrics) {
+    auto row_count = chunk->RowNums();
+    int64_t null_count = 0;
+    int64_t num_elements = 0;
+    auto element_type = DataType::NONE;
+    for (int64_t i = 0; i < row_count; ++i) {
+        if (!chunk->isValid(i)) {
+            null_count++;
+            continue;
+        }
+        auto view = chunk->View(i);
+        element_type = view.get_element_type();
+        num_elements += view.length();
+    }
+    metrics.null_count_ = null_count;
+    if (num_elements == 0) {
+        // no element to summarize, keep the chunk unprunable
+        metrics.hasValue_ = false;
+        return;
+    }
+
+    auto collect = [&](auto tag) {
+        using T = decltype(tag);
+        using GetType = std::conditional_t<std::is_same_v<T, std::string>,
+                                           std::string_view,
+                                           T>;
+        ChunkBloomFilter bloom(num_elements);
+        GetType min{};
+        GetType max{};
+        bool first = true;
+        for (int64_t i = 0; i < row_count; ++i) {
+            if (!chunk->isValid(i)) {
+                continue;
+            }
+            auto view = chunk->View(i);
+            for (int j = 0; j < view.length(); ++j) {
+                auto value = view.template get_data<GetType>(j);
+                UpdateRange<GetType>(first, value, min, max);
+                first = false;
+                bloom.Add(ChunkBloomFilter::Hash(value));
+            }
+        }
+        metrics.min_ = Metrics(T(min));
+        metrics.max_ = Metrics(T(max));
+        metrics.bloom_ = std::move(bloom);
+        metrics.hasValue_ = true;
+    };
+
+    switch (element_type) {
+        case DataType::INT8:
+        case DataType::INT16:
+        case DataType::INT32:
+        case DataType::INT64:
+            collect(int64_t{});
+            break;
+        case DataType::FLOAT:
+        case DataType::DOUBLE:
+            collect(double{});
+            break;
+        case DataType::VARCHAR:
+        case DataType::STRING:
+            collect(std::string{});
+            break;
+        default:
+            metrics.hasValue_ = false;
+            break;
+    }
+}
+
+milvus::cachinglayer::ResourceUsage
+FieldChunkMetricsTranslator::estimated_byte_size_of_cell(
+    milvus::cachinglayer::cid_t cid) const {
+    int64_t size = sizeof(FieldChunkMetrics);
+    switch (data_type_) {
+        case DataType::INT16:
+        case DataType::INT32:
+        case DataType::INT64:
+        case DataType::FLOAT:
+        case DataType::DOUBLE:
+        case DataType::VARCHAR:
+        case DataType::STRING:
+            size += ChunkBloomFilter::EstimatedByteSize(
+                column_->chunk_row_nums(cid));
+            break;
+        case DataType::ARRAY:
+            // the number of elements is only known once the chunk is read
+            size += ChunkBloomFilter::MaxByteSize();
+            break;
+        case DataType::JSON:
+            size += JSON_METRICS_MAX_PATHS *
+                    (sizeof(std::string) + JSON_METRICS_MAX_PATH_SIZE +
+                     sizeof(JsonPathMetrics) +
+                     2 * JSON_METRICS_MAX_STRING_SIZE + kJsonPathNodeOverhead);
+            break;
+        default:
+            break;
+    }
+    return {size, 0};
+}
+
 std::vector<
     std::pair<milvus::cachinglayer::cid_t, std::unique_ptr<FieldChunkMetrics>>>
 FieldChunkMetricsTranslator::get_cells(
@@ -41,7 +358,7 @@ FieldChunkMetricsTranslator::get_cells(
                           std::unique_ptr<FieldChunkMetrics>>>
         cells;
     cells.reserve(cids.size());
-    if (data_type_ == milvus::DataType::VARCHAR) {
+    if (IsStringDataType(data_type_)) {
         for (auto chunk_id : cids) {
             auto pw = column_->GetChunk(chunk_id);
             auto chunk = static_cast<StringChunk*>(pw.get());
@@ -53,10 +370,27 @@ FieldChunkMetricsTranslator::get_cells(
                 chunk_metrics->min_ = Metrics(info.min_);
                 chunk_metrics->max_ = Metrics(info.max_);
                 chunk_metrics->null_count_ = info.null_count_;
+                chunk_metrics->bloom_ = BuildStringBloomFilter(chunk);
             }
             chunk_metrics->hasValue_ = chunk_metrics->null_count_ != num_rows;
             cells.emplace_back(chunk_id, std::move(chunk_metrics));
         }
+    } else if (data_type_ == DataType::JSON) {
+        for (auto chunk_id : cids) {
+            auto pw = column_->GetChunk(chunk_id);
+            auto chunk = static_cast<StringChunk*>(pw.get());
+            auto chunk_metrics = std::make_unique<FieldChunkMetrics>();
+            FillJsonMetrics(chunk, *chunk_metrics);
+            cells.emplace_back(chunk_id, std::move(chunk_metrics));
+        }
+    } else if (data_type_ == DataType::ARRAY) {
+        for (auto chunk_id : cids) {
+            auto pw = column_->GetChunk(chunk_id);
+            auto chunk = static_cast<ArrayChunk*>(pw.get());
+            auto chunk_metrics = std::make_unique<FieldChunkMetrics>();
+            FillArrayMetrics(chunk, *chunk_metrics);
+            cells.emplace_back(chunk_id, std::move(chunk_metrics));
+        }
     } else {
         for (auto chunk_id : cids) {
             auto pw = column_->GetChunk(chunk_id);
@@ -89,6 +423,8 @@ FieldChunkMetricsTranslator::get_cells(
                         chunk_metrics->min_ = Metrics(info.min_);
                         chunk_metrics->max_ = Metrics(info.max_);
                         chunk_metrics->null_count_ = info.null_count_;
+                        chunk_metrics->bloom_ = BuildBloomFilter<int16_t>(
+                            typedData, valid_data, count);
                         break;
                     }
                     case DataType::INT32: {
@@ -99,6 +435,8 @@ FieldChunkMetricsTranslator::get_cells(
                         chunk_metrics->min_ = Metrics(info.min_);
                         chunk_metrics->max_ = Metrics(info.max_);
                         chunk_metrics->null_count_ = info.null_count_;
+                        chunk_metrics->bloom_ = BuildBloomFilter<int32_t>(
+                            typedData, valid_data, count);
                         break;
                     }
                     case DataType::INT64: {
@@ -109,6 +447,8 @@ FieldChunkMetricsTranslator::get_cells(
                         chunk_metrics->min_ = Metrics(info.min_);
                         chunk_metrics->max_ = Metrics(info.max_);
                         chunk_metrics->null_count_ = info.null_count_;
+                        chunk_metrics->bloom_ = BuildBloomFilter<int64_t>(
+                            typedData, valid_data, count);
                         break;
                     }
                     case DataType::FLOAT: {
@@ -119,6 +459,8 @@ FieldChunkMetricsTranslator::get_cells(
                         chunk_metrics->min_ = Metrics(info.min_);
                         chunk_metrics->max_ = Metrics(info.max_);
                         chunk_metrics->null_count_ = info.null_count_;
+                        chunk_metrics->bloom_ = BuildBloomFilter<float>(
+                            typedData, valid_data, count);
                         break;
                     }
                     case DataType::DOUBLE: {
@@ -129,6 +471,8 @@ FieldChunkMetricsTranslator::get_cells(
                         chunk_metrics->min_ = Metrics(info.min_);
                         chunk_metrics->max_ = Metrics(info.max_);
                         chunk_metrics->null_count_ = info.null_count_;
+                        chunk_metrics->bloom_ = BuildBloomFilter<double>(
+                            typedData, valid_data, count);
                         break;
                     }
                 }
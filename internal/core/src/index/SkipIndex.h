@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <unordered_map>
 
 #include "cachinglayer/CacheSlot.h"
@@ -37,11 +40,120 @@ template <typename T>
 using ReverseMetricsDataType =
     std::conditional_t<std::is_same_v<T, std::string_view>, std::string, T>;
 
+// Bloom filter over the values of a chunk, used to skip chunks for term and
+// IN predicates whose values fall inside [min, max] but are absent.
+class ChunkBloomFilter {
+ public:
+    ChunkBloomFilter() = default;
+
+    explicit ChunkBloomFilter(int64_t num_values);
+
+    // size of the filter of num_values values
+    static size_t
+    EstimatedByteSize(int64_t num_values);
+
+    // size of the filter of any number of values
+    static size_t
+    MaxByteSize();
+
+    template <typename T>
+    static uint64_t
+    Hash(const T& value) {
+        if constexpr (std::is_same_v<T, std::string> ||
+                      std::is_same_v<T, std::string_view>) {
+            return Mix(std::hash<std::string_view>{}(value));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            // integral doubles hash like integers so that 3 and 3.0 meet
+            double v = value;
+            if (v >= -9.2e18 && v <= 9.2e18 && v == std::trunc(v)) {
+                return Mix(static_cast<uint64_t>(static_cast<int64_t>(v)));
+            }
+            uint64_t bits;
+            std::memcpy(&bits, &v, sizeof(bits));
+            return Mix(bits);
+        } else {
+            return Mix(static_cast<uint64_t>(static_cast<int64_t>(value)));
+        }
+    }
+
+    void
+    Add(uint64_t hash);
+
+    bool
+    MayContain(uint64_t hash) const;
+
+    bool
+    empty() const {
+        return bits_.empty();
+    }
+
+    size_t
+    ByteSize() const {
+        return bits_.size() * sizeof(uint64_t);
+    }
+
+ private:
+    static uint64_t
+    Mix(uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    std::vector<uint64_t> bits_;
+    uint64_t mask_{0};
+};
+
+// Per-path statistics of a JSON chunk. Paths are JSON pointers, as built by
+// Json::pointer. Numbers keep separate integer and double ranges so that
+// comparisons follow the same conversions as the row-by-row evaluation.
+struct JsonPathMetrics {
+    enum : uint8_t {
+        kInt = 1,
+        kDouble = 1 << 1,
+        kString = 1 << 2,
+        kBool = 1 << 3,
+        kArray = 1 << 4,
+        kObject = 1 << 5,
+        kNull = 1 << 6,
+        // a string longer than JSON_METRICS_MAX_STRING_SIZE was seen, the
+        // string range is not kept
+        kLongString = 1 << 7,
+    };
+
+    uint8_t types_{0};
+    int64_t min_int_{0};
+    int64_t max_int_{0};
+    double min_double_{0};
+    double max_double_{0};
+    std::string min_string_;
+    std::string max_string_;
+};
+
+// nested objects below this depth are not summarized
+constexpr int JSON_METRICS_MAX_DEPTH = 4;
+// a chunk keeps statistics for at most this many distinct paths
+constexpr size_t JSON_METRICS_MAX_PATHS = 256;
+// longer paths are not summarized
+constexpr size_t JSON_METRICS_MAX_PATH_SIZE = 256;
+// the string range of a path is only kept for strings up to this size
+constexpr size_t JSON_METRICS_MAX_STRING_SIZE = 128;
+
 struct FieldChunkMetrics {
+    // for ARRAY fields min_/max_ cover the elements, as int64_t, double or
+    // std::string depending on the element type
     Metrics min_;
     Metrics max_;
     bool hasValue_;
     int64_t null_count_;
+    ChunkBloomFilter bloom_;
+    std::unordered_map<std::string, JsonPathMetrics> json_paths_;
+    // every path up to JSON_METRICS_MAX_DEPTH is in json_paths_, so a missing
+    // path is absent from all rows of the chunk
+    bool json_paths_complete_{false};
 
     FieldChunkMetrics() : hasValue_(false){};
 
@@ -63,7 +175,12 @@ struct FieldChunkMetrics {
 
     size_t
     CellByteSize() const {
-        return 0;
+        size_t size = bloom_.ByteSize();
+        for (const auto& [path, metrics] : json_paths_) {
+            size += sizeof(JsonPathMetrics) + path.size() +
+                    metrics.min_string_.size() + metrics.max_string_.size();
+        }
+        return size;
     }
 };
 
@@ -90,12 +207,10 @@ class FieldChunkMetricsTranslator
     cell_id_of(milvus::cachinglayer::uid_t uid) const override {
         return uid;
     }
+    // an upper bound of the bloom filter and json path statistics of a cell
     milvus::cachinglayer::ResourceUsage
     estimated_byte_size_of_cell(
-        milvus::cachinglayer::cid_t cid) const override {
-        // TODO(tiered storage 1): provide a better estimation.
-        return {0, 0};
-    }
+        milvus::cachinglayer::cid_t cid) const override;
     const std::string&
     key() const override {
         return key_;
@@ -153,6 +268,27 @@ class FieldChunkMetricsTranslator
         return {std::string(min_string), std::string(max_string), null_count};
     }
 
+    template <typename T>
+    static ChunkBloomFilter
+    BuildBloomFilter(const T* data, const bool* valid_data, int64_t count) {
+        ChunkBloomFilter bloom(count);
+        for (int64_t i = 0; i < count; ++i) {
+            if (valid_data == nullptr || valid_data[i]) {
+                bloom.Add(ChunkBloomFilter::Hash(data[i]));
+            }
+        }
+        return bloom;
+    }
+
+    static ChunkBloomFilter
+    BuildStringBloomFilter(const StringChunk* chunk);
+
+    static void
+    FillJsonMetrics(const StringChunk* chunk, FieldChunkMetrics& metrics);
+
+    static void
+    FillArrayMetrics(const ArrayChunk* chunk, FieldChunkMetrics& metrics);
+
     template <typename T>
     metricInfo<T>
     ProcessFieldMetrics(const T* data, const bool* valid_data, int64_t count) {
@@ -234,6 +370,119 @@ class SkipIndex {
         return false;
     }
 
+    // True if none of vals can be in the chunk, for term and IN predicates
+    // and for array_contains_any on ARRAY fields.
+    template <typename T>
+    bool
+    CanSkipTerm(FieldId field_id,
+                int64_t chunk_id,
+                const std::vector<T>& vals) const {
+        if (vals.empty()) {
+            return false;
+        }
+        auto pw = GetFieldChunkMetrics(field_id, chunk_id);
+        auto field_chunk_metrics = pw.get();
+        for (const auto& val : vals) {
+            if (MayContain<T>(field_chunk_metrics, val)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // True if any of vals is surely absent from the chunk, for
+    // array_contains_all on ARRAY fields.
+    template <typename T>
+    bool
+    CanSkipContainsAll(FieldId field_id,
+                       int64_t chunk_id,
+                       const std::vector<T>& vals) const {
+        auto pw = GetFieldChunkMetrics(field_id, chunk_id);
+        auto field_chunk_metrics = pw.get();
+        for (const auto& val : vals) {
+            if (!MayContain<T>(field_chunk_metrics, val)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Unary comparison on the JSON path pointer of a JSON field. Rows whose
+    // value at pointer is missing or of another type never match, so only
+    // the statistics of the value type of val matter.
+    template <typename T>
+    bool
+    CanSkipJsonUnaryRange(FieldId field_id,
+                          int64_t chunk_id,
+                          const std::string& pointer,
+                          OpType op_type,
+                          const T& val) const {
+        if constexpr (!std::is_same_v<T, int64_t> &&
+                      !std::is_same_v<T, double> &&
+                      !std::is_same_v<T, std::string>) {
+            return false;
+        } else {
+            switch (op_type) {
+                case OpType::Equal:
+                case OpType::LessThan:
+                case OpType::LessEqual:
+                case OpType::GreaterThan:
+                case OpType::GreaterEqual:
+                case OpType::PrefixMatch:
+                    break;
+                default:
+                    return false;
+            }
+            if (pointer.empty()) {
+                return false;
+            }
+            auto pw = GetFieldChunkMetrics(field_id, chunk_id);
+            auto field_chunk_metrics = pw.get();
+            if (!field_chunk_metrics->hasValue_) {
+                return false;
+            }
+            const auto& paths = field_chunk_metrics->json_paths_;
+            // a pointer running through an array may address its elements,
+            // which are not summarized
+            for (auto pos = pointer.find('/', 1); pos != std::string::npos;
+                 pos = pointer.find('/', pos + 1)) {
+                auto it = paths.find(pointer.substr(0, pos));
+                if (it != paths.end() &&
+                    (it->second.types_ & JsonPathMetrics::kArray)) {
+                    return false;
+                }
+            }
+            auto it = paths.find(pointer);
+            if (it == paths.end()) {
+                auto depth = std::count(pointer.begin(), pointer.end(), '/');
+                return field_chunk_metrics->json_paths_complete_ &&
+                       depth <= JSON_METRICS_MAX_DEPTH;
+            }
+            const auto& path = it->second;
+            if constexpr (std::is_same_v<T, std::string>) {
+                return !(path.types_ & JsonPathMetrics::kString) ||
+                       (!(path.types_ & JsonPathMetrics::kLongString) &&
+                        RangeShouldSkip<T>(val,
+                                           path.min_string_,
+                                           path.max_string_,
+                                           op_type));
+            } else {
+                auto min_int = static_cast<T>(path.min_int_);
+                auto max_int = static_cast<T>(path.max_int_);
+                bool skip_int =
+                    !(path.types_ & JsonPathMetrics::kInt) ||
+                    RangeShouldSkip<T>(val, min_int, max_int, op_type);
+                bool skip_double =
+                    !(path.types_ & JsonPathMetrics::kDouble) ||
+                    RangeShouldSkip<double>(static_cast<double>(val),
+                                            path.min_double_,
+                                            path.max_double_,
+                                            op_type);
+                return skip_int && skip_double;
+            }
+        }
+    }
+
     void
     LoadSkip(int64_t segment_id,
              milvus::FieldId field_id,
@@ -331,6 +580,23 @@ class SkipIndex {
         return false;
     }
 
+    template <typename T>
+    bool
+    MayContain(const FieldChunkMetrics* field_chunk_metrics,
+               const T& val) const {
+        if (!field_chunk_metrics->hasValue_) {
+            return true;
+        }
+        if (MinMaxUnaryFilter<T>(field_chunk_metrics, OpType::Equal, val)) {
+            return false;
+        }
+        if constexpr (!std::is_same_v<T, bool>) {
+            return field_chunk_metrics->bloom_.MayContain(
+                ChunkBloomFilter::Hash(val));
+        }
+        return true;
+    }
+
     template <typename T>
     bool
     RangeShouldSkip(const T& value,
@@ -359,6 +625,18 @@ class SkipIndex {
                 should_skip = value > upper_bound;
                 break;
             }
+            case OpType::PrefixMatch: {
+                if constexpr (std::is_same_v<T, std::string> ||
+                              std::is_same_v<T, std::string_view>) {
+                    // strings starting with value sort right after it, the
+                    // chunk misses them if it ends before or starts after
+                    std::string_view prefix(value);
+                    should_skip = upper_bound < prefix ||
+                                  (lower_bound > prefix &&
+                                   !lower_bound.starts_with(prefix));
+                }
+                break;
+            }
             default: {
                 should_skip = false;
             }
@@ -32,9 +32,11 @@
 #include "cachinglayer/Utils.h"
 #include "common/Array.h"
 #include "common/Chunk.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/FieldMeta.h"
 #include "common/Span.h"
+#include "futures/Executor.h"
 #include "segcore/storagev1translator/ChunkTranslator.h"
 #include "cachinglayer/Translator.h"
 #include "mmap/ChunkedColumnInterface.h"
@@ -44,7 +46,7 @@ namespace milvus {
 using namespace milvus::cachinglayer;
 
 std::pair<size_t, size_t> inline GetChunkIDByOffset(
-    int64_t offset, std::vector<int64_t>& num_rows_until_chunk) {
+    int64_t offset, const std::vector<int64_t>& num_rows_until_chunk) {
     AssertInfo(offset >= 0 && offset < num_rows_until_chunk.back(),
                "offset is out of range, offset: {}, num rows: {}",
                offset,
@@ -173,6 +175,27 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
                   "ProxyChunkColumn");
     }
 
+    void
+    BulkChunkAt(std::function<void(const Chunk*,
+                                   const int64_t*,
+                                   const int64_t*,
+                                   int64_t)> fn,
+                const int64_t* offsets,
+                int64_t count) const override {
+        if (count == 0) {
+            return;
+        }
+        auto groups = GroupByChunk(offsets, count);
+        auto ca = SemiInlineGet(slot_->PinCells(groups.cids));
+        for (size_t k = 0; k < groups.cids.size(); k++) {
+            auto start = groups.starts[k];
+            fn(ca->get_cell_of(groups.cids[k]),
+               groups.offsets_in_chunk.data() + start,
+               groups.indices.data() + start,
+               groups.starts[k + 1] - start);
+        }
+    }
+
     PinWrapper<std::pair<std::vector<std::string_view>, FixedVector<bool>>>
     StringViews(int64_t chunk_id,
                 std::optional<std::pair<int64_t, int64_t>> offset_len =
@@ -209,8 +232,7 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
                    "offset {} is out of range, num_rows: {}",
                    offset,
                    num_rows_);
-        auto num_rows_until_chunk = GetNumRowsUntilChunk();
-        return ::milvus::GetChunkIDByOffset(offset, num_rows_until_chunk);
+        return ::milvus::GetChunkIDByOffset(offset, GetNumRowsUntilChunk());
     }
 
     PinWrapper<Chunk*>
@@ -220,6 +242,17 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
         return PinWrapper<Chunk*>(ca, chunk);
     }
 
+    std::unique_ptr<ReadAheadHandle>
+    ReadAhead(std::vector<int64_t> chunk_ids) const override {
+        if (CACHE_READ_AHEAD_DEPTH <= 0 || chunk_ids.size() <= 1) {
+            return nullptr;
+        }
+        return slot_->ReadAhead(std::move(chunk_ids),
+                                CACHE_READ_AHEAD_DEPTH,
+                                folly::getKeepAliveToken(
+                                    milvus::futures::getGlobalIOExecutor()));
+    }
+
     int64_t
     GetNumRowsUntilChunk(int64_t chunk_id) const override {
         return GetNumRowsUntilChunk()[chunk_id];
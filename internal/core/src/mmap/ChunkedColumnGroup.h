@@ -30,9 +30,11 @@
 #include "cachinglayer/Utils.h"
 
 #include "common/Chunk.h"
+#include "common/Common.h"
 #include "common/GroupChunk.h"
 #include "common/EasyAssert.h"
 #include "common/Span.h"
+#include "futures/Executor.h"
 #include "mmap/ChunkedColumnInterface.h"
 #include "segcore/storagev2translator/GroupCTMeta.h"
 
@@ -77,6 +79,17 @@ class ChunkedColumnGroup {
         return SemiInlineGet(slot_->PinCells(chunk_ids));
     }
 
+    std::unique_ptr<ReadAheadHandle>
+    ReadAhead(std::vector<int64_t> chunk_ids) const {
+        if (CACHE_READ_AHEAD_DEPTH <= 0 || chunk_ids.size() <= 1) {
+            return nullptr;
+        }
+        return slot_->ReadAhead(std::move(chunk_ids),
+                                CACHE_READ_AHEAD_DEPTH,
+                                folly::getKeepAliveToken(
+                                    milvus::futures::getGlobalIOExecutor()));
+    }
+
     int64_t
     NumRows() const {
         return num_rows_;
@@ -315,6 +328,11 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
         return PinWrapper<Chunk*>(group_chunk, chunk.get());
     }
 
+    std::unique_ptr<ReadAheadHandle>
+    ReadAhead(std::vector<int64_t> chunk_ids) const override {
+        return group_->ReadAhead(std::move(chunk_ids));
+    }
+
     int64_t
     GetNumRowsUntilChunk(int64_t chunk_id) const override {
         return group_->GetNumRowsUntilChunk(chunk_id);
@@ -338,6 +356,28 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
         }
     }
 
+    void
+    BulkChunkAt(std::function<void(const Chunk*,
+                                   const int64_t*,
+                                   const int64_t*,
+                                   int64_t)> fn,
+                const int64_t* offsets,
+                int64_t count) const override {
+        if (count == 0) {
+            return;
+        }
+        auto groups = GroupByChunk(offsets, count);
+        auto ca = group_->GetGroupChunks(groups.cids);
+        for (size_t k = 0; k < groups.cids.size(); k++) {
+            auto start = groups.starts[k];
+            auto chunk = ca->get_cell_of(groups.cids[k])->GetChunk(field_id_);
+            fn(chunk.get(),
+               groups.offsets_in_chunk.data() + start,
+               groups.indices.data() + start,
+               groups.starts[k + 1] - start);
+        }
+    }
+
     void
     BulkRawStringAt(std::function<void(std::string_view, size_t, bool)> fn,
                     const int64_t* offsets = nullptr,
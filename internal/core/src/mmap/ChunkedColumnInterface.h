@@ -15,6 +15,10 @@
 // limitations under the License.
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <vector>
+
 #include "cachinglayer/CacheSlot.h"
 #include "common/Chunk.h"
 
@@ -96,6 +100,15 @@ class ChunkedColumnInterface {
     virtual PinWrapper<Chunk*>
     GetChunk(int64_t chunk_id) const = 0;
 
+    // Declares the chunks a sequential scan is going to visit, in order. Chunks ahead of
+    // the scan position are pinned in the background, call Advance(i) on the returned
+    // handle when the scan moves on to chunk_ids[i]. Returns nullptr if there is nothing
+    // worth reading ahead, the caller should then simply scan as usual.
+    virtual std::unique_ptr<ReadAheadHandle>
+    ReadAhead(std::vector<int64_t> chunk_ids) const {
+        return nullptr;
+    }
+
     // Get number of rows before a specific chunk
     virtual int64_t
     GetNumRowsUntilChunk(int64_t chunk_id) const = 0;
@@ -109,6 +122,20 @@ class ChunkedColumnInterface {
                 const int64_t* offsets,
                 int64_t count) = 0;
 
+    // fn: (const Chunk* chunk, const int64_t* offsets_in_chunk,
+    //      const int64_t* indices, int64_t n) -> void
+    // Groups the offsets by chunk and calls fn once per chunk with the n rows
+    // of it among the offsets, offsets_in_chunk[j] is the row of offsets at
+    // indices[j]. Every chunk is pinned and located once, so the callers can
+    // gather the values of a chunk in a tight loop instead of a call per row.
+    virtual void
+    BulkChunkAt(std::function<void(const Chunk*,
+                                   const int64_t*,
+                                   const int64_t*,
+                                   int64_t)> fn,
+                const int64_t* offsets,
+                int64_t count) const = 0;
+
     // fn: (std::string_view value, size_t offset, bool is_valid) -> void
     // If offsets is nullptr, this function will iterate over all rows.
     // Only BulkRawStringAt and BulkIsValid allow offsets to be nullptr.
@@ -187,6 +214,61 @@ class ChunkedColumnInterface {
         }
         return std::make_pair(std::move(cids), std::move(offsets_in_chunk));
     }
+
+    // The rows of offsets grouped by chunk, in the order of the chunks. The
+    // rows of cids[k] are [starts[k], starts[k + 1]) of offsets_in_chunk and
+    // indices, the latter are the positions of the rows in offsets.
+    struct ChunkGroups {
+        std::vector<milvus::cachinglayer::cid_t> cids;
+        std::vector<int64_t> starts;
+        std::vector<int64_t> offsets_in_chunk;
+        std::vector<int64_t> indices;
+    };
+
+    ChunkGroups
+    GroupByChunk(const int64_t* offsets, int64_t count) const {
+        AssertInfo(offsets != nullptr, "Offsets cannot be nullptr");
+        const auto& num_rows_until_chunk = GetNumRowsUntilChunk();
+        const auto num_chunks = num_rows_until_chunk.size() - 1;
+        const auto num_rows = num_rows_until_chunk.back();
+
+        // a counting sort by chunk id, stable within a chunk
+        std::vector<milvus::cachinglayer::cid_t> row_cids(count);
+        std::vector<int64_t> cursors(num_chunks, 0);
+        for (int64_t i = 0; i < count; i++) {
+            AssertInfo(offsets[i] >= 0 && offsets[i] < num_rows,
+                       "offset {} is out of range, num_rows: {}",
+                       offsets[i],
+                       num_rows);
+            auto iter = std::upper_bound(num_rows_until_chunk.begin(),
+                                         num_rows_until_chunk.end(),
+                                         offsets[i]);
+            row_cids[i] = std::distance(num_rows_until_chunk.begin(), iter) - 1;
+            cursors[row_cids[i]]++;
+        }
+
+        ChunkGroups groups;
+        groups.starts.push_back(0);
+        for (size_t cid = 0; cid < num_chunks; cid++) {
+            if (cursors[cid] == 0) {
+                continue;
+            }
+            auto start = groups.starts.back();
+            groups.cids.push_back(cid);
+            groups.starts.push_back(start + cursors[cid]);
+            cursors[cid] = start;
+        }
+        groups.offsets_in_chunk.resize(count);
+        groups.indices.resize(count);
+        for (int64_t i = 0; i < count; i++) {
+            auto cid = row_cids[i];
+            auto pos = cursors[cid]++;
+            groups.offsets_in_chunk[pos] =
+                offsets[i] - num_rows_until_chunk[cid];
+            groups.indices[pos] = i;
+        }
+        return groups;
+    }
 };
 
 }  // namespace milvus
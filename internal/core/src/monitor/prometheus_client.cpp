@@ -428,6 +428,43 @@ DEFINE_PROMETHEUS_COUNTER(internal_cache_op_result_count_miss_mixed,
                           internal_cache_op_result_count,
                           cacheMissMixedLabels);
 
+// Cache hit rate and reloads per eviction policy
+std::map<std::string, std::string> cacheHitLRULabels = {{"result", "hit"},
+                                                        {"policy", "lru"}};
+std::map<std::string, std::string> cacheHit2QLabels = {{"result", "hit"},
+                                                       {"policy", "2q"}};
+std::map<std::string, std::string> cacheMissLRULabels = {{"result", "miss"},
+                                                         {"policy", "lru"}};
+std::map<std::string, std::string> cacheMiss2QLabels = {{"result", "miss"},
+                                                        {"policy", "2q"}};
+std::map<std::string, std::string> cacheLRULabel = {{"policy", "lru"}};
+std::map<std::string, std::string> cache2QLabel = {{"policy", "2q"}};
+DEFINE_PROMETHEUS_COUNTER_FAMILY(
+    internal_cache_policy_op_result_count,
+    "[cpp]cache operation result count per eviction policy");
+DEFINE_PROMETHEUS_COUNTER(internal_cache_policy_op_result_count_hit_lru,
+                          internal_cache_policy_op_result_count,
+                          cacheHitLRULabels);
+DEFINE_PROMETHEUS_COUNTER(internal_cache_policy_op_result_count_hit_2q,
+                          internal_cache_policy_op_result_count,
+                          cacheHit2QLabels);
+DEFINE_PROMETHEUS_COUNTER(internal_cache_policy_op_result_count_miss_lru,
+                          internal_cache_policy_op_result_count,
+                          cacheMissLRULabels);
+DEFINE_PROMETHEUS_COUNTER(internal_cache_policy_op_result_count_miss_2q,
+                          internal_cache_policy_op_result_count,
+                          cacheMiss2QLabels);
+
+DEFINE_PROMETHEUS_COUNTER_FAMILY(
+    internal_cache_policy_reload_bytes,
+    "[cpp]total bytes of evicted cells loaded again per eviction policy");
+DEFINE_PROMETHEUS_COUNTER(internal_cache_policy_reload_bytes_lru,
+                          internal_cache_policy_reload_bytes,
+                          cacheLRULabel);
+DEFINE_PROMETHEUS_COUNTER(internal_cache_policy_reload_bytes_2q,
+                          internal_cache_policy_reload_bytes,
+                          cache2QLabel);
+
 // Cache usage (bytes)
 DEFINE_PROMETHEUS_GAUGE_FAMILY(internal_cache_used_bytes,
                                "[cpp]currently used bytes in cache");
@@ -189,6 +189,16 @@ DECLARE_PROMETHEUS_COUNTER(internal_cache_op_result_count_miss_memory);
 DECLARE_PROMETHEUS_COUNTER(internal_cache_op_result_count_miss_disk);
 DECLARE_PROMETHEUS_COUNTER(internal_cache_op_result_count_miss_mixed);
 
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_cache_policy_op_result_count);
+DECLARE_PROMETHEUS_COUNTER(internal_cache_policy_op_result_count_hit_lru);
+DECLARE_PROMETHEUS_COUNTER(internal_cache_policy_op_result_count_hit_2q);
+DECLARE_PROMETHEUS_COUNTER(internal_cache_policy_op_result_count_miss_lru);
+DECLARE_PROMETHEUS_COUNTER(internal_cache_policy_op_result_count_miss_2q);
+
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_cache_policy_reload_bytes);
+DECLARE_PROMETHEUS_COUNTER(internal_cache_policy_reload_bytes_lru);
+DECLARE_PROMETHEUS_COUNTER(internal_cache_policy_reload_bytes_2q);
+
 DECLARE_PROMETHEUS_GAUGE_FAMILY(internal_cache_used_bytes);
 DECLARE_PROMETHEUS_GAUGE(internal_cache_used_bytes_memory);
 DECLARE_PROMETHEUS_GAUGE(internal_cache_used_bytes_disk);
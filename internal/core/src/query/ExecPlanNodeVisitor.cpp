@@ -147,6 +147,10 @@ ExecPlanNodeVisitor::VectorVisitorImpl(VectorPlanNode& node) {
 
     // Store result
     search_result_opt_ = std::move(query_context->get_search_result());
+    if (query_context->profile()) {
+        search_result_opt_->exec_profile_ =
+            query_context->profile()->ToString();
+    }
 }
 
 std::unique_ptr<RetrieveResult>
@@ -210,6 +214,10 @@ ExecPlanNodeVisitor::visit(RetrievePlanNode& node) {
         retrieve_result.has_more_result = results_pair.second;
         retrieve_result_opt_ = std::move(retrieve_result);
     }
+    if (query_context->profile()) {
+        retrieve_result_opt_->exec_profile_ =
+            query_context->profile()->ToString();
+    }
 }
 
 void
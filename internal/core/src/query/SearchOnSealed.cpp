@@ -11,13 +11,19 @@
 
 #include <algorithm>
 #include <cmath>
+#include <memory>
+#include <numeric>
+#include <optional>
 #include <string>
 
 #include "bitset/detail/element_wise.h"
 #include "cachinglayer/Utils.h"
 #include "common/BitsetView.h"
+#include "common/Common.h"
 #include "common/QueryInfo.h"
 #include "common/Types.h"
+#include "futures/Executor.h"
+#include "futures/ParallelFor.h"
 #include "query/CachedSearchIterator.h"
 #include "query/SearchBruteForce.h"
 #include "query/SearchOnSealed.h"
@@ -26,6 +32,83 @@
 
 namespace milvus::query {
 
+namespace {
+
+// Brute force searches chunks [begin, end) of the column, merging the
+// results in chunk order.
+SubSearchResult
+SearchChunkRange(ChunkedColumnInterface* column,
+                 int64_t begin,
+                 int64_t end,
+                 int64_t dim,
+                 const dataset::SearchDataset& query_dataset,
+                 const SearchInfo& search_info,
+                 const std::map<std::string, std::string>& index_info,
+                 const BitsetView& bitview,
+                 DataType data_type) {
+    SubSearchResult range_qr(query_dataset.num_queries,
+                             query_dataset.topk,
+                             query_dataset.metric_type,
+                             query_dataset.round_decimal);
+    auto offset = column->GetNumRowsUntilChunk(begin);
+    for (auto i = begin; i < end; ++i) {
+        auto pw = column->DataOfChunk(i);
+        auto chunk_size = column->chunk_row_nums(i);
+        auto raw_dataset =
+            query::dataset::RawDataset{offset, dim, chunk_size, pw.get()};
+        auto sub_qr = BruteForceSearch(query_dataset,
+                                       raw_dataset,
+                                       search_info,
+                                       index_info,
+                                       bitview,
+                                       data_type);
+        range_qr.merge(sub_qr);
+        offset += chunk_size;
+    }
+    return range_qr;
+}
+
+// Splits the chunks into `parallelism` contiguous ranges and searches them
+// with futures::ParallelFor on the CPU executor, so a saturated executor
+// never blocks the search. The per-range results are tree merged in chunk
+// order, thus the result is identical to the sequential search.
+void
+SearchChunksInParallel(ChunkedColumnInterface* column,
+                       int64_t num_chunk,
+                       int64_t parallelism,
+                       int64_t dim,
+                       const dataset::SearchDataset& query_dataset,
+                       const SearchInfo& search_info,
+                       const std::map<std::string, std::string>& index_info,
+                       const BitsetView& bitview,
+                       DataType data_type,
+                       SubSearchResult& final_qr) {
+    auto num_ranges = std::min(parallelism, num_chunk);
+    std::vector<std::optional<SubSearchResult>> results(num_ranges);
+    auto search_range = [&](int64_t r) {
+        results[r].emplace(SearchChunkRange(column,
+                                            num_chunk * r / num_ranges,
+                                            num_chunk * (r + 1) / num_ranges,
+                                            dim,
+                                            query_dataset,
+                                            search_info,
+                                            index_info,
+                                            bitview,
+                                            data_type));
+    };
+    milvus::futures::ParallelFor(
+        milvus::futures::getGlobalCPUExecutor(), num_ranges, search_range);
+
+    for (int64_t stride = 1; stride < num_ranges; stride *= 2) {
+        for (int64_t r = 0; r + stride < num_ranges; r += 2 * stride) {
+            results[r]->merge(*results[r + stride]);
+        }
+    }
+    final_qr.merge(*results[0]);
+}
+
+}  // namespace
+
 void
 SearchOnSealedIndex(const Schema& schema,
                     const segcore::SealedIndexingRecord& record,
@@ -130,34 +213,55 @@ SearchOnSealedColumn(const Schema& schema,
                              search_info.metric_type_,
                              search_info.round_decimal_);
 
-    auto offset = 0;
-    for (int i = 0; i < num_chunk; ++i) {
-        auto pw = column->DataOfChunk(i);
-        auto vec_data = pw.get();
-        auto chunk_size = column->chunk_row_nums(i);
-        auto raw_dataset =
-            query::dataset::RawDataset{offset, dim, chunk_size, vec_data};
-        if (milvus::exec::UseVectorIterator(search_info)) {
-            auto sub_qr =
-                PackBruteForceSearchIteratorsIntoSubResult(query_dataset,
-                                                           raw_dataset,
-                                                           search_info,
-                                                           index_info,
-                                                           bitview,
-                                                           data_type);
-            final_qr.merge(sub_qr);
-        } else {
-            auto sub_qr = BruteForceSearch(query_dataset,
-                                           raw_dataset,
-                                           search_info,
-                                           index_info,
-                                           bitview,
-                                           data_type);
-            final_qr.merge(sub_qr);
+    auto use_iterator = milvus::exec::UseVectorIterator(search_info);
+    if (!use_iterator && BRUTE_FORCE_CHUNK_PARALLELISM > 1 && num_chunk > 1) {
+        SearchChunksInParallel(column,
+                               num_chunk,
+                               BRUTE_FORCE_CHUNK_PARALLELISM,
+                               dim,
+                               query_dataset,
+                               search_info,
+                               index_info,
+                               bitview,
+                               data_type,
+                               final_qr);
+    } else {
+        std::vector<int64_t> chunk_ids(num_chunk);
+        std::iota(chunk_ids.begin(), chunk_ids.end(), 0);
+        auto read_ahead = column->ReadAhead(std::move(chunk_ids));
+
+        auto offset = 0;
+        for (int i = 0; i < num_chunk; ++i) {
+            if (read_ahead != nullptr) {
+                read_ahead->Advance(i);
+            }
+            auto pw = column->DataOfChunk(i);
+            auto vec_data = pw.get();
+            auto chunk_size = column->chunk_row_nums(i);
+            auto raw_dataset =
+                query::dataset::RawDataset{offset, dim, chunk_size, vec_data};
+            if (use_iterator) {
+                auto sub_qr =
+                    PackBruteForceSearchIteratorsIntoSubResult(query_dataset,
+                                                               raw_dataset,
+                                                               search_info,
+                                                               index_info,
+                                                               bitview,
+                                                               data_type);
+                final_qr.merge(sub_qr);
+            } else {
+                auto sub_qr = BruteForceSearch(query_dataset,
+                                               raw_dataset,
+                                               search_info,
+                                               index_info,
+                                               bitview,
+                                               data_type);
+                final_qr.merge(sub_qr);
+            }
+            offset += chunk_size;
         }
-        offset += chunk_size;
     }
-    if (milvus::exec::UseVectorIterator(search_info)) {
+    if (use_iterator) {
         result.AssembleChunkVectorIterators(num_queries,
                                             num_chunk,
                                             column->GetNumRowsUntilChunk(),
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -435,8 +436,7 @@ ChunkedSegmentSealedImpl::load_system_field_internal(FieldId field_id,
             FieldName(""), FieldId(0), DataType::INT64, false, std::nullopt);
         std::shared_ptr<milvus::ArrowDataWrapper> r;
         while (data.arrow_reader_channel->pop(r)) {
-            auto array_vec = read_single_column_batches(r->reader);
-            auto chunk = create_chunk(field_meta, array_vec);
+            auto chunk = create_chunk(field_meta, *r);
             auto chunk_ptr = static_cast<FixedWidthChunk*>(chunk.get());
             std::copy_n(static_cast<const Timestamp*>(chunk_ptr->Span().data()),
                         chunk_ptr->Span().row_count(),
@@ -542,6 +542,33 @@ ChunkedSegmentSealedImpl::get_chunk_by_offset(FieldId field_id,
     return fields_.at(field_id)->GetChunkIDByOffset(offset);
 }
 
+std::unique_ptr<ReadAheadHandle>
+ChunkedSegmentSealedImpl::read_ahead_chunks(
+    FieldId field_id, std::vector<int64_t> chunk_ids) const {
+    std::shared_lock lck(mutex_);
+    if (auto it = fields_.find(field_id); it != fields_.end()) {
+        return it->second->ReadAhead(std::move(chunk_ids));
+    }
+    return nullptr;
+}
+
+PinWrapper<const JsonShadowColumn*>
+ChunkedSegmentSealedImpl::GetJsonShadowColumn(
+    FieldId field_id, int64_t chunk_id, const std::string& pointer) const {
+    std::shared_lock lck(mutex_);
+    auto it = fields_.find(field_id);
+    if (it == fields_.end()) {
+        return PinWrapper<const JsonShadowColumn*>(nullptr);
+    }
+    return it->second->GetChunk(chunk_id).transform<const JsonShadowColumn*>(
+        [&pointer](Chunk* chunk) -> const JsonShadowColumn* {
+            auto json_chunk = dynamic_cast<JSONChunk*>(chunk);
+            return json_chunk == nullptr
+                       ? nullptr
+                       : json_chunk->GetJsonShadowColumn(pointer);
+        });
+}
+
 int64_t
 ChunkedSegmentSealedImpl::num_rows_until_chunk(FieldId field_id,
                                                int64_t chunk_id) const {
@@ -943,6 +970,156 @@ ChunkedSegmentSealedImpl::search_sorted_pk(const PkType& pk,
     return pk_offsets;
 }
 
+namespace {
+
+// Lower bound of `target` in the sorted rows [begin, end), galloping from
+// `begin` as the targets of a merge join are ascending.
+template <typename GetRow, typename T>
+int64_t
+GallopLowerBound(const GetRow& get_row,
+                 int64_t begin,
+                 int64_t end,
+                 const T& target) {
+    int64_t lo = begin;
+    int64_t hi = begin;
+    int64_t step = 1;
+    while (hi < end && get_row(hi) < target) {
+        lo = hi + 1;
+        hi = lo + step;
+        step <<= 1;
+    }
+    hi = std::min(hi, end);
+    while (lo < hi) {
+        auto mid = lo + (hi - lo) / 2;
+        if (get_row(mid) < target) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// Merge joins the pks, in the ascending order given by `order`, with a sorted
+// chunk of `rows` pks, calling `on_match(pk_idx, row)` for every equal row.
+template <typename T, typename GetKey, typename GetRow, typename OnMatch>
+void
+MergeJoinSortedChunk(const std::vector<size_t>& order,
+                     const GetKey& get_key,
+                     const GetRow& get_row,
+                     int64_t rows,
+                     const OnMatch& on_match) {
+    if (rows == 0) {
+        return;
+    }
+    T first_row = get_row(0);
+    T last_row = get_row(rows - 1);
+    auto it = std::lower_bound(
+        order.begin(),
+        order.end(),
+        first_row,
+        [&](size_t idx, const T& value) { return get_key(idx) < value; });
+    int64_t pos = 0;
+    for (; it != order.end(); ++it) {
+        T target = get_key(*it);
+        if (last_row < target) {
+            break;
+        }
+        pos = GallopLowerBound(get_row, pos, rows, target);
+        for (auto row = pos; row < rows && get_row(row) == target; ++row) {
+            on_match(*it, row);
+        }
+    }
+}
+
+}  // namespace
+
+void
+ChunkedSegmentSealedImpl::search_pks(
+    const std::vector<PkType>& pks,
+    const Timestamp* timestamps,
+    const std::function<void(size_t, SegOffset)>& callback) const {
+    if (!is_sorted_by_pk_) {
+        for (size_t i = 0; i < pks.size(); ++i) {
+            auto offsets = insert_record_.search_pk(pks[i], timestamps[i]);
+            for (auto offset : offsets) {
+                callback(i, offset);
+            }
+        }
+        return;
+    }
+
+    auto pk_field_id = schema_->get_primary_field_id().value_or(FieldId(-1));
+    AssertInfo(pk_field_id.get() != -1, "Primary key is -1");
+    auto pk_column = fields_.at(pk_field_id);
+
+    // stable, so the duplicates of a pk are visited in their batch order
+    std::vector<size_t> order(pks.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return pks[a] < pks[b];
+    });
+
+    auto num_chunk = pk_column->num_chunks();
+    switch (schema_->get_fields().at(pk_field_id).get_data_type()) {
+        case DataType::INT64: {
+            auto get_key = [&](size_t idx) {
+                return std::get<int64_t>(pks[idx]);
+            };
+            for (int i = 0; i < num_chunk; ++i) {
+                auto pw = pk_column->DataOfChunk(i);
+                auto src = reinterpret_cast<const int64_t*>(pw.get());
+                auto num_rows_until_chunk = pk_column->GetNumRowsUntilChunk(i);
+                MergeJoinSortedChunk<int64_t>(
+                    order,
+                    get_key,
+                    [src](int64_t row) { return src[row]; },
+                    pk_column->chunk_row_nums(i),
+                    [&](size_t idx, int64_t row) {
+                        auto offset = row + num_rows_until_chunk;
+                        if (insert_record_.timestamps_[offset] <=
+                            timestamps[idx]) {
+                            callback(idx, SegOffset(offset));
+                        }
+                    });
+            }
+            break;
+        }
+        case DataType::VARCHAR: {
+            auto get_key = [&](size_t idx) {
+                return std::string_view(std::get<std::string>(pks[idx]));
+            };
+            for (int i = 0; i < num_chunk; ++i) {
+                auto pw = pk_column->GetChunk(i);
+                auto string_chunk = static_cast<StringChunk*>(pw.get());
+                auto num_rows_until_chunk = pk_column->GetNumRowsUntilChunk(i);
+                MergeJoinSortedChunk<std::string_view>(
+                    order,
+                    get_key,
+                    [string_chunk](int64_t row) {
+                        return (*string_chunk)[row];
+                    },
+                    string_chunk->RowNums(),
+                    [&](size_t idx, int64_t row) {
+                        auto offset = row + num_rows_until_chunk;
+                        if (insert_record_.timestamps_[offset] <=
+                            timestamps[idx]) {
+                            callback(idx, SegOffset(offset));
+                        }
+                    });
+            }
+            break;
+        }
+        default: {
+            PanicInfo(
+                DataTypeInvalid,
+                fmt::format(
+                    "unsupported type {}",
+                    schema_->get_fields().at(pk_field_id).get_data_type()));
+        }
+    }
+}
+
 std::pair<std::vector<OffsetMap::OffsetType>, bool>
 ChunkedSegmentSealedImpl::find_first(int64_t limit,
                                      const BitsetType& bitset) const {
@@ -998,7 +1175,12 @@ ChunkedSegmentSealedImpl::ChunkedSegmentSealedImpl(
           [this](const PkType& pk, Timestamp timestamp) {
               return this->search_pk(pk, timestamp);
           },
-          segment_id) {
+          segment_id,
+          [this](const std::vector<PkType>& pks,
+                 const Timestamp* timestamps,
+                 const std::function<void(size_t, SegOffset)>& callback) {
+              this->search_pks(pks, timestamps, callback);
+          }) {
     auto mcm = storage::MmapManager::GetInstance().GetMmapChunkManager();
     mmap_descriptor_ = mcm->Register();
 }
@@ -1058,9 +1240,15 @@ ChunkedSegmentSealedImpl::bulk_subscript_impl(ChunkedColumnInterface* field,
                                               int64_t count,
                                               T* dst) {
     static_assert(IsScalar<T>);
-    field->BulkValueAt(
-        [dst](const char* value, size_t i) {
-            dst[i] = *static_cast<const S*>(static_cast<const void*>(value));
+    field->BulkChunkAt(
+        [dst](const Chunk* chunk,
+              const int64_t* offsets_in_chunk,
+              const int64_t* indices,
+              int64_t n) {
+            auto src = reinterpret_cast<const S*>(chunk->Data());
+            for (int64_t j = 0; j < n; ++j) {
+                dst[indices[j]] = src[offsets_in_chunk[j]];
+            }
         },
         seg_offsets,
         count);
@@ -1073,22 +1261,22 @@ ChunkedSegmentSealedImpl::bulk_subscript_ptr_impl(
     const int64_t* seg_offsets,
     int64_t count,
     google::protobuf::RepeatedPtrField<std::string>* dst) {
-    if constexpr (std::is_same_v<S, Json>) {
-        column->BulkRawJsonAt(
-            [&](Json json, size_t offset, bool is_valid) {
-                dst->at(offset) = std::move(std::string(json.data()));
-            },
-            seg_offsets,
-            count);
-    } else {
-        static_assert(std::is_same_v<S, std::string>);
-        column->BulkRawStringAt(
-            [dst](std::string_view value, size_t offset, bool is_valid) {
-                dst->at(offset) = std::move(std::string(value));
-            },
-            seg_offsets,
-            count);
-    }
+    static_assert(std::is_same_v<S, std::string> || std::is_same_v<S, Json>);
+    // strings and json share the StringChunk layout, the values are copied
+    // into the strings dst already holds
+    column->BulkChunkAt(
+        [dst](const Chunk* chunk,
+              const int64_t* offsets_in_chunk,
+              const int64_t* indices,
+              int64_t n) {
+            auto string_chunk = static_cast<const StringChunk*>(chunk);
+            for (int64_t j = 0; j < n; ++j) {
+                auto value = (*string_chunk)[offsets_in_chunk[j]];
+                dst->Mutable(indices[j])->assign(value.data(), value.size());
+            }
+        },
+        seg_offsets,
+        count);
 }
 
 template <typename T>
@@ -1127,10 +1315,17 @@ ChunkedSegmentSealedImpl::bulk_subscript_impl(int64_t element_sizeof,
                                               int64_t count,
                                               void* dst_raw) {
     auto dst_vec = reinterpret_cast<char*>(dst_raw);
-    field->BulkValueAt(
-        [&](const char* value, size_t i) {
-            auto dst = dst_vec + i * element_sizeof;
-            memcpy(dst, value, element_sizeof);
+    field->BulkChunkAt(
+        [&](const Chunk* chunk,
+            const int64_t* offsets_in_chunk,
+            const int64_t* indices,
+            int64_t n) {
+            auto src = chunk->Data();
+            for (int64_t j = 0; j < n; ++j) {
+                memcpy(dst_vec + indices[j] * element_sizeof,
+                       src + offsets_in_chunk[j] * element_sizeof,
+                       element_sizeof);
+            }
         },
         seg_offsets,
         count);
@@ -1608,33 +1803,26 @@ ChunkedSegmentSealedImpl::search_ids(const IdArray& id_array,
     auto res_id_arr = std::make_unique<IdArray>();
     std::vector<SegOffset> res_offsets;
     res_offsets.reserve(pks.size());
-    for (auto& pk : pks) {
-        std::vector<SegOffset> pk_offsets;
-        if (!is_sorted_by_pk_) {
-            pk_offsets = insert_record_.search_pk(pk, timestamp);
-        } else {
-            pk_offsets = search_pk(pk, timestamp);
-        }
-        for (auto offset : pk_offsets) {
-            switch (data_type) {
-                case DataType::INT64: {
-                    res_id_arr->mutable_int_id()->add_data(
-                        std::get<int64_t>(pk));
-                    break;
-                }
-                case DataType::VARCHAR: {
-                    res_id_arr->mutable_str_id()->add_data(
-                        std::get<std::string>(std::move(pk)));
-                    break;
-                }
-                default: {
-                    PanicInfo(DataTypeInvalid,
-                              fmt::format("unsupported type {}", data_type));
-                }
+    std::vector<Timestamp> timestamps(pks.size(), timestamp);
+    search_pks(pks, timestamps.data(), [&](size_t i, SegOffset offset) {
+        auto& pk = pks[i];
+        switch (data_type) {
+            case DataType::INT64: {
+                res_id_arr->mutable_int_id()->add_data(std::get<int64_t>(pk));
+                break;
+            }
+            case DataType::VARCHAR: {
+                res_id_arr->mutable_str_id()->add_data(
+                    std::get<std::string>(pk));
+                break;
+            }
+            default: {
+                PanicInfo(DataTypeInvalid,
+                          fmt::format("unsupported type {}", data_type));
             }
-            res_offsets.push_back(offset);
         }
-    }
+        res_offsets.push_back(offset);
+    });
     return {std::move(res_id_arr), std::move(res_offsets)};
 }
 
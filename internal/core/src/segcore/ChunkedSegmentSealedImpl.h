@@ -172,6 +172,14 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
     std::vector<SegOffset>
     search_sorted_pk(const PkType& pk, Condition condition) const;
 
+    // Batched search_pk, sorts the pks once and merge joins them with the
+    // chunks of a pk sorted segment. Calls `callback(i, offset)` for every row
+    // whose pk equals pks[i] and that was inserted no later than timestamps[i].
+    void
+    search_pks(const std::vector<PkType>& pks,
+               const Timestamp* timestamps,
+               const std::function<void(size_t, SegOffset)>& callback) const;
+
     std::unique_ptr<DataArray>
     get_vector(FieldId field_id,
                const int64_t* ids,
@@ -209,6 +217,15 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
     std::pair<int64_t, int64_t>
     get_chunk_by_offset(FieldId field_id, int64_t offset) const override;
 
+    std::unique_ptr<ReadAheadHandle>
+    read_ahead_chunks(FieldId field_id,
+                      std::vector<int64_t> chunk_ids) const override;
+
+    PinWrapper<const JsonShadowColumn*>
+    GetJsonShadowColumn(FieldId field_id,
+                        int64_t chunk_id,
+                        const std::string& pointer) const override;
+
     int64_t
     num_rows_until_chunk(FieldId field_id, int64_t chunk_id) const override;
 
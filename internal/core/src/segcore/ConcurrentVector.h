@@ -14,9 +14,11 @@
 #include <fmt/core.h>
 #include <tbb/concurrent_vector.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <deque>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
@@ -36,67 +38,189 @@
 
 namespace milvus::segcore {
 
+// Bit packed validity of the rows of a nullable field of a growing segment.
+// It follows the protocol of ConcurrentVector: writers fill the rows reserved
+// for them, at any offset and concurrently, and readers only access rows
+// below the ack of the segment, so reads take no lock.
 class ThreadSafeValidData {
  public:
-    explicit ThreadSafeValidData() = default;
-    explicit ThreadSafeValidData(FixedVector<bool> data)
-        : data_(std::move(data)) {
+    static constexpr int64_t kRowsPerChunk = int64_t(1) << 16;
+
+    // growing segments chunk validity by the rows of their column chunks, so
+    // the validity of a column chunk is contiguous words.
+    explicit ThreadSafeValidData(int64_t rows_per_chunk = kRowsPerChunk)
+        : rows_per_chunk_(rows_per_chunk),
+          words_per_chunk_((rows_per_chunk + 63) / 64) {
+        AssertInfo(rows_per_chunk > 0,
+                   "invalid rows per chunk {} of valid data",
+                   rows_per_chunk);
     }
 
     void
-    set_data_raw(const std::vector<FieldDataPtr>& datas) {
-        std::unique_lock<std::shared_mutex> lck(mutex_);
-        auto total = 0;
-        for (auto& field_data : datas) {
-            total += field_data->get_num_rows();
-        }
-        if (length_ + total > data_.size()) {
-            data_.resize(length_ + total);
-        }
-
+    set_data_raw(ssize_t element_offset,
+                 const std::vector<FieldDataPtr>& datas) {
         for (auto& field_data : datas) {
             auto num_row = field_data->get_num_rows();
-            for (size_t i = 0; i < num_row; i++) {
-                data_[length_ + i] = field_data->is_valid(i);
-            }
-            length_ += num_row;
+            set_bits(element_offset, num_row, [&](int64_t i) {
+                return field_data->is_valid(i);
+            });
+            element_offset += num_row;
         }
     }
 
     void
-    set_data_raw(size_t num_rows,
+    set_data_raw(ssize_t element_offset,
+                 size_t num_rows,
                  const DataArray* data,
                  const FieldMeta& field_meta) {
-        std::unique_lock<std::shared_mutex> lck(mutex_);
         if (field_meta.is_nullable()) {
-            if (length_ + num_rows > data_.size()) {
-                data_.resize(length_ + num_rows);
-            }
             auto src = data->valid_data().data();
-            std::copy_n(src, num_rows, data_.data() + length_);
-            length_ += num_rows;
+            set_bits(element_offset, num_rows, [&](int64_t i) {
+                return src[i];
+            });
         }
     }
 
     bool
-    is_valid(size_t offset) {
-        std::shared_lock<std::shared_mutex> lck(mutex_);
-        Assert(offset < length_);
-        return data_[offset];
+    is_valid(size_t offset) const {
+        auto pos = int64_t(offset) % rows_per_chunk_;
+        auto word = load_word(int64_t(offset) / rows_per_chunk_, pos >> 6);
+        return (word >> (pos & 63)) & 1;
+    }
+
+    // unpacks the validity of rows [offset, offset + count) into `dst`.
+    void
+    get_valid(int64_t offset, int64_t count, bool* dst) const {
+        int64_t done = 0;
+        while (done < count) {
+            auto row = offset + done;
+            auto pos = row % rows_per_chunk_;
+            auto bit = pos & 63;
+            auto n = std::min<int64_t>(
+                {count - done, 64 - bit, rows_per_chunk_ - pos});
+            auto word = load_word(row / rows_per_chunk_, pos >> 6) >> bit;
+            for (int64_t i = 0; i < n; ++i) {
+                dst[done + i] = (word >> i) & 1;
+            }
+            done += n;
+        }
+    }
+
+    // ands the validity of rows [offset, offset + count) into `dst` a block of
+    // words at a time.
+    void
+    and_valid(int64_t offset, int64_t count, TargetBitmapView dst) const {
+        constexpr int64_t kBlockWords = 16;
+        uint64_t block[kBlockWords];
+        int64_t done = 0;
+        while (done < count) {
+            auto row = offset + done;
+            auto pos = row % rows_per_chunk_;
+            auto bit = pos & 63;
+            auto n = std::min<int64_t>({count - done,
+                                        kBlockWords * 64 - bit,
+                                        rows_per_chunk_ - pos});
+            auto num_words = (bit + n + 63) >> 6;
+            for (int64_t i = 0; i < num_words; ++i) {
+                block[i] = load_word(row / rows_per_chunk_, (pos >> 6) + i);
+            }
+            TargetBitmapView src(block, bit, n);
+            dst.view(done, n).inplace_and(src, n);
+            done += n;
+        }
     }
 
-    bool*
-    get_chunk_data(size_t offset) {
-        std::shared_lock<std::shared_mutex> lck(mutex_);
-        Assert(offset < length_);
-        return &data_[offset];
+    // the words holding the validity of rows [offset, offset + count), which
+    // must lie in one chunk, and the bit of row `offset` in them. The bits of
+    // acked rows are not written any more, thus they can be read in place.
+    std::pair<const uint64_t*, int64_t>
+    get_bitmap(int64_t offset, int64_t count) const {
+        auto chunk_id = offset / rows_per_chunk_;
+        auto pos = offset % rows_per_chunk_;
+        AssertInfo(pos + count <= rows_per_chunk_,
+                   "valid data rows [{}, {}) span over chunks of {} rows",
+                   offset,
+                   offset + count,
+                   rows_per_chunk_);
+        AssertInfo(chunk_id < num_chunks_.load(std::memory_order_acquire),
+                   "valid data offset {} out of capacity {}",
+                   offset,
+                   capacity());
+        static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t) &&
+                      std::atomic<uint64_t>::is_always_lock_free);
+        auto words = reinterpret_cast<const uint64_t*>(chunks_[chunk_id].get());
+        return {words + (pos >> 6), pos & 63};
+    }
+
+    int64_t
+    capacity() const {
+        return num_chunks_.load(std::memory_order_acquire) * rows_per_chunk_;
     }
 
  private:
-    mutable std::shared_mutex mutex_{};
-    FixedVector<bool> data_;
-    // number of actual elements
-    size_t length_{0};
+    using WordChunk = std::unique_ptr<std::atomic<uint64_t>[]>;
+
+    uint64_t
+    load_word(int64_t chunk_id, int64_t word_idx) const {
+        AssertInfo(chunk_id < num_chunks_.load(std::memory_order_acquire),
+                   "valid data offset {} out of capacity {}",
+                   chunk_id * rows_per_chunk_ + word_idx * 64,
+                   capacity());
+        // the rows are published by the ack of the segment, relaxed is enough
+        return chunks_[chunk_id][word_idx].load(std::memory_order_relaxed);
+    }
+
+    // allocates zeroed chunks, i.e. null rows, until `num_rows` rows fit.
+    void
+    reserve(int64_t num_rows) {
+        auto num_chunks = (num_rows + rows_per_chunk_ - 1) / rows_per_chunk_;
+        if (num_chunks_.load(std::memory_order_acquire) >= num_chunks) {
+            return;
+        }
+        std::lock_guard<std::mutex> lck(grow_mutex_);
+        while (static_cast<int64_t>(chunks_.size()) < num_chunks) {
+            chunks_.emplace_back(
+                new std::atomic<uint64_t>[words_per_chunk_]());
+        }
+        num_chunks_.store(chunks_.size(), std::memory_order_release);
+    }
+
+    template <typename Getter>
+    void
+    set_bits(int64_t offset, int64_t count, Getter&& get) {
+        reserve(offset + count);
+        int64_t done = 0;
+        while (done < count) {
+            auto row = offset + done;
+            auto pos = row % rows_per_chunk_;
+            auto bit = pos & 63;
+            auto n = std::min<int64_t>(
+                {count - done, 64 - bit, rows_per_chunk_ - pos});
+            uint64_t value = 0;
+            for (int64_t i = 0; i < n; ++i) {
+                value |= uint64_t(get(done + i) ? 1 : 0) << (bit + i);
+            }
+            auto& word = chunks_[row / rows_per_chunk_][pos >> 6];
+            if (n == 64) {
+                word.store(value, std::memory_order_relaxed);
+            } else {
+                // other inserts may be filling the rest of a partial word
+                auto mask = ((uint64_t(1) << n) - 1) << bit;
+                word.fetch_and(~mask | value, std::memory_order_relaxed);
+                word.fetch_or(value, std::memory_order_relaxed);
+            }
+            done += n;
+        }
+    }
+
+    const int64_t rows_per_chunk_;
+    const int64_t words_per_chunk_;
+    // chunks are never moved or freed once allocated, tbb keeps the elements
+    // in place when growing, only growing is serialized.
+    tbb::concurrent_vector<WordChunk> chunks_;
+    // number of fully constructed chunks
+    std::atomic<int64_t> num_chunks_{0};
+    std::mutex grow_mutex_;
 };
 using ThreadSafeValidDataPtr = std::shared_ptr<ThreadSafeValidData>;
 
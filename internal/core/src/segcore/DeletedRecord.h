@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -18,6 +20,7 @@
 #include <utility>
 #include <vector>
 #include <folly/ConcurrentSkipList.h>
+#include <roaring/roaring.hh>
 
 #include "AckResponder.h"
 #include "common/Schema.h"
@@ -47,17 +50,37 @@ using SortedDeleteList =
     folly::ConcurrentSkipList<std::pair<Timestamp, Offset>, Comparator>;
 
 static int32_t DUMP_BATCH_SIZE = 10000;
+// records of a delta bucket, DUMP_BATCH_SIZE must be a multiple of it
+static int32_t DELETE_BUCKET_SIZE = 1000;
 static int32_t DELETE_PAIR_SIZE = sizeof(std::pair<Timestamp, Offset>);
 
+// Rows deleted in a range of the sorted delete list, all records with
+// timestamp <= max_ts_ are before next_iter_.
+struct DeleteBucket {
+    Timestamp max_ts_{0};
+    roaring::Roaring rows_;
+    int64_t count_{0};
+    SortedDeleteList::iterator next_iter_;
+};
+
+// Batched pk lookup, calls `callback(i, offset)` for every row whose pk equals
+// pks[i] and that was inserted no later than timestamps[i].
+using SearchPksFunc = std::function<void(
+    const std::vector<PkType>& pks,
+    const Timestamp* timestamps,
+    const std::function<void(size_t, SegOffset)>& callback)>;
+
 template <bool is_sealed = false>
 class DeletedRecord {
  public:
     DeletedRecord(InsertRecord<is_sealed>* insert_record,
                   std::function<std::vector<SegOffset>(
                       const PkType& pk, Timestamp timestamp)> search_pk_func,
-                  int64_t segment_id)
+                  int64_t segment_id,
+                  SearchPksFunc search_pks_func = nullptr)
         : insert_record_(insert_record),
           search_pk_func_(search_pk_func),
+          search_pks_func_(std::move(search_pks_func)),
           segment_id_(segment_id),
           deleted_lists_(SortedDeleteList::createInstance()) {
     }
@@ -108,36 +131,43 @@ class DeletedRecord {
         Timestamp max_timestamp = 0;
 
         SortedDeleteList::Accessor accessor(deleted_lists_);
-        for (size_t i = 0; i < pks.size(); ++i) {
-            auto deleted_pk = pks[i];
+        auto push = [&](size_t i, SegOffset offset) {
             auto deleted_ts = timestamps[i];
-            if (deleted_ts > max_timestamp) {
-                max_timestamp = deleted_ts;
+            auto row_id = offset.get();
+            // if alreay deleted, no need to add new record
+            if (deleted_mask_.size() > row_id && deleted_mask_[row_id]) {
+                return;
             }
-            std::vector<SegOffset> offsets =
-                search_pk_func_(deleted_pk, deleted_ts);
-            for (auto& offset : offsets) {
-                auto row_id = offset.get();
-                // if alreay deleted, no need to add new record
-                if (deleted_mask_.size() > row_id && deleted_mask_[row_id]) {
-                    continue;
-                }
-                // if insert record and delete record is same timestamp,
-                // delete not take effect on this record.
-                if (deleted_ts == insert_record_->timestamps_[row_id]) {
-                    continue;
-                }
-                accessor.insert(std::make_pair(deleted_ts, row_id));
-                if constexpr (is_sealed) {
-                    Assert(deleted_mask_.size() > 0);
-                    deleted_mask_.set(row_id);
-                } else {
-                    // need to add mask size firstly for growing segment
-                    deleted_mask_.resize(insert_record_->size());
-                    deleted_mask_.set(row_id);
+            // if insert record and delete record is same timestamp,
+            // delete not take effect on this record.
+            if (deleted_ts == insert_record_->timestamps_[row_id]) {
+                return;
+            }
+            accessor.insert(std::make_pair(deleted_ts, row_id));
+            if constexpr (is_sealed) {
+                Assert(deleted_mask_.size() > 0);
+                deleted_mask_.set(row_id);
+            } else {
+                // need to add mask size firstly for growing segment
+                deleted_mask_.resize(insert_record_->size());
+                deleted_mask_.set(row_id);
+            }
+            removed_num++;
+            mem_add += DELETE_PAIR_SIZE;
+        };
+
+        for (size_t i = 0; i < pks.size(); ++i) {
+            max_timestamp = std::max(max_timestamp, timestamps[i]);
+        }
+        if (search_pks_func_ != nullptr) {
+            // the offsets of a pk are visited in ascending order, and the
+            // duplicates of a pk in their order in the batch
+            search_pks_func_(pks, timestamps, push);
+        } else {
+            for (size_t i = 0; i < pks.size(); ++i) {
+                for (auto& offset : search_pk_func_(pks[i], timestamps[i])) {
+                    push(i, offset);
                 }
-                removed_num++;
-                mem_add += DELETE_PAIR_SIZE;
             }
         }
 
@@ -162,48 +192,42 @@ class DeletedRecord {
         SortedDeleteList::iterator next_iter;
         {
             std::shared_lock<std::shared_mutex> lock(snap_lock_);
-            // find last meeted snapshot
-            if (!snapshots_.empty()) {
-                int loc = snapshots_.size() - 1;
-                while (snapshots_[loc].first > query_timestamp && loc >= 0) {
-                    loc--;
-                }
-                if (loc >= 0) {
-                    next_iter = snap_next_iter_[loc];
+            size_t hit_checkpoints = 0;
+            while (hit_checkpoints < checkpoints_.size() &&
+                   checkpoints_[hit_checkpoints].max_ts_ <= query_timestamp) {
+                hit_checkpoints++;
+            }
+            if (hit_checkpoints == checkpoints_.size()) {
+                // newer than the last checkpoint, start from its dense bitmap
+                // and the recent delta buckets
+                if (hit_checkpoints > 0) {
                     auto or_size =
-                        std::min(snapshots_[loc].second.size(), bitset.size());
-                    bitset.inplace_or_with_count(snapshots_[loc].second,
-                                                 or_size);
+                        std::min(checkpoint_bits_.size(), bitset.size());
+                    bitset.inplace_or_with_count(checkpoint_bits_, or_size);
+                    next_iter = checkpoints_.back().next_iter_;
                     hit_snapshot = true;
                 }
-            }
-        }
-
-        auto start_iter = hit_snapshot ? next_iter : accessor.begin();
-        auto end_iter =
-            accessor.lower_bound(std::make_pair(query_timestamp, 0));
-
-        auto it = start_iter;
-
-        // when end_iter point to skiplist end, concurrent delete may append new value
-        // after lower_bound() called, so end_iter is not logical valid.
-        if (end_iter == accessor.end()) {
-            while (it != accessor.end() && it->first <= query_timestamp) {
-                if (it->second < insert_barrier) {
-                    bitset.set(it->second);
+                for (auto& bucket : buckets_) {
+                    if (bucket.max_ts_ > query_timestamp) {
+                        break;
+                    }
+                    ApplyBucket(bucket, bitset, insert_barrier);
+                    next_iter = bucket.next_iter_;
+                    hit_snapshot = true;
+                }
+            } else {
+                // older than the last checkpoint, replay the compacted deltas
+                for (size_t i = 0; i < hit_checkpoints; ++i) {
+                    ApplyBucket(checkpoints_[i], bitset, insert_barrier);
+                    next_iter = checkpoints_[i].next_iter_;
+                    hit_snapshot = true;
                 }
-                it++;
             }
-            return;
         }
 
-        while (it != accessor.end() && it != end_iter) {
-            if (it->second < insert_barrier) {
-                bitset.set(it->second);
-            }
-            it++;
-        }
-        while (it != accessor.end() && it->first == query_timestamp) {
+        // records are sorted by timestamp, stop at the first newer one
+        auto it = hit_snapshot ? next_iter : accessor.begin();
+        while (it != accessor.end() && it->first <= query_timestamp) {
             if (it->second < insert_barrier) {
                 bitset.set(it->second);
             }
@@ -211,83 +235,84 @@ class DeletedRecord {
         }
     }
 
+    // memory of the dumped snapshots in bits
     size_t
     GetSnapshotBitsSize() const {
-        auto all_dump_bits = 0;
-        auto next_dump_ts = 0;
         std::shared_lock<std::shared_mutex> lock(snap_lock_);
-        int loc = snapshots_.size() - 1;
-        while (loc >= 0) {
-            if (next_dump_ts != snapshots_[loc].first) {
-                all_dump_bits += snapshots_[loc].second.size();
-            }
-            loc--;
+        size_t all_dump_bits = checkpoint_bits_.size();
+        for (auto& bucket : checkpoints_) {
+            all_dump_bits += bucket.rows_.getSizeInBytes() * 8;
+        }
+        for (auto& bucket : buckets_) {
+            all_dump_bits += bucket.rows_.getSizeInBytes() * 8;
         }
         return all_dump_bits;
     }
 
+    // Snapshots are kept in two levels. The delete list is cut into delta
+    // buckets of DELETE_BUCKET_SIZE records, each a roaring bitmap of the rows
+    // deleted within it. Once DUMP_BATCH_SIZE records are bucketed, the
+    // buckets are compacted into a single delta of a checkpoint, and the
+    // dense bitmap of all rows deleted up to the last checkpoint is advanced.
+    // A query ors the dense bitmap and a few recent buckets, and only walks
+    // the records after the last bucket it covers.
     void
     DumpSnapshot() {
         SortedDeleteList::Accessor accessor(deleted_lists_);
-        int total_size = accessor.size();
-        int dumped_size = snapshots_.empty() ? 0 : GetSnapshotBitsSize();
-
-        while (total_size - dumped_size > DUMP_BATCH_SIZE) {
-            int32_t bitsize = 0;
-            if constexpr (is_sealed) {
-                bitsize = sealed_row_count_;
-            } else {
-                bitsize = insert_record_->size();
-            }
-            BitsetType bitmap(bitsize, false);
-
-            auto it = accessor.begin();
-            Timestamp last_dump_ts = 0;
-            if (!snapshots_.empty()) {
-                it = snap_next_iter_.back();
-                last_dump_ts = snapshots_.back().first;
-                bitmap.inplace_or_with_count(snapshots_.back().second,
-                                             snapshots_.back().second.size());
-            }
-
-            while (total_size - dumped_size > DUMP_BATCH_SIZE &&
-                   it != accessor.end()) {
-                Timestamp dump_ts = 0;
 
-                for (auto size = 0; size < DUMP_BATCH_SIZE; ++it, ++size) {
-                    bitmap.set(it->second);
-                    if (size == DUMP_BATCH_SIZE - 1) {
-                        dump_ts = it->first;
-                    }
-                }
+        int64_t bucketed_size = 0;
+        for (auto& bucket : buckets_) {
+            bucketed_size += bucket.count_;
+        }
 
-                {
-                    std::unique_lock<std::shared_mutex> lock(snap_lock_);
-                    if (dump_ts == last_dump_ts) {
-                        // only update
-                        snapshots_.back().second = std::move(bitmap.clone());
-                        snap_next_iter_.back() = it;
-                    } else {
-                        // add new snapshot
-                        snapshots_.push_back(
-                            std::make_pair(dump_ts, bitmap.clone()));
-                        Assert(it != accessor.end() && it.good());
-                        snap_next_iter_.push_back(it);
-                    }
+        // resume after the last record taken into a bucket, so that every
+        // record is scanned once.
+        auto it = accessor.begin();
+        if (has_last_bucketed_) {
+            it = last_bucketed_;
+            ++it;
+        }
 
-                    LOG_INFO(
-                        "dump delete record snapshot at ts: {}, cursor: {}, "
-                        "total size:{} "
-                        "current snapshot size: {} for segment: {}",
-                        dump_ts,
-                        dumped_size + DUMP_BATCH_SIZE,
-                        total_size,
-                        snapshots_.size(),
-                        segment_id_);
-                    last_dump_ts = dump_ts;
-                }
+        while (it != accessor.end()) {
+            // records of the same timestamp never span two buckets, so that a
+            // bucket covers every record up to its max timestamp. Later pushes
+            // may still add records of the last timestamp, thus they are only
+            // taken once a newer record follows them.
+            auto ts = it->first;
+            auto group_end = it;
+            while (group_end != accessor.end() && group_end->first == ts) {
+                ++group_end;
+            }
+            if (group_end == accessor.end()) {
+                break;
+            }
+            for (; it != group_end; ++it) {
+                pending_.rows_.add(it->second);
+                pending_.count_++;
+                last_bucketed_ = it;
+                has_last_bucketed_ = true;
+            }
+            pending_.max_ts_ = ts;
+            if (pending_.count_ < DELETE_BUCKET_SIZE) {
+                continue;
+            }
 
-                dumped_size += DUMP_BATCH_SIZE;
+            Assert(it.good());
+            DeleteBucket bucket = std::move(pending_);
+            pending_ = DeleteBucket();
+            bucket.next_iter_ = it;
+            bucket.rows_.runOptimize();
+            bucket.rows_.shrinkToFit();
+
+            bucketed_size += bucket.count_;
+            {
+                std::unique_lock<std::shared_mutex> lock(snap_lock_);
+                dumped_size_ += bucket.count_;
+                buckets_.push_back(std::move(bucket));
+            }
+            if (bucketed_size >= DUMP_BATCH_SIZE) {
+                CompactBuckets();
+                bucketed_size = 0;
             }
         }
     }
@@ -309,22 +334,85 @@ class DeletedRecord {
         deleted_mask_.resize(row_count);
     }
 
+    // dense bitmaps of the rows deleted up to every checkpoint
     std::vector<std::pair<Timestamp, BitsetType>>
     get_snapshots() const {
         std::shared_lock<std::shared_mutex> lock(snap_lock_);
         std::vector<std::pair<Timestamp, BitsetType>> snapshots;
-        for (const auto& snap : snapshots_) {
-            snapshots.emplace_back(snap.first, snap.second.clone());
+        BitsetType bitmap(checkpoint_bits_.size(), false);
+        for (const auto& checkpoint : checkpoints_) {
+            for (auto row_id : checkpoint.rows_) {
+                bitmap.set(row_id);
+            }
+            snapshots.emplace_back(checkpoint.max_ts_, bitmap.clone());
         }
         return snapshots;
     }
 
+ private:
+    static void
+    ApplyBucket(const DeleteBucket& bucket,
+                BitsetTypeView& bitset,
+                int64_t insert_barrier) {
+        for (auto row_id : bucket.rows_) {
+            if (row_id >= insert_barrier) {
+                break;
+            }
+            bitset.set(row_id);
+        }
+    }
+
+    // merges the delta buckets into a new checkpoint
+    void
+    CompactBuckets() {
+        DeleteBucket checkpoint;
+        std::vector<const roaring::Roaring*> deltas;
+        for (auto& bucket : buckets_) {
+            deltas.push_back(&bucket.rows_);
+            checkpoint.count_ += bucket.count_;
+        }
+        checkpoint.rows_ =
+            roaring::Roaring::fastunion(deltas.size(), deltas.data());
+        checkpoint.rows_.runOptimize();
+        checkpoint.rows_.shrinkToFit();
+        checkpoint.max_ts_ = buckets_.back().max_ts_;
+        checkpoint.next_iter_ = buckets_.back().next_iter_;
+
+        int64_t bitsize = 0;
+        if constexpr (is_sealed) {
+            bitsize = sealed_row_count_;
+        } else {
+            bitsize = insert_record_->size();
+        }
+        bitsize = std::max<int64_t>(bitsize, checkpoint.rows_.maximum() + 1);
+        bitsize = std::max<int64_t>(bitsize, checkpoint_bits_.size());
+        BitsetType bitmap(bitsize, false);
+        bitmap.inplace_or_with_count(checkpoint_bits_,
+                                     checkpoint_bits_.size());
+        for (auto row_id : checkpoint.rows_) {
+            bitmap.set(row_id);
+        }
+
+        std::unique_lock<std::shared_mutex> lock(snap_lock_);
+        LOG_INFO(
+            "dump delete record snapshot at ts: {}, cursor: {}, "
+            "current snapshot size: {} for segment: {}",
+            checkpoint.max_ts_,
+            dumped_size_,
+            checkpoints_.size() + 1,
+            segment_id_);
+        checkpoint_bits_ = std::move(bitmap);
+        checkpoints_.push_back(std::move(checkpoint));
+        buckets_.clear();
+    }
+
  public:
     std::atomic<int64_t> n_ = 0;
     std::atomic<int64_t> mem_size_ = 0;
     InsertRecord<is_sealed>* insert_record_;
     std::function<std::vector<SegOffset>(const PkType& pk, Timestamp timestamp)>
         search_pk_func_;
+    SearchPksFunc search_pks_func_;
     int64_t segment_id_{0};
     std::shared_ptr<SortedDeleteList> deleted_lists_;
     // max timestamp of deleted records which replayed in load process
@@ -335,9 +423,19 @@ class DeletedRecord {
 
     // dump snapshot low frequency
     mutable std::shared_mutex snap_lock_;
-    std::vector<std::pair<Timestamp, BitsetType>> snapshots_;
-    // next delete record iterator that follows every snapshot
-    std::vector<SortedDeleteList::iterator> snap_next_iter_;
+    // number of delete records covered by checkpoints_ and buckets_
+    int64_t dumped_size_{0};
+    // rows deleted up to the last checkpoint
+    BitsetType checkpoint_bits_;
+    // delta of every checkpoint against the previous one
+    std::vector<DeleteBucket> checkpoints_;
+    // delta buckets after the last checkpoint
+    std::vector<DeleteBucket> buckets_;
+    // bucket being filled by DumpSnapshot, not visible to queries yet
+    DeleteBucket pending_;
+    // last record taken into pending_ or buckets_
+    SortedDeleteList::iterator last_bucketed_;
+    bool has_last_bucketed_{false};
 };
 
 }  // namespace milvus::segcore
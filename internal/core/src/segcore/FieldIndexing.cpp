@@ -14,8 +14,6 @@
 
 #include "common/EasyAssert.h"
 #include "fmt/format.h"
-#include "index/ScalarIndexSort.h"
-#include "index/StringIndexSort.h"
 
 #include "common/SystemProperty.h"
 #include "segcore/FieldIndexing.h"
@@ -366,6 +364,19 @@ VectorFieldIndexing::has_raw_data() const {
     return index_->HasRawData();
 }
 
+template <typename T>
+ScalarFieldIndexing<T>::ScalarFieldIndexing(
+    const FieldMeta& field_meta,
+    const SegcoreConfig& segcore_config,
+    const VectorBase* field_raw_data,
+    ThreadSafeValidDataPtr valid_data)
+    : FieldIndexing(field_meta, segcore_config) {
+    auto source = dynamic_cast<const ConcurrentVector<T>*>(field_raw_data);
+    AssertInfo(source, "field_raw_data can't cast to ConcurrentVector type");
+    index_ = std::make_unique<InterimScalarIndex<T>>(source,
+                                                     std::move(valid_data));
+}
+
 template <typename T>
 void
 ScalarFieldIndexing<T>::BuildIndexRange(int64_t ack_beg,
@@ -375,26 +386,17 @@ ScalarFieldIndexing<T>::BuildIndexRange(int64_t ack_beg,
     AssertInfo(source, "vec_base can't cast to ConcurrentVector type");
     auto num_chunk = source->num_chunk();
     AssertInfo(ack_end <= num_chunk, "Ack_end is bigger than num_chunk");
-    data_.grow_to_at_least(ack_end);
-    for (int chunk_id = ack_beg; chunk_id < ack_end; chunk_id++) {
-        auto chunk_data = source->get_chunk_data(chunk_id);
-        // build index for chunk
-        // seem no lint, not pass valid_data here
-        // TODO
-        if constexpr (std::is_same_v<T, std::string>) {
-            auto indexing = index::CreateStringIndexSort();
-            indexing->Build(vec_base->get_size_per_chunk(),
-                            static_cast<const T*>(chunk_data));
-            data_[chunk_id] = std::move(indexing);
-        } else {
-            auto indexing = index::CreateScalarIndexSort<T>();
-            indexing->Build(vec_base->get_size_per_chunk(),
-                            static_cast<const T*>(chunk_data));
-            data_[chunk_id] = std::move(indexing);
-        }
-    }
+    auto size_per_chunk = source->get_size_per_chunk();
+    index_->Append(ack_beg * size_per_chunk,
+                   (ack_end - ack_beg) * size_per_chunk);
 }
 
+template class ScalarFieldIndexing<int8_t>;
+template class ScalarFieldIndexing<int16_t>;
+template class ScalarFieldIndexing<int32_t>;
+template class ScalarFieldIndexing<int64_t>;
+template class ScalarFieldIndexing<std::string>;
+
 std::unique_ptr<FieldIndexing>
 CreateIndex(const FieldMeta& field_meta,
             const FieldIndexMeta& field_index_meta,
@@ -418,31 +420,32 @@ CreateIndex(const FieldMeta& field_meta,
                                   field_meta.get_data_type()));
         }
     }
+    PanicInfo(DataTypeInvalid,
+              fmt::format("unsupported scalar type in vector index: {}",
+                          field_meta.get_data_type()));
+}
+
+std::unique_ptr<FieldIndexing>
+CreateScalarIndex(const FieldMeta& field_meta,
+                  const SegcoreConfig& segcore_config,
+                  const VectorBase* field_raw_data,
+                  ThreadSafeValidDataPtr valid_data) {
     switch (field_meta.get_data_type()) {
-        case DataType::BOOL:
-            return std::make_unique<ScalarFieldIndexing<bool>>(field_meta,
-                                                               segcore_config);
         case DataType::INT8:
             return std::make_unique<ScalarFieldIndexing<int8_t>>(
-                field_meta, segcore_config);
+                field_meta, segcore_config, field_raw_data, valid_data);
         case DataType::INT16:
             return std::make_unique<ScalarFieldIndexing<int16_t>>(
-                field_meta, segcore_config);
+                field_meta, segcore_config, field_raw_data, valid_data);
         case DataType::INT32:
             return std::make_unique<ScalarFieldIndexing<int32_t>>(
-                field_meta, segcore_config);
+                field_meta, segcore_config, field_raw_data, valid_data);
         case DataType::INT64:
             return std::make_unique<ScalarFieldIndexing<int64_t>>(
-                field_meta, segcore_config);
-        case DataType::FLOAT:
-            return std::make_unique<ScalarFieldIndexing<float>>(field_meta,
-                                                                segcore_config);
-        case DataType::DOUBLE:
-            return std::make_unique<ScalarFieldIndexing<double>>(
-                field_meta, segcore_config);
+                field_meta, segcore_config, field_raw_data, valid_data);
         case DataType::VARCHAR:
             return std::make_unique<ScalarFieldIndexing<std::string>>(
-                field_meta, segcore_config);
+                field_meta, segcore_config, field_raw_data, valid_data);
         default:
             PanicInfo(DataTypeInvalid,
                       fmt::format("unsupported scalar type in index: {}",
@@ -30,6 +30,7 @@
 #include "log/Log.h"
 #include "segcore/SegcoreConfig.h"
 #include "segcore/InsertRecord.h"
+#include "segcore/InterimScalarIndex.h"
 #include "index/VectorIndex.h"
 
 namespace milvus::segcore {
@@ -67,6 +68,14 @@ class FieldIndexing {
                              const VectorBase* vec_base,
                              const void* data_source) = 0;
 
+    // rows [reserved_offset, reserved_offset + size) of the raw data have
+    // been written
+    virtual void
+    AppendSegmentIndexScalar(int64_t reserved_offset, int64_t size) {
+        PanicInfo(Unsupported,
+                  "vector index doesn't support append scalar segment index");
+    }
+
     virtual void
     GetDataFromIndex(const int64_t* seg_offsets,
                      int64_t count,
@@ -109,7 +118,10 @@ class FieldIndexing {
 template <typename T>
 class ScalarFieldIndexing : public FieldIndexing {
  public:
-    using FieldIndexing::FieldIndexing;
+    explicit ScalarFieldIndexing(const FieldMeta& field_meta,
+                                 const SegcoreConfig& segcore_config,
+                                 const VectorBase* field_raw_data,
+                                 ThreadSafeValidDataPtr valid_data);
 
     void
     BuildIndexRange(int64_t ack_beg,
@@ -135,6 +147,11 @@ class ScalarFieldIndexing : public FieldIndexing {
                   "scalar index doesn't support append vector segment index");
     }
 
+    void
+    AppendSegmentIndexScalar(int64_t reserved_offset, int64_t size) override {
+        index_->Append(reserved_offset, size);
+    }
+
     void
     GetDataFromIndex(const int64_t* seg_offsets,
                      int64_t count,
@@ -151,23 +168,33 @@ class ScalarFieldIndexing : public FieldIndexing {
 
     bool
     sync_data_with_index() const override {
+        return index_->Synced();
+    }
+
+    // the interim index reads the rows from the insert record, which keeps
+    // holding the raw data
+    bool
+    has_raw_data() const override {
         return false;
     }
 
-    // concurrent
+    // concurrent, the index covers the whole segment in chunk 0
     PinWrapper<index::IndexBase*>
     get_chunk_indexing(int64_t chunk_id) const override {
         Assert(!field_meta_.is_vector());
-        return data_.at(chunk_id).get();
+        AssertInfo(chunk_id == 0,
+                   "interim scalar index has only one chunk, got {}",
+                   chunk_id);
+        return PinWrapper<index::IndexBase*>(index_.get());
     }
 
     PinWrapper<index::IndexBase*>
     get_segment_indexing() const override {
-        return nullptr;
+        return PinWrapper<index::IndexBase*>(index_.get());
     }
 
  private:
-    tbb::concurrent_vector<index::ScalarIndexPtr<T>> data_;
+    std::unique_ptr<InterimScalarIndex<T>> index_;
 };
 
 class VectorFieldIndexing : public FieldIndexing {
@@ -258,6 +285,14 @@ CreateIndex(const FieldMeta& field_meta,
             const SegcoreConfig& segcore_config,
             const VectorBase* field_raw_data = nullptr);
 
+// interim index of an integer or VARCHAR field of a growing segment, see
+// InterimScalarIndex
+std::unique_ptr<FieldIndexing>
+CreateScalarIndex(const FieldMeta& field_meta,
+                  const SegcoreConfig& segcore_config,
+                  const VectorBase* field_raw_data,
+                  ThreadSafeValidDataPtr valid_data);
+
 class IndexingRecord {
  public:
     explicit IndexingRecord(const Schema& schema,
@@ -308,6 +343,24 @@ class IndexingRecord {
                                         field_raw_data));
                     }
                 }
+            } else if (IsInterimScalarIndexDataType(
+                           field_meta.get_data_type()) &&
+                       field_id.get() >= START_USER_FIELDID &&
+                       segcore_config_.get_enable_interim_segment_index() &&
+                       segcore_config_.get_enable_interim_scalar_index() &&
+                       !enable_growing_mmap) {
+                // unlike the vector index, needs no index meta and is
+                // appended from the first row
+                auto valid_data =
+                    insert_record->is_valid_data_exist(field_id)
+                        ? insert_record->get_valid_data(field_id)
+                        : nullptr;
+                field_indexings_.try_emplace(
+                    field_id,
+                    CreateScalarIndex(field_meta,
+                                      segcore_config_,
+                                      insert_record->get_data_base(field_id),
+                                      valid_data));
             }
         }
         assert(offset_id == schema_.size());
@@ -326,7 +379,9 @@ class IndexingRecord {
         auto& indexing = field_indexings_.at(fieldId);
         auto type = indexing->get_field_meta().get_data_type();
         auto field_raw_data = record.get_data_base(fieldId);
-        if (type == DataType::VECTOR_FLOAT &&
+        if (!IsVectorDataType(type)) {
+            indexing->AppendSegmentIndexScalar(reserved_offset, size);
+        } else if (type == DataType::VECTOR_FLOAT &&
             reserved_offset + size >= indexing->get_build_threshold()) {
             indexing->AppendSegmentIndexDense(
                 reserved_offset,
@@ -373,7 +428,9 @@ class IndexingRecord {
         auto type = indexing->get_field_meta().get_data_type();
         const void* p = data->Data();
 
-        if ((type == DataType::VECTOR_FLOAT ||
+        if (!IsVectorDataType(type)) {
+            indexing->AppendSegmentIndexScalar(reserved_offset, size);
+        } else if ((type == DataType::VECTOR_FLOAT ||
              type == DataType::VECTOR_FLOAT16 ||
              type == DataType::VECTOR_BFLOAT16) &&
             reserved_offset + size >= indexing->get_build_threshold()) {
@@ -428,6 +485,32 @@ class IndexingRecord {
         return false;
     }
 
+    // whether fieldId has an interim scalar index covering its first
+    // num_rows rows. Rows are appended to the index before they are acked,
+    // so a synced index covers every acked row, but the index may already
+    // cover a query while later inserts are still being appended.
+    bool
+    HasScalarIndex(FieldId fieldId, int64_t num_rows) const {
+        if (!is_in(fieldId) ||
+            IsVectorDataType(schema_[fieldId].get_data_type())) {
+            return false;
+        }
+        const FieldIndexing& indexing = get_field_indexing(fieldId);
+        return indexing.get_chunk_indexing(0)->Count() >= num_rows;
+    }
+
+    // memory held by the interim scalar indexes
+    size_t
+    ScalarIndexByteSize() const {
+        size_t size = 0;
+        for (auto& [field_id, indexing] : field_indexings_) {
+            if (!indexing->get_field_meta().is_vector()) {
+                size += indexing->get_chunk_indexing(0)->CellByteSize();
+            }
+        }
+        return size;
+    }
+
     bool
     HasRawData(FieldId fieldId) const {
         if (is_in(fieldId) && SyncDataWithIndex(fieldId)) {
@@ -12,7 +12,10 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -21,6 +24,8 @@
 #include <utility>
 #include <vector>
 
+#include <folly/container/F14Map.h>
+
 #include "TimestampIndex.h"
 #include "common/EasyAssert.h"
 #include "common/Schema.h"
@@ -65,80 +70,232 @@ class OffsetMap {
     clear() = 0;
 };
 
+// Pk index of growing segments. Pks are hashed into shards, each behind its
+// own lock, so concurrent inserts and lookups rarely contend. A pk keeps its
+// first offset inline, only duplicated pks allocate an overflow vector.
+// find_first needs the pks in order, it's served by a sorted view built on
+// first use and then merged with the pks inserted since.
 template <typename T>
-class OffsetOrderedMap : public OffsetMap {
+class ShardedOffsetMap : public OffsetMap {
  public:
+    static constexpr int kNumShardsShift = 6;
+    static constexpr int kNumShards = 1 << kNumShardsShift;
+
     bool
     contain(const PkType& pk) const override {
-        std::shared_lock<std::shared_mutex> lck(mtx_);
-
-        return map_.find(std::get<T>(pk)) != map_.end();
+        auto& key = std::get<T>(pk);
+        auto& shard = get_shard(key);
+        std::shared_lock<std::shared_mutex> lck(shard.mtx_);
+        return shard.map_.find(key) != shard.map_.end();
     }
 
     std::vector<int64_t>
     find(const PkType& pk) const override {
-        std::shared_lock<std::shared_mutex> lck(mtx_);
-
-        auto offset_vector = map_.find(std::get<T>(pk));
-        return offset_vector != map_.end() ? offset_vector->second
-                                           : std::vector<int64_t>();
+        auto& key = std::get<T>(pk);
+        auto& shard = get_shard(key);
+        std::shared_lock<std::shared_mutex> lck(shard.mtx_);
+        auto it = shard.map_.find(key);
+        if (it == shard.map_.end()) {
+            return {};
+        }
+        std::vector<int64_t> offsets{it->second.first_};
+        if (it->second.more_ != nullptr) {
+            offsets.insert(offsets.end(),
+                           it->second.more_->begin(),
+                           it->second.more_->end());
+        }
+        return offsets;
     }
 
     void
     insert(const PkType& pk, int64_t offset) override {
-        std::unique_lock<std::shared_mutex> lck(mtx_);
-
-        map_[std::get<T>(pk)].emplace_back(offset);
+        auto& key = std::get<T>(pk);
+        auto& shard = get_shard(key);
+        bool logged = false;
+        {
+            std::unique_lock<std::shared_mutex> lck(shard.mtx_);
+            auto [it, inserted] = shard.map_.try_emplace(key, offset);
+            if (inserted) {
+                num_pks_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                if (it->second.more_ == nullptr) {
+                    it->second.more_ = std::make_unique<std::vector<int64_t>>();
+                }
+                it->second.more_->push_back(offset);
+            }
+            if (log_pending_.load(std::memory_order_relaxed)) {
+                shard.pending_.emplace_back(key, offset);
+                logged = true;
+            }
+        }
+        version_.fetch_add(1, std::memory_order_release);
+        if (logged &&
+            pending_count_.fetch_add(1, std::memory_order_relaxed) + 1 >
+                std::max<int64_t>(kMinPendingLimit,
+                                  num_pks_.load(std::memory_order_relaxed))) {
+            // nobody asks for the sorted view, stop keeping it up to date
+            drop_sorted_view();
+        }
     }
 
     void
     seal() override {
         PanicInfo(
             NotImplemented,
-            "OffsetOrderedMap used for growing segment could not be sealed.");
+            "ShardedOffsetMap used for growing segment could not be sealed.");
     }
 
     bool
     empty() const override {
-        std::shared_lock<std::shared_mutex> lck(mtx_);
-
-        return map_.empty();
+        return num_pks_.load(std::memory_order_relaxed) == 0;
     }
 
     std::pair<std::vector<OffsetMap::OffsetType>, bool>
     find_first(int64_t limit, const BitsetType& bitset) const override {
-        std::shared_lock<std::shared_mutex> lck(mtx_);
+        auto view = get_sorted_view();
 
         if (limit == Unlimited || limit == NoLimit) {
-            limit = map_.size();
+            limit = num_pks_.load(std::memory_order_relaxed);
         }
 
         // TODO: we can't retrieve pk by offset very conveniently.
         //      Selectivity should be done outside.
-        return find_first_by_index(limit, bitset);
+        return find_first_by_index(*view, limit, bitset);
     }
 
     void
     clear() override {
-        std::unique_lock<std::shared_mutex> lck(mtx_);
-        map_.clear();
+        for (auto& shard : shards_) {
+            std::unique_lock<std::shared_mutex> lck(shard.mtx_);
+            shard.map_.clear();
+            shard.pending_.clear();
+        }
+        num_pks_ = 0;
+        drop_sorted_view();
     }
 
  private:
+    // (pk, offset) sorted by pk, then by offset
+    using SortedView = std::vector<std::pair<T, int64_t>>;
+
+    struct Offsets {
+        explicit Offsets(int64_t first) : first_(first) {
+        }
+        int64_t first_;
+        std::unique_ptr<std::vector<int64_t>> more_;
+    };
+
+    struct Shard {
+        mutable std::shared_mutex mtx_;
+        folly::F14FastMap<T, Offsets> map_;
+        // inserted since the sorted view was last refreshed
+        mutable SortedView pending_;
+    };
+
+    // below it the pending pks are always kept, once the view exists
+    static constexpr int64_t kMinPendingLimit = 1 << 16;
+
+    const Shard&
+    get_shard(const T& key) const {
+        uint64_t hash = std::hash<T>{}(key);
+        // the hash of integers is the identity, mix it before taking the bits
+        hash *= 0x9E3779B97F4A7C15ULL;
+        return shards_[hash >> (64 - kNumShardsShift)];
+    }
+
+    Shard&
+    get_shard(const T& key) {
+        return const_cast<Shard&>(std::as_const(*this).get_shard(key));
+    }
+
+    std::shared_ptr<const SortedView>
+    get_sorted_view() const {
+        std::lock_guard<std::mutex> lck(view_mtx_);
+        auto version = version_.load(std::memory_order_acquire);
+        if (sorted_view_ != nullptr && view_version_ == version) {
+            return sorted_view_;
+        }
+
+        SortedView delta;
+        bool full = sorted_view_ == nullptr;
+        if (full) {
+            // from now on inserts are logged, each shard is copied and its
+            // log cleared atomically, so no pk is taken twice
+            log_pending_.store(true);
+        }
+        for (auto& shard : shards_) {
+            std::unique_lock<std::shared_mutex> shard_lck(shard.mtx_);
+            if (full) {
+                for (auto& [key, offsets] : shard.map_) {
+                    delta.emplace_back(key, offsets.first_);
+                    if (offsets.more_ != nullptr) {
+                        for (auto offset : *offsets.more_) {
+                            delta.emplace_back(key, offset);
+                        }
+                    }
+                }
+            } else {
+                std::move(shard.pending_.begin(),
+                          shard.pending_.end(),
+                          std::back_inserter(delta));
+            }
+            pending_count_.fetch_sub(shard.pending_.size());
+            shard.pending_.clear();
+            shard.pending_.shrink_to_fit();
+        }
+        std::sort(delta.begin(), delta.end());
+
+        if (full) {
+            sorted_view_ = std::make_shared<const SortedView>(std::move(delta));
+        } else {
+            auto merged = std::make_shared<SortedView>();
+            merged->reserve(sorted_view_->size() + delta.size());
+            std::merge(sorted_view_->begin(),
+                       sorted_view_->end(),
+                       delta.begin(),
+                       delta.end(),
+                       std::back_inserter(*merged));
+            sorted_view_ = std::move(merged);
+        }
+        view_version_ = version;
+        return sorted_view_;
+    }
+
+    void
+    drop_sorted_view() {
+        std::lock_guard<std::mutex> lck(view_mtx_);
+        if (!log_pending_.exchange(false)) {
+            return;
+        }
+        for (auto& shard : shards_) {
+            std::unique_lock<std::shared_mutex> shard_lck(shard.mtx_);
+            pending_count_.fetch_sub(shard.pending_.size());
+            shard.pending_.clear();
+            shard.pending_.shrink_to_fit();
+        }
+        sorted_view_ = nullptr;
+    }
+
     std::pair<std::vector<OffsetMap::OffsetType>, bool>
-    find_first_by_index(int64_t limit, const BitsetType& bitset) const {
+    find_first_by_index(const SortedView& view,
+                        int64_t limit,
+                        const BitsetType& bitset) const {
         int64_t hit_num = 0;  // avoid counting the number everytime.
         auto size = bitset.size();
         int64_t cnt = size - bitset.count();
         limit = std::min(limit, cnt);
         std::vector<int64_t> seg_offsets;
         seg_offsets.reserve(limit);
-        auto it = map_.begin();
-        for (; hit_num < limit && it != map_.end(); it++) {
+        size_t begin = 0;
+        while (hit_num < limit && begin < view.size()) {
+            auto end = begin + 1;
+            while (end < view.size() && view[end].first == view[begin].first) {
+                end++;
+            }
             // Offsets in the growing segment are ordered by timestamp,
             // so traverse from back to front to obtain the latest offset.
-            for (int i = it->second.size() - 1; i >= 0; --i) {
-                auto seg_offset = it->second[i];
+            for (auto i = end; i > begin; --i) {
+                auto seg_offset = view[i - 1].second;
                 if (seg_offset >= size) {
                     // Frequently concurrent insert/query will cause this case.
                     continue;
@@ -151,14 +308,22 @@ class OffsetOrderedMap : public OffsetMap {
                     break;
                 }
             }
+            begin = end;
         }
-        return {seg_offsets, it != map_.end()};
+        return {seg_offsets, begin != view.size()};
     }
 
  private:
-    using OrderedMap = std::map<T, std::vector<int64_t>, std::less<>>;
-    OrderedMap map_;
-    mutable std::shared_mutex mtx_;
+    std::array<Shard, kNumShards> shards_;
+    std::atomic<int64_t> num_pks_{0};
+    // bumped by every insert, tells whether the sorted view is stale
+    std::atomic<uint64_t> version_{0};
+    mutable std::atomic<bool> log_pending_{false};
+    mutable std::atomic<int64_t> pending_count_{0};
+
+    mutable std::mutex view_mtx_;
+    mutable std::shared_ptr<const SortedView> sorted_view_;
+    mutable uint64_t view_version_{0};
 };
 
 template <typename T>
@@ -437,12 +602,12 @@ struct InsertRecord<false> : public InsertRecord<true> {
                 switch (field_meta.get_data_type()) {
                     case DataType::INT64: {
                         pk2offset_ =
-                            std::make_unique<OffsetOrderedMap<int64_t>>();
+                            std::make_unique<ShardedOffsetMap<int64_t>>();
                         break;
                     }
                     case DataType::VARCHAR: {
                         pk2offset_ =
-                            std::make_unique<OffsetOrderedMap<std::string>>();
+                            std::make_unique<ShardedOffsetMap<std::string>>();
                         break;
                     }
                     default: {
@@ -497,7 +662,7 @@ struct InsertRecord<false> : public InsertRecord<true> {
         int64_t size_per_chunk,
         const storage::MmapChunkDescriptorPtr mmap_descriptor = nullptr) {
         if (field_meta.is_nullable()) {
-            this->append_valid_data(field_id);
+            this->append_valid_data(field_id, size_per_chunk);
         }
         const milvus::storage::MmapConfig mmap_config =
             storage::MmapManager::GetInstance().GetMmapConfig();
@@ -635,9 +800,9 @@ struct InsertRecord<false> : public InsertRecord<true> {
         }
     }
 
+    // pk2offset_ is concurrent, no need to hold shared_mutex_
     void
     insert_pk(const PkType& pk, int64_t offset) {
-        std::lock_guard lck(shared_mutex_);
         pk2offset_->insert(pk, offset);
     }
 
@@ -698,19 +863,22 @@ struct InsertRecord<false> : public InsertRecord<true> {
         if (is_valid_data_exist(field_id)) {
             auto size = data->get_chunk_size(chunk_id);
             auto element_offset = data->get_element_offset(chunk_id);
-            return SpanBase(
-                data->get_chunk_data(chunk_id),
-                get_valid_data(field_id)->get_chunk_data(element_offset),
-                size,
-                data->get_element_size());
+            auto [words, bit] =
+                get_valid_data(field_id)->get_bitmap(element_offset, size);
+            return SpanBase(data->get_chunk_data(chunk_id),
+                            words,
+                            bit,
+                            size,
+                            data->get_element_size());
         }
         return data->get_span_base(chunk_id);
     }
 
     // append a column of scalar type
     void
-    append_valid_data(FieldId field_id) {
-        valid_data_.emplace(field_id, std::make_shared<ThreadSafeValidData>());
+    append_valid_data(FieldId field_id, int64_t size_per_chunk) {
+        valid_data_.emplace(
+            field_id, std::make_shared<ThreadSafeValidData>(size_per_chunk));
     }
 
     // append a column of vector type
@@ -0,0 +1,470 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/InterimScalarIndex.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "common/EasyAssert.h"
+#include "common/Utils.h"
+
+namespace milvus::segcore {
+
+template <typename T>
+InterimScalarIndex<T>::InterimScalarIndex(const ConcurrentVector<T>* data,
+                                          ThreadSafeValidDataPtr valid_data)
+    : index::ScalarIndex<T>(INTERIM_SCALAR_INDEX_TYPE),
+      data_(data),
+      valid_data_(std::move(valid_data)),
+      size_per_chunk_(data->get_size_per_chunk()) {
+    AssertInfo(size_per_chunk_ > 0 &&
+                   size_per_chunk_ <= std::numeric_limits<int32_t>::max(),
+               "invalid size per chunk {}",
+               size_per_chunk_);
+}
+
+template <typename T>
+void
+InterimScalarIndex<T>::Append(int64_t offset, int64_t size) {
+    if (size <= 0) {
+        return;
+    }
+    appended_.AddSegment(offset, offset + size);
+    auto end = offset + size;
+    auto max_appended = max_appended_.load();
+    while (max_appended < end &&
+           !max_appended_.compare_exchange_weak(max_appended, end)) {
+    }
+
+    // runs_ only grows under append_mutex_, so it's read here without mutex_
+    std::lock_guard<std::mutex> append_lck(append_mutex_);
+    auto num_rows = appended_.GetAck();
+    auto num_runs = static_cast<int64_t>(runs_.size());
+    while ((num_runs + 1) * size_per_chunk_ <= num_rows) {
+        // sort outside of mutex_ to not block the queries
+        auto run = SortChunk(num_runs);
+        run_bytes_ += run.capacity() * sizeof(int32_t);
+        std::unique_lock<std::shared_mutex> lck(mutex_);
+        runs_.push_back(std::move(run));
+        num_rows_ = std::max(num_rows_, (num_runs + 1) * size_per_chunk_);
+        ++num_runs;
+    }
+    std::unique_lock<std::shared_mutex> lck(mutex_);
+    num_rows_ = std::max(num_rows_, num_rows);
+}
+
+template <typename T>
+bool
+InterimScalarIndex<T>::Synced() const {
+    std::shared_lock<std::shared_mutex> lck(mutex_);
+    return num_rows_ == max_appended_.load();
+}
+
+template <typename T>
+int64_t
+InterimScalarIndex<T>::Count() {
+    std::shared_lock<std::shared_mutex> lck(mutex_);
+    return num_rows_;
+}
+
+template <typename T>
+std::vector<int32_t>
+InterimScalarIndex<T>::SortChunk(int64_t chunk_id) const {
+    auto values = static_cast<const T*>(data_->get_chunk_data(chunk_id));
+    auto chunk_begin = chunk_id * size_per_chunk_;
+    std::vector<int32_t> run;
+    run.reserve(size_per_chunk_);
+    for (int32_t i = 0; i < size_per_chunk_; ++i) {
+        if (IsValid(chunk_begin + i)) {
+            run.push_back(i);
+        }
+    }
+    // stable, so the rows of a value stay in offset order
+    std::stable_sort(
+        run.begin(), run.end(), [values](int32_t lhs, int32_t rhs) {
+            return values[lhs] < values[rhs];
+        });
+    run.shrink_to_fit();
+    return run;
+}
+
+template <typename T>
+void
+InterimScalarIndex<T>::CheckWindow(int64_t offset,
+                                   TargetBitmapView res) const {
+    AssertInfo(offset >= 0 && offset + int64_t(res.size()) <= num_rows_,
+               "window [{}, {}) out of range, num rows: {}",
+               offset,
+               offset + res.size(),
+               num_rows_);
+}
+
+template <typename T>
+template <typename Match, typename Pred>
+void
+InterimScalarIndex<T>::MatchLocked(int64_t offset,
+                                   TargetBitmapView res,
+                                   Match match,
+                                   Pred pred) const {
+    res.reset();
+    auto end = offset + int64_t(res.size());
+    if (offset >= end) {
+        return;
+    }
+    auto num_runs = static_cast<int64_t>(runs_.size());
+    for (auto chunk_id = offset / size_per_chunk_;
+         chunk_id < upper_div(end, size_per_chunk_);
+         ++chunk_id) {
+        auto chunk_begin = chunk_id * size_per_chunk_;
+        auto values = static_cast<const T*>(data_->get_chunk_data(chunk_id));
+        if (chunk_id < num_runs) {
+            match(values,
+                  runs_[chunk_id],
+                  [&](std::vector<int32_t>::const_iterator first,
+                      std::vector<int32_t>::const_iterator last) {
+                      for (; first < last; ++first) {
+                          auto row = chunk_begin + *first;
+                          if (row >= offset && row < end) {
+                              res[row - offset] = true;
+                          }
+                      }
+                  });
+        } else {
+            for (auto row = std::max(offset, chunk_begin); row < end; ++row) {
+                if (IsValid(row) && pred(values[row - chunk_begin])) {
+                    res[row - offset] = true;
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void
+InterimScalarIndex<T>::InLocked(const std::vector<T>& terms,
+                                int64_t offset,
+                                TargetBitmapView res) const {
+    MatchLocked(
+        offset,
+        res,
+        [&terms](const T* values, const std::vector<int32_t>& run, auto emit) {
+            auto value_less = [values](int32_t lhs, const T& rhs) {
+                return values[lhs] < rhs;
+            };
+            auto less_value = [values](const T& lhs, int32_t rhs) {
+                return lhs < values[rhs];
+            };
+            for (const auto& term : terms) {
+                auto first =
+                    std::lower_bound(run.begin(), run.end(), term, value_less);
+                auto last =
+                    std::upper_bound(first, run.end(), term, less_value);
+                emit(first, last);
+            }
+        },
+        [&terms](const T& value) {
+            return std::binary_search(terms.begin(), terms.end(), value);
+        });
+}
+
+template <typename T>
+void
+InterimScalarIndex<T>::RangeLocked(Bound lower,
+                                   Bound upper,
+                                   int64_t offset,
+                                   TargetBitmapView res) const {
+    MatchLocked(
+        offset,
+        res,
+        [lower, upper](
+            const T* values, const std::vector<int32_t>& run, auto emit) {
+            auto value_less = [values](int32_t lhs, const T& rhs) {
+                return values[lhs] < rhs;
+            };
+            auto less_value = [values](const T& lhs, int32_t rhs) {
+                return lhs < values[rhs];
+            };
+            auto first = run.begin();
+            if (lower.value_ != nullptr) {
+                first = lower.inclusive_
+                            ? std::lower_bound(run.begin(),
+                                               run.end(),
+                                               *lower.value_,
+                                               value_less)
+                            : std::upper_bound(run.begin(),
+                                               run.end(),
+                                               *lower.value_,
+                                               less_value);
+            }
+            auto last = run.end();
+            if (upper.value_ != nullptr) {
+                last = upper.inclusive_
+                           ? std::upper_bound(run.begin(),
+                                              run.end(),
+                                              *upper.value_,
+                                              less_value)
+                           : std::lower_bound(run.begin(),
+                                              run.end(),
+                                              *upper.value_,
+                                              value_less);
+            }
+            emit(first, last);
+        },
+        [lower, upper](const T& value) {
+            if (lower.value_ != nullptr &&
+                (lower.inclusive_ ? value < *lower.value_
+                                  : !(*lower.value_ < value))) {
+                return false;
+            }
+            if (upper.value_ != nullptr &&
+                (upper.inclusive_ ? *upper.value_ < value
+                                  : !(value < *upper.value_))) {
+                return false;
+            }
+            return true;
+        });
+}
+
+namespace {
+template <typename T>
+std::vector<T>
+SortedTerms(size_t n, const T* values) {
+    std::vector<T> terms(values, values + n);
+    std::sort(terms.begin(), terms.end());
+    terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+    return terms;
+}
+}  // namespace
+
+template <typename T>
+const TargetBitmap
+InterimScalarIndex<T>::In(size_t n, const T* values) {
+    std::shared_lock<std::shared_mutex> lck(mutex_);
+    TargetBitmap res(num_rows_);
+    InLocked(SortedTerms(n, values), 0, res.view());
+    return res;
+}
+
+template <typename T>
+void
+InterimScalarIndex<T>::InWindow(size_t n,
+                                const T* values,
+                                int64_t offset,
+                                TargetBitmapView res) {
+    std::shared_lock<std::shared_mutex> lck(mutex_);
+    CheckWindow(offset, res);
+    InLocked(SortedTerms(n, values), offset, res);
+}
+
+template <typename T>
+const TargetBitmap
+InterimScalarIndex<T>::NotIn(size_t n, const T* values) {
+    std::shared_lock<std::shared_mutex> lck(mutex_);
+    TargetBitmap res(num_rows_);
+    InLocked(SortedTerms(n, values), 0, res.view());
+    res.flip();
+    // NotIn(null) is false as In(null)
+    if (valid_data_ != nullptr) {
+        valid_data_->and_valid(0, num_rows_, res.view());
+    }
+    return res;
+}
+
+template <typename T>
+void
+InterimScalarIndex<T>::NotInWindow(size_t n,
+                                   const T* values,
+                                   int64_t offset,
+                                   TargetBitmapView res) {
+    std::shared_lock<std::shared_mutex> lck(mutex_);
+    CheckWindow(offset, res);
+    InLocked(SortedTerms(n, values), offset, res);
+    res.flip();
+    if (valid_data_ != nullptr) {
+        valid_data_->and_valid(offset, res.size(), res);
+    }
+}
+
+template <typename T>
+const TargetBitmap
+InterimScalarIndex<T>::IsNull() {
+    auto res = IsNotNull();
+    res.flip();
+    return res;
+}
+
+template <typename T>
+const TargetBitmap
+InterimScalarIndex<T>::IsNotNull() {
+    std::shared_lock<std::shared_mutex> lck(mutex_);
+    TargetBitmap res(num_rows_, true);
+    if (valid_data_ != nullptr) {
+        valid_data_->and_valid(0, num_rows_, res.view());
+    }
+    return res;
+}
+
+template <typename T>
+void
+InterimScalarIndex<T>::IsNotNullWindow(int64_t offset, TargetBitmapView res) {
+    std::shared_lock<std::shared_mutex> lck(mutex_);
+    CheckWindow(offset, res);
+    res.set();
+    if (valid_data_ != nullptr) {
+        valid_data_->and_valid(offset, res.size(), res);
+    }
+}
+
+template <typename T>
+void
+InterimScalarIndex<T>::RangeWindow(T value,
+                                   OpType op,
+                                   int64_t offset,
+                                   TargetBitmapView res) {
+    Bound lower;
+    Bound upper;
+    switch (op) {
+        case OpType::GreaterThan:
+            lower = {&value, false};
+            break;
+        case OpType::GreaterEqual:
+            lower = {&value, true};
+            break;
+        case OpType::LessThan:
+            upper = {&value, false};
+            break;
+        case OpType::LessEqual:
+            upper = {&value, true};
+            break;
+        default:
+            PanicInfo(OpTypeInvalid,
+                      fmt::format("Invalid OperatorType: {}", op));
+    }
+    std::shared_lock<std::shared_mutex> lck(mutex_);
+    CheckWindow(offset, res);
+    RangeLocked(lower, upper, offset, res);
+}
+
+template <typename T>
+const TargetBitmap
+InterimScalarIndex<T>::Range(T value, OpType op) {
+    TargetBitmap res(Count());
+    RangeWindow(value, op, 0, res.view());
+    return res;
+}
+
+template <typename T>
+void
+InterimScalarIndex<T>::RangeWindow(T lower_bound_value,
+                                   bool lb_inclusive,
+                                   T upper_bound_value,
+                                   bool ub_inclusive,
+                                   int64_t offset,
+                                   TargetBitmapView res) {
+    std::shared_lock<std::shared_mutex> lck(mutex_);
+    CheckWindow(offset, res);
+    if (upper_bound_value < lower_bound_value ||
+        (lower_bound_value == upper_bound_value &&
+         !(lb_inclusive && ub_inclusive))) {
+        res.reset();
+        return;
+    }
+    RangeLocked({&lower_bound_value, lb_inclusive},
+                {&upper_bound_value, ub_inclusive},
+                offset,
+                res);
+}
+
+template <typename T>
+const TargetBitmap
+InterimScalarIndex<T>::Range(T lower_bound_value,
+                             bool lb_inclusive,
+                             T upper_bound_value,
+                             bool ub_inclusive) {
+    TargetBitmap res(Count());
+    RangeWindow(lower_bound_value,
+                lb_inclusive,
+                upper_bound_value,
+                ub_inclusive,
+                0,
+                res.view());
+    return res;
+}
+
+template <typename T>
+std::optional<T>
+InterimScalarIndex<T>::Reverse_Lookup(size_t offset) const {
+    {
+        std::shared_lock<std::shared_mutex> lck(mutex_);
+        AssertInfo(static_cast<int64_t>(offset) < num_rows_,
+                   "offset {} out of range, num rows: {}",
+                   offset,
+                   num_rows_);
+    }
+    if (!IsValid(offset)) {
+        return std::nullopt;
+    }
+    return (*data_)[offset];
+}
+
+template <typename T>
+void
+InterimScalarIndex<T>::Build(size_t n,
+                             const T* values,
+                             const bool* valid_data) {
+    PanicInfo(Unsupported, "interim scalar index is built by appending rows");
+}
+
+template <typename T>
+void
+InterimScalarIndex<T>::Build(const Config& config) {
+    PanicInfo(Unsupported, "interim scalar index is built by appending rows");
+}
+
+template <typename T>
+BinarySet
+InterimScalarIndex<T>::Serialize(const Config& config) {
+    PanicInfo(Unsupported, "interim scalar index can't be serialized");
+}
+
+template <typename T>
+void
+InterimScalarIndex<T>::Load(const BinarySet& binary_set,
+                            const Config& config) {
+    PanicInfo(Unsupported, "interim scalar index can't be loaded");
+}
+
+template <typename T>
+void
+InterimScalarIndex<T>::Load(milvus::tracer::TraceContext ctx,
+                            const Config& config) {
+    PanicInfo(Unsupported, "interim scalar index can't be loaded");
+}
+
+template <typename T>
+index::IndexStatsPtr
+InterimScalarIndex<T>::Upload(const Config& config) {
+    PanicInfo(Unsupported, "interim scalar index can't be uploaded");
+}
+
+template class InterimScalarIndex<int8_t>;
+template class InterimScalarIndex<int16_t>;
+template class InterimScalarIndex<int32_t>;
+template class InterimScalarIndex<int64_t>;
+template class InterimScalarIndex<std::string>;
+
+}  // namespace milvus::segcore
@@ -0,0 +1,244 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "common/Types.h"
+#include "index/ScalarIndex.h"
+#include "segcore/AckResponder.h"
+#include "segcore/ConcurrentVector.h"
+
+namespace milvus::segcore {
+
+constexpr const char* INTERIM_SCALAR_INDEX_TYPE = "INTERIM_SORTED_RUN";
+
+// Data types of the fields that get an InterimScalarIndex.
+inline bool
+IsInterimScalarIndexDataType(DataType data_type) {
+    switch (data_type) {
+        case DataType::INT8:
+        case DataType::INT16:
+        case DataType::INT32:
+        case DataType::INT64:
+        case DataType::VARCHAR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * InterimScalarIndex is the index of an integer or VARCHAR field of a growing
+ * segment, maintained as the rows are inserted. It holds no copy of the
+ * values, but refers to the rows in the ConcurrentVector of the field:
+ * every full chunk is frozen into a sorted run, i.e. the in-chunk offsets of
+ * its non-null rows ordered by value, and the rows of the last, partial chunk
+ * are scanned. So a predicate costs a binary search and the matches per full
+ * chunk instead of a scan of every row.
+ *
+ * Concurrent inserts may append their rows out of order, only the contiguous
+ * prefix of the appended rows is indexed and visible through Count. Appends
+ * and queries may run concurrently.
+ */
+template <typename T>
+class InterimScalarIndex : public index::ScalarIndex<T> {
+ public:
+    InterimScalarIndex(const ConcurrentVector<T>* data,
+                       ThreadSafeValidDataPtr valid_data);
+
+    // Indexes rows [offset, offset + size) once all the rows before them
+    // are appended, their raw data must have been written.
+    void
+    Append(int64_t offset, int64_t size);
+
+    // whether all the appended rows are indexed
+    bool
+    Synced() const;
+
+    int64_t
+    Count() override;
+
+    int64_t
+    Size() override {
+        return Count();
+    }
+
+    index::ScalarIndexType
+    GetIndexType() const override {
+        return index::ScalarIndexType::STLSORT;
+    }
+
+    const bool
+    HasRawData() const override {
+        return true;
+    }
+
+    bool
+    IsMmapSupported() const override {
+        return false;
+    }
+
+    // bytes of the sorted runs, the rows themselves are not copied
+    size_t
+    CellByteSize() const override {
+        return run_bytes_.load();
+    }
+
+    const TargetBitmap
+    In(size_t n, const T* values) override;
+
+    const TargetBitmap
+    NotIn(size_t n, const T* values) override;
+
+    const TargetBitmap
+    IsNull() override;
+
+    const TargetBitmap
+    IsNotNull() override;
+
+    const TargetBitmap
+    Range(T value, OpType op) override;
+
+    const TargetBitmap
+    Range(T lower_bound_value,
+          bool lb_inclusive,
+          T upper_bound_value,
+          bool ub_inclusive) override;
+
+    bool
+    SupportWindowQuery() const override {
+        return true;
+    }
+
+    void
+    InWindow(size_t n,
+             const T* values,
+             int64_t offset,
+             TargetBitmapView res) override;
+
+    void
+    NotInWindow(size_t n,
+                const T* values,
+                int64_t offset,
+                TargetBitmapView res) override;
+
+    void
+    RangeWindow(T value,
+                OpType op,
+                int64_t offset,
+                TargetBitmapView res) override;
+
+    void
+    RangeWindow(T lower_bound_value,
+                bool lb_inclusive,
+                T upper_bound_value,
+                bool ub_inclusive,
+                int64_t offset,
+                TargetBitmapView res) override;
+
+    void
+    IsNotNullWindow(int64_t offset, TargetBitmapView res) override;
+
+    std::optional<T>
+    Reverse_Lookup(size_t offset) const override;
+
+    // the index is only built by Append and never persisted
+    void
+    Build(size_t n, const T* values, const bool* valid_data) override;
+
+    void
+    Build(const Config& config = {}) override;
+
+    BinarySet
+    Serialize(const Config& config) override;
+
+    void
+    Load(const BinarySet& binary_set, const Config& config = {}) override;
+
+    void
+    Load(milvus::tracer::TraceContext ctx, const Config& config = {}) override;
+
+    index::IndexStatsPtr
+    Upload(const Config& config = {}) override;
+
+ private:
+    // a closed or half open bound of a range, nullptr if unbounded
+    struct Bound {
+        const T* value_{nullptr};
+        bool inclusive_{false};
+    };
+
+    std::vector<int32_t>
+    SortChunk(int64_t chunk_id) const;
+
+    bool
+    IsValid(int64_t offset) const {
+        return valid_data_ == nullptr || valid_data_->is_valid(offset);
+    }
+
+    void
+    CheckWindow(int64_t offset, TargetBitmapView res) const;
+
+    // Sets res[i] if row offset + i holds one of the sorted, distinct terms.
+    void
+    InLocked(const std::vector<T>& terms,
+             int64_t offset,
+             TargetBitmapView res) const;
+
+    // Sets res[i] if the value of row offset + i is within lower and upper.
+    void
+    RangeLocked(Bound lower,
+                Bound upper,
+                int64_t offset,
+                TargetBitmapView res) const;
+
+    // Sets res[i] for the rows offset + i a frozen chunk returns from
+    // match(values, run, emit), which calls emit(first, last) for the
+    // ranges of run to set, and for the rows of the partial chunk whose
+    // value satisfies pred.
+    template <typename Match, typename Pred>
+    void
+    MatchLocked(int64_t offset,
+                TargetBitmapView res,
+                Match match,
+                Pred pred) const;
+
+    const ConcurrentVector<T>* data_;
+    ThreadSafeValidDataPtr valid_data_;
+    const int64_t size_per_chunk_;
+
+    // appended rows, the ack is the end of the contiguous prefix
+    AckResponder appended_;
+    std::atomic<int64_t> max_appended_{0};
+    // serializes the appenders freezing chunks
+    std::mutex append_mutex_;
+
+    // guards runs_ and num_rows_ against the queries
+    mutable std::shared_mutex mutex_;
+    std::vector<std::vector<int32_t>> runs_;
+    int64_t num_rows_{0};
+    std::atomic<size_t> run_bytes_{0};
+};
+
+}  // namespace milvus::segcore
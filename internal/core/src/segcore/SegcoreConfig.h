@@ -73,6 +73,16 @@ class SegcoreConfig {
         return enable_interim_segment_index_;
     }
 
+    void
+    set_enable_interim_scalar_index(bool enable_interim_scalar_index) {
+        this->enable_interim_scalar_index_ = enable_interim_scalar_index;
+    }
+
+    bool
+    get_enable_interim_scalar_index() const {
+        return enable_interim_scalar_index_;
+    }
+
     void
     set_sub_dim(int64_t sub_dim) {
         sub_dim_ = sub_dim;
@@ -144,6 +154,7 @@ class SegcoreConfig {
             knowhere::IndexEnum::INDEX_FAISS_SCANN_DVR,
     };
     inline static bool enable_interim_segment_index_ = false;
+    inline static bool enable_interim_scalar_index_ = false;
     inline static int64_t chunk_rows_ = 32 * 1024;
     inline static int64_t nlist_ = 100;
     inline static int64_t nprobe_ = 4;
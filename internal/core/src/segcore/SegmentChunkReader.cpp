@@ -42,8 +42,6 @@ SegmentChunkReader::GetChunkDataAccessor(FieldId field_id,
     // pin a new Chunk.
     auto pw = segment_->chunk_data<T>(field_id, current_chunk_id);
     auto chunk_info = pw.get();
-    auto chunk_data = chunk_info.data();
-    auto chunk_valid_data = chunk_info.valid_data();
     auto current_chunk_size = segment_->chunk_size(field_id, current_chunk_id);
     return [=,
             pw = std::move(pw),
@@ -54,16 +52,15 @@ SegmentChunkReader::GetChunkDataAccessor(FieldId field_id,
             current_chunk_pos = 0;
             // the old chunk will be unpinned, pw will now pin the new chunk.
             pw = segment_->chunk_data<T>(field_id, current_chunk_id);
-            chunk_data = pw.get().data();
-            chunk_valid_data = pw.get().valid_data();
+            chunk_info = pw.get();
             current_chunk_size =
                 segment_->chunk_size(field_id, current_chunk_id);
         }
-        if (chunk_valid_data && !chunk_valid_data[current_chunk_pos]) {
+        if (!chunk_info.is_valid(current_chunk_pos)) {
             current_chunk_pos++;
             return std::nullopt;
         }
-        return chunk_data[current_chunk_pos++];
+        return chunk_info[current_chunk_pos++];
     };
 }
 
@@ -97,15 +94,12 @@ SegmentChunkReader::GetChunkDataAccessor<std::string>(
              .growing_enable_mmap) {
         auto pw = segment_->chunk_data<std::string>(field_id, current_chunk_id);
         auto chunk_info = pw.get();
-        auto chunk_data = chunk_info.data();
-        auto chunk_valid_data = chunk_info.valid_data();
         auto current_chunk_size =
             segment_->chunk_size(field_id, current_chunk_id);
         return [pw = std::move(pw),
                 this,
                 field_id,
-                chunk_data,
-                chunk_valid_data,
+                chunk_info,
                 current_chunk_size,
                 // pw = std::move(pw),
                 &current_chunk_id,
@@ -115,16 +109,15 @@ SegmentChunkReader::GetChunkDataAccessor<std::string>(
                 current_chunk_pos = 0;
                 pw = segment_->chunk_data<std::string>(field_id,
                                                        current_chunk_id);
-                chunk_data = pw.get().data();
-                chunk_valid_data = pw.get().valid_data();
+                chunk_info = pw.get();
                 current_chunk_size =
                     segment_->chunk_size(field_id, current_chunk_id);
             }
-            if (chunk_valid_data && !chunk_valid_data[current_chunk_pos]) {
+            if (!chunk_info.is_valid(current_chunk_pos)) {
                 current_chunk_pos++;
                 return std::nullopt;
             }
-            return chunk_data[current_chunk_pos++];
+            return chunk_info[current_chunk_pos++];
         };
     } else {
         auto pw =
@@ -214,12 +207,10 @@ SegmentChunkReader::GetChunkDataAccessor(FieldId field_id,
     auto pw = segment_->chunk_data<T>(field_id, chunk_id);
     return [pw = std::move(pw)](int i) mutable -> const data_access_type {
         auto chunk_info = pw.get();
-        auto chunk_data = chunk_info.data();
-        auto chunk_valid_data = chunk_info.valid_data();
-        if (chunk_valid_data && !chunk_valid_data[i]) {
+        if (!chunk_info.is_valid(i)) {
             return std::nullopt;
         }
-        return chunk_data[i];
+        return chunk_info[i];
     };
 }
 
@@ -249,12 +240,11 @@ SegmentChunkReader::GetChunkDataAccessor<std::string>(FieldId field_id,
              .growing_enable_mmap) {
         auto pw = segment_->chunk_data<std::string>(field_id, chunk_id);
         return [pw = std::move(pw)](int i) mutable -> const data_access_type {
-            auto chunk_data = pw.get().data();
-            auto chunk_valid_data = pw.get().valid_data();
-            if (chunk_valid_data && !chunk_valid_data[i]) {
+            auto chunk_info = pw.get();
+            if (!chunk_info.is_valid(i)) {
                 return std::nullopt;
             }
-            return chunk_data[i];
+            return chunk_info[i];
         };
     } else {
         auto pw = segment_->chunk_view<std::string_view>(field_id, chunk_id);
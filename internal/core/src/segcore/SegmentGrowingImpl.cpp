@@ -121,6 +121,8 @@ SegmentGrowingImpl::Insert(int64_t reserved_offset,
             insert_record_.append_field_meta(
                 field_id, field_meta, size_per_chunk(), mmap_descriptor_);
             auto data = bulk_subscript_not_exist_field(field_meta, exist_rows);
+            insert_record_.get_valid_data(field_id)->set_data_raw(
+                0, exist_rows, data.get(), field_meta);
             insert_record_.get_data_base(field_id)->set_data_raw(
                 0, exist_rows, data.get(), field_meta);
         }
@@ -166,6 +168,7 @@ SegmentGrowingImpl::Insert(int64_t reserved_offset,
         if (!indexing_record_.HasRawData(field_id)) {
             if (field_meta.is_nullable()) {
                 insert_record_.get_valid_data(field_id)->set_data_raw(
+                    reserved_offset,
                     num_rows,
                     &insert_record_proto->fields_data(data_offset),
                     field_meta);
@@ -373,7 +376,8 @@ SegmentGrowingImpl::load_field_data_common(
 
     if (!indexing_record_.HasRawData(field_id)) {
         if (insert_record_.is_valid_data_exist(field_id)) {
-            insert_record_.get_valid_data(field_id)->set_data_raw(field_data);
+            insert_record_.get_valid_data(field_id)->set_data_raw(
+                reserved_offset, field_data);
         }
         insert_record_.get_data_base(field_id)->set_data_raw(reserved_offset,
                                                              field_data);
@@ -1312,7 +1316,7 @@ SegmentGrowingImpl::fill_empty_field(const FieldMeta& field_meta) {
 
     auto data = bulk_subscript_not_exist_field(field_meta, total_row_num);
     insert_record_.get_valid_data(field_id)->set_data_raw(
-        total_row_num, data.get(), field_meta);
+        0, total_row_num, data.get(), field_meta);
     insert_record_.get_data_base(field_id)->set_data_raw(
         0, total_row_num, data.get(), field_meta);
 
@@ -178,7 +178,8 @@ class SegmentGrowingImpl : public SegmentGrowing {
  public:
     size_t
     GetMemoryUsageInBytes() const override {
-        return stats_.mem_size.load() + deleted_record_.mem_size();
+        return stats_.mem_size.load() + deleted_record_.mem_size() +
+               indexing_record_.ScalarIndexByteSize();
     }
 
     int64_t
@@ -343,6 +344,11 @@ class SegmentGrowingImpl : public SegmentGrowing {
         return false;
     }
 
+    bool
+    HasInterimScalarIndex(FieldId field_id, int64_t num_rows) const override {
+        return indexing_record_.HasScalarIndex(field_id, num_rows);
+    }
+
     bool
     HasIndex(FieldId field_id,
              const std::string& nested_path,
@@ -363,7 +369,10 @@ class SegmentGrowingImpl : public SegmentGrowing {
         // 1. growing index enabled and it holds raw data
         // 2. growing index disabled then raw data held by chunk
         // 3. growing index enabled and it not holds raw data, then raw data held by chunk
-        if (indexing_record_.is_in(FieldId(field_id))) {
+        // interim scalar indexes never hold raw data, the chunks always do
+        if (indexing_record_.is_in(FieldId(field_id)) &&
+            IsVectorDataType(
+                schema_->operator[](FieldId(field_id)).get_data_type())) {
             if (indexing_record_.HasRawData(FieldId(field_id))) {
                 // 1. growing index enabled and it holds raw data
                 return true;
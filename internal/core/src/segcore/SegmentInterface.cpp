@@ -11,18 +11,124 @@
 
 #include "SegmentInterface.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <functional>
 
 #include "Utils.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/SystemProperty.h"
 #include "common/Tracer.h"
 #include "common/Types.h"
+#include "common/Utils.h"
+#include "futures/Executor.h"
+#include "futures/ParallelFor.h"
+#include "log/Log.h"
 #include "monitor/prometheus_client.h"
 #include "query/ExecPlanNodeVisitor.h"
 
 namespace milvus::segcore {
 
+namespace {
+// rows of an output field one task materializes at most, larger results
+// are split into ranges of the offsets
+constexpr int64_t kOutputRangeRows = 64 * 1024;
+
+// An output field to fill, fill_(offsets, size) returns its column.
+struct OutputColumn {
+    std::function<std::unique_ptr<DataArray>(const int64_t*, int64_t)> fill_;
+    DataType data_type_;
+};
+
+// Appends the rows of src to dst, both columns of the same field. MergeFrom
+// would replace the vectors stored as bytes instead of appending them.
+void
+AppendRows(DataArray& dst, const DataArray& src, DataType data_type) {
+    auto& src_vectors = src.vectors();
+    switch (data_type) {
+        case DataType::VECTOR_BINARY:
+            dst.mutable_vectors()->mutable_binary_vector()->append(
+                src_vectors.binary_vector());
+            break;
+        case DataType::VECTOR_FLOAT16:
+            dst.mutable_vectors()->mutable_float16_vector()->append(
+                src_vectors.float16_vector());
+            break;
+        case DataType::VECTOR_BFLOAT16:
+            dst.mutable_vectors()->mutable_bfloat16_vector()->append(
+                src_vectors.bfloat16_vector());
+            break;
+        case DataType::VECTOR_INT8:
+            dst.mutable_vectors()->mutable_int8_vector()->append(
+                src_vectors.int8_vector());
+            break;
+        case DataType::VECTOR_SPARSE_FLOAT: {
+            // the dim of a sparse column is the max dim of its rows
+            auto dim = std::max(dst.vectors().dim(), src_vectors.dim());
+            dst.MergeFrom(src);
+            dst.mutable_vectors()->set_dim(dim);
+            dst.mutable_vectors()->mutable_sparse_float_vector()->set_dim(dim);
+            return;
+        }
+        default:
+            dst.MergeFrom(src);
+            return;
+    }
+    dst.mutable_valid_data()->MergeFrom(src.valid_data());
+}
+
+// Fills the columns in order of the output fields. With an
+// OUTPUT_FIELD_MAX_PARALLELISM above 1 every column, and every range of
+// kOutputRangeRows offsets of a large result, is a task, and up to that many
+// workers run the tasks through futures::ParallelFor, so a saturated
+// executor never blocks the query. The ranges are stitched in offset order.
+std::vector<std::unique_ptr<DataArray>>
+FillColumns(const std::vector<OutputColumn>& columns,
+            const int64_t* offsets,
+            int64_t size) {
+    auto num_columns = static_cast<int64_t>(columns.size());
+    std::vector<std::unique_ptr<DataArray>> results(num_columns);
+    auto budget = std::max(OUTPUT_FIELD_MAX_PARALLELISM, int64_t(1));
+    auto num_ranges =
+        std::clamp(upper_div(size, kOutputRangeRows), int64_t(1), budget);
+    auto num_tasks = num_columns * num_ranges;
+    auto parallelism = std::min(budget, num_tasks);
+    if (parallelism <= 1) {
+        for (int64_t i = 0; i < num_columns; ++i) {
+            results[i] = columns[i].fill_(offsets, size);
+        }
+        return results;
+    }
+
+    auto range_rows = upper_div(size, num_ranges);
+    std::vector<std::unique_ptr<DataArray>> parts(num_tasks);
+    std::atomic<int64_t> next_task{0};
+    auto run = [&](int64_t) {
+        for (auto task = next_task.fetch_add(1); task < num_tasks;
+             task = next_task.fetch_add(1)) {
+            auto begin = std::min(size, task % num_ranges * range_rows);
+            auto end = std::min(size, begin + range_rows);
+            parts[task] =
+                columns[task / num_ranges].fill_(offsets + begin, end - begin);
+        }
+    };
+    milvus::futures::ParallelFor(
+        milvus::futures::getGlobalCPUExecutor(), parallelism, run);
+
+    for (int64_t i = 0; i < num_columns; ++i) {
+        results[i] = std::move(parts[i * num_ranges]);
+        for (int64_t j = 1; j < num_ranges; ++j) {
+            AppendRows(*results[i],
+                       *parts[i * num_ranges + j],
+                       columns[i].data_type_);
+        }
+    }
+    return results;
+}
+}  // namespace
+
 void
 SegmentInternalInterface::FillPrimaryKeys(const query::Plan* plan,
                                           SearchResult& results) const {
@@ -57,25 +163,43 @@ SegmentInternalInterface::FillTargetEntry(const query::Plan* plan,
     AssertInfo(results.seg_offsets_.size() == size,
                "Size of result distances is not equal to size of ids");
 
-    std::unique_ptr<DataArray> field_data;
+    std::vector<OutputColumn> columns;
+    columns.reserve(plan->target_entries_.size());
     // fill other entries except primary key by result_offset
     for (auto field_id : plan->target_entries_) {
         auto& field_meta = plan->schema_->operator[](field_id);
+        auto data_type = field_meta.get_data_type();
         if (plan->schema_->get_dynamic_field_id().has_value() &&
             plan->schema_->get_dynamic_field_id().value() == field_id &&
             !plan->target_dynamic_fields_.empty()) {
             auto& target_dynamic_fields = plan->target_dynamic_fields_;
-            field_data = bulk_subscript(field_id,
-                                        results.seg_offsets_.data(),
-                                        size,
-                                        target_dynamic_fields);
+            columns.push_back(
+                {[this, field_id, &target_dynamic_fields](
+                     const int64_t* offsets, int64_t count) {
+                     return bulk_subscript(
+                         field_id, offsets, count, target_dynamic_fields);
+                 },
+                 data_type});
         } else if (!is_field_exist(field_id)) {
-            field_data = bulk_subscript_not_exist_field(field_meta, size);
+            columns.push_back(
+                {[this, &field_meta](const int64_t*, int64_t count) {
+                     return bulk_subscript_not_exist_field(field_meta, count);
+                 },
+                 data_type});
         } else {
-            field_data =
-                bulk_subscript(field_id, results.seg_offsets_.data(), size);
+            columns.push_back(
+                {[this, field_id](const int64_t* offsets, int64_t count) {
+                     return bulk_subscript(field_id, offsets, count);
+                 },
+                 data_type});
         }
-        results.output_fields_data_[field_id] = std::move(field_data);
+    }
+
+    auto fields_data =
+        FillColumns(columns, results.seg_offsets_.data(), size);
+    for (size_t i = 0; i < fields_data.size(); ++i) {
+        results.output_fields_data_[plan->target_entries_[i]] =
+            std::move(fields_data[i]);
     }
 }
 
@@ -94,6 +218,11 @@ SegmentInternalInterface::Search(
     auto results = std::make_unique<SearchResult>();
     *results = visitor.get_moved_result(*plan->plan_node_);
     results->segment_ = (void*)this;
+    if (!results->exec_profile_.empty()) {
+        LOG_INFO("segment {} search profile: {}",
+                 get_segment_id(),
+                 results->exec_profile_);
+    }
     return results;
 }
 
@@ -112,6 +241,11 @@ SegmentInternalInterface::Retrieve(tracer::TraceContext* trace_ctx,
         *this, timestamp, consistency_level, collection_ttl);
     auto retrieve_results = visitor.get_retrieve_result(*plan->plan_node_);
     retrieve_results.segment_ = (void*)this;
+    if (!retrieve_results.exec_profile_.empty()) {
+        LOG_INFO("segment {} retrieve profile: {}",
+                 get_segment_id(),
+                 retrieve_results.exec_profile_);
+    }
     results->set_has_more_result(retrieve_results.has_more_result);
 
     auto result_rows = retrieve_results.result_offsets_.size();
@@ -173,24 +307,79 @@ SegmentInternalInterface::FillTargetEntry(
     auto is_pk_field = [&, pk_field_id](const FieldId& field_id) -> bool {
         return pk_field_id.has_value() && pk_field_id.value() == field_id;
     };
+    auto is_dynamic_target = [&](const FieldId& field_id) -> bool {
+        return plan->schema_->get_dynamic_field_id().has_value() &&
+               plan->schema_->get_dynamic_field_id().value() == field_id &&
+               !plan->target_dynamic_fields_.empty();
+    };
 
+    // materialize the columns first, possibly in parallel, then assemble
+    // the results in order of the output fields
+    std::vector<OutputColumn> columns;
+    columns.reserve(plan->field_ids_.size());
     for (auto field_id : plan->field_ids_) {
         if (SystemProperty::Instance().IsSystem(field_id)) {
-            auto system_type =
-                SystemProperty::Instance().GetSystemFieldType(field_id);
+            columns.push_back(
+                {[this, field_id](const int64_t* offsets, int64_t count) {
+                     auto system_type =
+                         SystemProperty::Instance().GetSystemFieldType(
+                             field_id);
+
+                     FixedVector<int64_t> output(count);
+                     bulk_subscript(
+                         system_type, offsets, count, output.data());
+
+                     auto data_array = std::make_unique<DataArray>();
+                     data_array->set_field_id(field_id.get());
+                     data_array->set_type(
+                         milvus::proto::schema::DataType::Int64);
+
+                     auto scalar_array = data_array->mutable_scalars();
+                     auto data =
+                         reinterpret_cast<const int64_t*>(output.data());
+                     auto obj = scalar_array->mutable_long_data();
+                     obj->mutable_data()->Add(data, data + count);
+                     return data_array;
+                 },
+                 DataType::INT64});
+            continue;
+        }
 
-            FixedVector<int64_t> output(size);
-            bulk_subscript(system_type, offsets, size, output.data());
+        if (ignore_non_pk && !is_pk_field(field_id)) {
+            continue;
+        }
 
-            auto data_array = std::make_unique<DataArray>();
-            data_array->set_field_id(field_id.get());
-            data_array->set_type(milvus::proto::schema::DataType::Int64);
+        auto& field_meta = plan->schema_->operator[](field_id);
+        auto data_type = field_meta.get_data_type();
+        if (is_dynamic_target(field_id)) {
+            auto& target_dynamic_fields = plan->target_dynamic_fields_;
+            columns.push_back(
+                {[this, field_id, &target_dynamic_fields](
+                     const int64_t* offsets, int64_t count) {
+                     return bulk_subscript(
+                         field_id, offsets, count, target_dynamic_fields);
+                 },
+                 data_type});
+        } else if (!is_field_exist(field_id)) {
+            columns.push_back(
+                {[this, &field_meta](const int64_t*, int64_t count) {
+                     return bulk_subscript_not_exist_field(field_meta, count);
+                 },
+                 data_type});
+        } else {
+            columns.push_back(
+                {[this, field_id](const int64_t* offsets, int64_t count) {
+                     return bulk_subscript(field_id, offsets, count);
+                 },
+                 data_type});
+        }
+    }
+    auto cols = FillColumns(columns, offsets, size);
 
-            auto scalar_array = data_array->mutable_scalars();
-            auto data = reinterpret_cast<const int64_t*>(output.data());
-            auto obj = scalar_array->mutable_long_data();
-            obj->mutable_data()->Add(data, data + size);
-            fields_data->AddAllocated(data_array.release());
+    auto next_col = cols.begin();
+    for (auto field_id : plan->field_ids_) {
+        if (SystemProperty::Instance().IsSystem(field_id)) {
+            fields_data->AddAllocated((next_col++)->release());
             continue;
         }
 
@@ -198,22 +387,12 @@ SegmentInternalInterface::FillTargetEntry(
             continue;
         }
 
-        if (plan->schema_->get_dynamic_field_id().has_value() &&
-            plan->schema_->get_dynamic_field_id().value() == field_id &&
-            !plan->target_dynamic_fields_.empty()) {
-            auto& target_dynamic_fields = plan->target_dynamic_fields_;
-            auto col =
-                bulk_subscript(field_id, offsets, size, target_dynamic_fields);
-            fields_data->AddAllocated(col.release());
+        if (is_dynamic_target(field_id)) {
+            fields_data->AddAllocated((next_col++)->release());
             continue;
         }
-        std::unique_ptr<DataArray> col;
+        auto col = std::move(*next_col++);
         auto& field_meta = plan->schema_->operator[](field_id);
-        if (!is_field_exist(field_id)) {
-            col = std::move(bulk_subscript_not_exist_field(field_meta, size));
-        } else {
-            col = bulk_subscript(field_id, offsets, size);
-        }
         // todo(SpadeA): consider vector array?
         if (field_meta.get_data_type() == DataType::ARRAY) {
             col->mutable_scalars()->mutable_array_data()->set_element_type(
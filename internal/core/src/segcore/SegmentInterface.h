@@ -23,6 +23,7 @@
 #include "cachinglayer/CacheSlot.h"
 #include "common/EasyAssert.h"
 #include "common/Json.h"
+#include "common/JsonShadowColumn.h"
 #include "common/Schema.h"
 #include "common/Span.h"
 #include "common/SystemProperty.h"
@@ -326,6 +327,13 @@ class SegmentInternalInterface : public SegmentInterface {
              bool any_type = false,
              bool is_array = false) const = 0;
 
+    // whether a growing segment has an interim scalar index of field_id
+    // covering its first num_rows rows, as the only index chunk
+    virtual bool
+    HasInterimScalarIndex(FieldId field_id, int64_t num_rows) const {
+        return false;
+    }
+
     virtual bool
     HasFieldData(FieldId field_id) const = 0;
 
@@ -410,6 +418,22 @@ class SegmentInternalInterface : public SegmentInterface {
     virtual std::pair<int64_t, int64_t>
     get_chunk_by_offset(FieldId field_id, int64_t offset) const = 0;
 
+    // Declares that chunks of the field are going to be scanned in the given order,
+    // see ChunkedColumnInterface::ReadAhead. Returns nullptr if not supported.
+    virtual std::unique_ptr<ReadAheadHandle>
+    read_ahead_chunks(FieldId field_id, std::vector<int64_t> chunk_ids) const {
+        return nullptr;
+    }
+
+    // Typed values of a json path extracted when the chunk was sealed, see
+    // JsonShadowColumn. Holds nullptr if the path has no shadow column.
+    virtual PinWrapper<const JsonShadowColumn*>
+    GetJsonShadowColumn(FieldId field_id,
+                        int64_t chunk_id,
+                        const std::string& pointer) const {
+        return PinWrapper<const JsonShadowColumn*>(nullptr);
+    }
+
     // element size in each chunk
     virtual int64_t
     size_per_chunk() const = 0;
@@ -59,27 +59,25 @@ GroupReduceHelper::RefreshSingleSearchResult(SearchResult* search_result,
                search_result->group_by_values_.value().size(),
                search_result->primary_keys_.size());
 
-    uint32_t size = 0;
-    for (int j = 0; j < total_nq_; j++) {
-        size += final_search_records_[seg_res_idx][j].size();
-    }
+    const auto& records = final_search_records_[seg_res_idx];
+    uint32_t size = records.size();
     std::vector<milvus::PkType> primary_keys(size);
     std::vector<float> distances(size);
     std::vector<int64_t> seg_offsets(size);
     std::vector<GroupByValueType> group_by_values(size);
 
     uint32_t index = 0;
-    for (int j = 0; j < total_nq_; j++) {
-        for (auto offset : final_search_records_[seg_res_idx][j]) {
-            primary_keys[index] = search_result->primary_keys_[offset];
-            distances[index] = search_result->distances_[offset];
-            seg_offsets[index] = search_result->seg_offsets_[offset];
-            group_by_values[index] =
-                search_result->group_by_values_.value()[offset];
-            index++;
-            real_topks[j]++;
-        }
+    for (auto offset : records) {
+        primary_keys[index] = search_result->primary_keys_[offset];
+        distances[index] = search_result->distances_[offset];
+        seg_offsets[index] = search_result->seg_offsets_[offset];
+        group_by_values[index] =
+            search_result->group_by_values_.value()[offset];
+        index++;
     }
+    std::copy_n(final_search_topks_.begin() + seg_res_idx * total_nq_,
+                total_nq_,
+                real_topks.begin());
     search_result->primary_keys_.swap(primary_keys);
     search_result->distances_.swap(distances);
     search_result->seg_offsets_.swap(seg_offsets);
@@ -103,11 +101,6 @@ int64_t
 GroupReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
                                               int64_t topk,
                                               int64_t& offset) {
-    std::priority_queue<SearchResultPair*,
-                        std::vector<SearchResultPair*>,
-                        SearchResultPairComparator>
-        heap;
-    pk_set_.clear();
     pairs_.clear();
     pairs_.reserve(num_segments_);
     for (int i = 0; i < num_segments_; i++) {
@@ -134,23 +127,24 @@ GroupReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
                             offset_beg,
                             offset_end,
                             std::move(group_by_val));
-        heap.push(&pairs_.back());
     }
 
     // nq has no results for all segments
-    if (heap.size() == 0) {
+    if (pairs_.empty()) {
         return 0;
     }
 
     int64_t group_size = search_results_[0]->group_size_.value();
     int64_t group_by_total_size = group_size * topk;
+    merge_tree_.Reset(pairs_);
+    pk_set_.clear(group_by_total_size);
     int64_t filtered_count = 0;
     auto start = offset;
     std::unordered_map<GroupByValueType, int64_t> group_by_map;
 
     auto should_filtered = [&](const PkType& pk,
                                const GroupByValueType& group_by_val) {
-        if (pk_set_.count(pk) != 0)
+        if (pk_set_.contains(pk))
             return true;
         if (group_by_map.size() >= topk &&
             group_by_map.count(group_by_val) == 0)
@@ -160,12 +154,11 @@ GroupReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
         return false;
     };
 
-    while (offset - start < group_by_total_size && !heap.empty()) {
+    while (offset - start < group_by_total_size && !merge_tree_.empty()) {
         //fetch value
-        auto pilot = heap.top();
-        heap.pop();
+        auto pilot = merge_tree_.top();
         auto index = pilot->segment_index_;
-        auto pk = pilot->primary_key_;
+        const auto& pk = pilot->search_result_->primary_keys_[pilot->offset_];
         AssertInfo(pk != INVALID_PK,
                    "Wrong, search results should have been filtered and "
                    "invalid_pk should not be existed");
@@ -174,7 +167,8 @@ GroupReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
         //judge filter
         if (!should_filtered(pk, group_by_val)) {
             pilot->search_result_->result_offsets_.push_back(offset++);
-            final_search_records_[index][qi].push_back(pilot->offset_);
+            final_search_records_[index].push_back(pilot->offset_);
+            final_search_topks_[index * total_nq_ + qi]++;
             pk_set_.insert(pk);
             group_by_map[group_by_val] += 1;
         } else {
@@ -182,10 +176,7 @@ GroupReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
         }
 
         //move pilot forward
-        pilot->advance();
-        if (pilot->primary_key_ != INVALID_PK) {
-            heap.push(pilot);
-        }
+        merge_tree_.advance();
     }
     return filtered_count;
 }
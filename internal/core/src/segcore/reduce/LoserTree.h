@@ -0,0 +1,102 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "segcore/ReduceStructure.h"
+
+namespace milvus::segcore {
+
+// Loser tree for the k-way merge of per segment result lists, each already
+// sorted by SearchResultPair::operator>. Taking the best pair and advancing
+// its list costs log(k) comparisons, against about 2 * log(k) for a binary
+// heap, and the tree storage is reused across queries.
+class SearchResultLoserTree {
+ public:
+    // players must stay in place until the next Reset
+    void
+    Reset(std::vector<SearchResultPair>& players) {
+        players_ = players.data();
+        num_players_ = static_cast<int64_t>(players.size());
+        tree_.resize(std::max<int64_t>(num_players_, 1));
+        if (num_players_ > 0) {
+            tree_[0] = Build(1);
+        }
+    }
+
+    bool
+    empty() const {
+        return num_players_ == 0 || Exhausted(tree_[0]);
+    }
+
+    SearchResultPair*
+    top() const {
+        return &players_[tree_[0]];
+    }
+
+    // advance the winner to its next result and replay its path
+    void
+    advance() {
+        auto winner = tree_[0];
+        players_[winner].advance();
+        for (auto node = (winner + num_players_) / 2; node > 0; node /= 2) {
+            if (Beats(tree_[node], winner)) {
+                std::swap(tree_[node], winner);
+            }
+        }
+        tree_[0] = winner;
+    }
+
+ private:
+    bool
+    Exhausted(int64_t i) const {
+        return players_[i].offset_ >= players_[i].offset_rb_;
+    }
+
+    bool
+    Beats(int64_t lhs, int64_t rhs) const {
+        if (Exhausted(lhs)) {
+            return false;
+        }
+        if (Exhausted(rhs)) {
+            return true;
+        }
+        return players_[lhs] > players_[rhs];
+    }
+
+    // internal nodes are [1, k) and leaves [k, 2k), node n has children 2n
+    // and 2n + 1; returns the winner of the subtree and keeps losers inside
+    int64_t
+    Build(int64_t node) {
+        if (node >= num_players_) {
+            return node - num_players_;
+        }
+        auto left = Build(2 * node);
+        auto right = Build(2 * node + 1);
+        if (Beats(right, left)) {
+            std::swap(left, right);
+        }
+        tree_[node] = right;
+        return left;
+    }
+
+    SearchResultPair* players_{nullptr};
+    int64_t num_players_{0};
+    // tree_[0] is the overall winner, other nodes hold the loser of the match
+    std::vector<int64_t> tree_;
+};
+
+}  // namespace milvus::segcore
@@ -0,0 +1,137 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "common/Types.h"
+
+namespace milvus::segcore {
+
+// Open addressing set of primary keys used to drop duplicates while reducing
+// one query. The slots are reused across queries: clear() only bumps a
+// generation counter, so a reduce over many nq never frees or rehashes.
+// Keys are stored by address and must outlive the current generation.
+class PkDedupSet {
+ public:
+    // forget all keys and make room for at least expected_size insertions
+    void
+    clear(size_t expected_size = 0) {
+        size_t capacity = slots_.empty() ? 16 : slots_.size();
+        while (capacity < expected_size * 2) {
+            capacity <<= 1;
+        }
+        if (capacity != slots_.size() || ++generation_ == 0) {
+            slots_.assign(capacity, Slot{});
+            generation_ = 1;
+        }
+        mask_ = capacity - 1;
+        size_ = 0;
+    }
+
+    bool
+    contains(const PkType& pk) const {
+        if (size_ == 0) {
+            return false;
+        }
+        auto hash = Hash(pk);
+        for (auto i = hash & mask_;; i = (i + 1) & mask_) {
+            const auto& slot = slots_[i];
+            if (slot.generation_ != generation_) {
+                return false;
+            }
+            if (slot.hash_ == hash && *slot.key_ == pk) {
+                return true;
+            }
+        }
+    }
+
+    // returns false if pk is already in the set
+    bool
+    insert(const PkType& pk) {
+        if ((size_ + 1) * 2 > slots_.size()) {
+            Grow();
+        }
+        auto hash = Hash(pk);
+        for (auto i = hash & mask_;; i = (i + 1) & mask_) {
+            auto& slot = slots_[i];
+            if (slot.generation_ != generation_) {
+                slot = Slot{generation_, hash, &pk};
+                size_++;
+                return true;
+            }
+            if (slot.hash_ == hash && *slot.key_ == pk) {
+                return false;
+            }
+        }
+    }
+
+    size_t
+    size() const {
+        return size_;
+    }
+
+ private:
+    struct Slot {
+        uint32_t generation_{0};
+        uint64_t hash_{0};
+        const PkType* key_{nullptr};
+    };
+
+    static uint64_t
+    Hash(const PkType& pk) {
+        uint64_t h;
+        if (auto int_pk = std::get_if<int64_t>(&pk)) {
+            h = static_cast<uint64_t>(*int_pk);
+        } else if (auto str_pk = std::get_if<std::string>(&pk)) {
+            h = std::hash<std::string>{}(*str_pk);
+        } else {
+            h = 0;
+        }
+        // spread sequential ids over the table
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    void
+    Grow() {
+        auto old_slots = std::move(slots_);
+        auto old_generation = generation_;
+        slots_.assign(old_slots.empty() ? 16 : old_slots.size() * 2, Slot{});
+        mask_ = slots_.size() - 1;
+        generation_ = 1;
+        for (const auto& slot : old_slots) {
+            if (slot.generation_ != old_generation) {
+                continue;
+            }
+            auto i = slot.hash_ & mask_;
+            while (slots_[i].generation_ == generation_) {
+                i = (i + 1) & mask_;
+            }
+            slots_[i] = slot;
+            slots_[i].generation_ = generation_;
+        }
+    }
+
+    std::vector<Slot> slots_;
+    uint64_t mask_{0};
+    uint32_t generation_{0};
+    size_t size_{0};
+};
+
+}  // namespace milvus::segcore
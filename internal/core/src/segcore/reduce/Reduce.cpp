@@ -48,9 +48,6 @@ ReduceHelper::Initialize() {
 
     // init final_search_records and final_read_topKs
     final_search_records_.resize(num_segments_);
-    for (auto& search_record : final_search_records_) {
-        search_record.resize(total_nq_);
-    }
 }
 
 void
@@ -166,19 +163,19 @@ void
 ReduceHelper::RefreshSingleSearchResult(SearchResult* search_result,
                                         int seg_res_idx,
                                         std::vector<int64_t>& real_topks) {
+    // offsets are kept in increasing order, compact in place
     uint32_t index = 0;
-    for (int j = 0; j < total_nq_; j++) {
-        for (auto offset : final_search_records_[seg_res_idx][j]) {
-            search_result->primary_keys_[index] =
-                search_result->primary_keys_[offset];
-            search_result->distances_[index] =
-                search_result->distances_[offset];
-            search_result->seg_offsets_[index] =
-                search_result->seg_offsets_[offset];
-            index++;
-            real_topks[j]++;
-        }
+    for (auto offset : final_search_records_[seg_res_idx]) {
+        search_result->primary_keys_[index] =
+            search_result->primary_keys_[offset];
+        search_result->distances_[index] = search_result->distances_[offset];
+        search_result->seg_offsets_[index] =
+            search_result->seg_offsets_[offset];
+        index++;
     }
+    std::copy_n(final_search_topks_.begin() + seg_res_idx * total_nq_,
+                total_nq_,
+                real_topks.begin());
     search_result->primary_keys_.resize(index);
     search_result->distances_.resize(index);
     search_result->seg_offsets_.resize(index);
@@ -208,13 +205,7 @@ int64_t
 ReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
                                          int64_t topk,
                                          int64_t& offset) {
-    std::priority_queue<SearchResultPair*,
-                        std::vector<SearchResultPair*>,
-                        SearchResultPairComparator>
-        heap;
-    pk_set_.clear();
     pairs_.clear();
-
     pairs_.reserve(num_segments_);
     for (int i = 0; i < num_segments_; i++) {
         auto search_result = search_results_[i];
@@ -227,39 +218,36 @@ ReduceHelper::ReduceSearchResultForOneNQ(int64_t qi,
         auto distance = search_result->distances_[offset_beg];
         pairs_.emplace_back(
             primary_key, distance, search_result, i, offset_beg, offset_end);
-        heap.push(&pairs_.back());
     }
 
     // nq has no results for all segments
-    if (heap.size() == 0) {
+    if (pairs_.empty()) {
         return 0;
     }
+    merge_tree_.Reset(pairs_);
+    pk_set_.clear(topk);
 
     int64_t dup_cnt = 0;
     auto start = offset;
-    while (offset - start < topk && !heap.empty()) {
-        auto pilot = heap.top();
-        heap.pop();
-
+    while (offset - start < topk && !merge_tree_.empty()) {
+        auto pilot = merge_tree_.top();
         auto index = pilot->segment_index_;
-        auto pk = pilot->primary_key_;
+        // the set keeps the key by address, point it at the stable copy
+        const auto& pk = pilot->search_result_->primary_keys_[pilot->offset_];
         // no valid search result for this nq, break to next
         if (pk == INVALID_PK) {
             break;
         }
         // remove duplicates
-        if (pk_set_.count(pk) == 0) {
+        if (pk_set_.insert(pk)) {
             pilot->search_result_->result_offsets_.push_back(offset++);
-            final_search_records_[index][qi].push_back(pilot->offset_);
-            pk_set_.insert(pk);
+            final_search_records_[index].push_back(pilot->offset_);
+            final_search_topks_[index * total_nq_ + qi]++;
         } else {
             // skip entity with same primary key
             dup_cnt++;
         }
-        pilot->advance();
-        if (pilot->primary_key_ != INVALID_PK) {
-            heap.push(pilot);
-        }
+        merge_tree_.advance();
     }
     return dup_cnt;
 }
@@ -279,7 +267,13 @@ ReduceHelper::ReduceResultData() {
                    "incorrect search result seg offset size");
         AssertInfo(search_result->primary_keys_.size() == result_count,
                    "incorrect search result primary key size");
+        // a segment contributes at most all of its results, reserve once so
+        // that the merge below never reallocates
+        final_search_records_[i].clear();
+        final_search_records_[i].reserve(result_count);
+        search_result->result_offsets_.reserve(result_count);
     }
+    final_search_topks_.assign(num_segments_ * total_nq_, 0);
 
     int64_t filtered_count = 0;
     for (int64_t slice_index = 0; slice_index < num_slices_; slice_index++) {
@@ -364,6 +358,14 @@ ReduceHelper::GetSearchResultDataSlice(int slice_index) {
 
     // reserve space for distances
     search_result_data->mutable_scores()->Resize(result_count, 0);
+    auto scores = search_result_data->mutable_scores()->mutable_data();
+    auto int_ids =
+        pk_type == milvus::DataType::INT64
+            ? search_result_data->mutable_ids()
+                  ->mutable_int_id()
+                  ->mutable_data()
+                  ->mutable_data()
+            : nullptr;
 
     // fill pks and distances
     for (auto qi = nq_begin; qi < nq_end; qi++) {
@@ -388,12 +390,8 @@ ReduceHelper::GetSearchResultDataSlice(int slice_index) {
                 // set result pks
                 switch (pk_type) {
                     case milvus::DataType::INT64: {
-                        search_result_data->mutable_ids()
-                            ->mutable_int_id()
-                            ->mutable_data()
-                            ->Set(loc,
-                                  std::visit(Int64PKVisitor{},
-                                             search_result->primary_keys_[ki]));
+                        int_ids[loc] = std::visit(
+                            Int64PKVisitor{}, search_result->primary_keys_[ki]);
                         break;
                     }
                     case milvus::DataType::VARCHAR: {
@@ -411,8 +409,7 @@ ReduceHelper::GetSearchResultDataSlice(int slice_index) {
                     }
                 }
 
-                search_result_data->mutable_scores()->Set(
-                    loc, search_result->distances_[ki]);
+                scores[loc] = search_result->distances_[ki];
                 // set result offset to fill output fields data
                 result_pairs[loc] = {&search_result->output_fields_data_, ki};
             }
@@ -15,13 +15,14 @@
 #include <cstdint>
 #include <memory>
 #include <vector>
-#include <queue>
 #include <unordered_set>
 
 #include "common/type_c.h"
 #include "common/QueryResult.h"
 #include "query/PlanImpl.h"
 #include "segcore/ReduceStructure.h"
+#include "segcore/reduce/LoserTree.h"
+#include "segcore/reduce/PkDedupSet.h"
 #include "common/Tracer.h"
 #include "segcore/segment_c.h"
 
@@ -109,9 +110,13 @@ class ReduceHelper {
     // Used for merge results,
     // define these here to avoid allocating them for each query
     std::vector<SearchResultPair> pairs_;
-    std::unordered_set<milvus::PkType> pk_set_;
-    // dim0: num_segments_; dim1: total_nq_; dim2: offset
-    std::vector<std::vector<std::vector<int64_t>>> final_search_records_;
+    SearchResultLoserTree merge_tree_;
+    PkDedupSet pk_set_;
+    // dim0: num_segments_; dim1: offsets kept from the segment, in nq order
+    std::vector<std::vector<int64_t>> final_search_records_;
+    // number of offsets kept per segment and nq,
+    // final_search_topks_[segment * total_nq_ + nq]
+    std::vector<int64_t> final_search_topks_;
     std::vector<int64_t> slice_nqs_;
     int64_t total_nq_;
     // output
@@ -41,6 +41,13 @@ SegcoreSetEnableInterminSegmentIndex(const bool value) {
     config.set_enable_interim_segment_index(value);
 }
 
+extern "C" void
+SegcoreSetEnableInterimScalarIndex(const bool value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_enable_interim_scalar_index(value);
+}
+
 extern "C" void
 SegcoreSetNlist(const int64_t value) {
     milvus::segcore::SegcoreConfig& config =
@@ -185,7 +192,9 @@ ConfigureTieredStorage(const CacheWarmupPolicy scalarFieldCacheWarmupPolicy,
                        const int64_t disk_max_bytes,
                        const bool evictionEnabled,
                        const int64_t cache_touch_window_ms,
-                       const int64_t eviction_interval_ms) {
+                       const int64_t eviction_interval_ms,
+                       const CacheEvictionPolicy eviction_policy,
+                       const int64_t eviction_shards) {
     milvus::cachinglayer::Manager::ConfigureTieredStorage(
         {scalarFieldCacheWarmupPolicy,
          vectorFieldCacheWarmupPolicy,
@@ -198,7 +207,10 @@ ConfigureTieredStorage(const CacheWarmupPolicy scalarFieldCacheWarmupPolicy,
          disk_high_watermark_bytes,
          disk_max_bytes},
         evictionEnabled,
-        {cache_touch_window_ms, eviction_interval_ms});
+        {cache_touch_window_ms,
+         eviction_interval_ms,
+         eviction_policy,
+         eviction_shards});
 }
 
 }  // namespace milvus::segcore
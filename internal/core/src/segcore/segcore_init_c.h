@@ -30,6 +30,9 @@ SegcoreSetChunkRows(const int64_t);
 void
 SegcoreSetEnableInterminSegmentIndex(const bool);
 
+void
+SegcoreSetEnableInterimScalarIndex(const bool);
+
 void
 SegcoreSetNlist(const int64_t);
 
@@ -99,7 +102,9 @@ ConfigureTieredStorage(const CacheWarmupPolicy scalarFieldCacheWarmupPolicy,
                        const int64_t disk_max_bytes,
                        const bool evictionEnabled,
                        const int64_t cache_touch_window_ms,
-                       const int64_t eviction_interval_ms);
+                       const int64_t eviction_interval_ms,
+                       const CacheEvictionPolicy eviction_policy,
+                       const int64_t eviction_shards);
 
 #ifdef __cplusplus
 }
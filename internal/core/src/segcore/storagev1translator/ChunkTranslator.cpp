@@ -126,9 +126,7 @@ ChunkTranslator::get_cells(
             // this relies on the fact that channel is blocked when there is no data to pop
             bool popped = channel->pop(r);
             AssertInfo(popped, "failed to pop arrow reader from channel");
-            arrow::ArrayVector array_vec =
-                read_single_column_batches(r->reader);
-            chunk = create_chunk(field_meta_, array_vec);
+            chunk = create_chunk(field_meta_, *r);
         } else {
             // we don't know the resulting file size beforehand, thus using a separate file for each chunk.
             auto filepath = folder / std::to_string(cid);
@@ -142,9 +140,7 @@ ChunkTranslator::get_cells(
             std::shared_ptr<milvus::ArrowDataWrapper> r;
             bool popped = channel->pop(r);
             AssertInfo(popped, "failed to pop arrow reader from channel");
-            arrow::ArrayVector array_vec =
-                read_single_column_batches(r->reader);
-            chunk = create_chunk(field_meta_, array_vec, filepath.string());
+            chunk = create_chunk(field_meta_, *r, filepath.string());
             auto ok = unlink(filepath.c_str());
             AssertInfo(
                 ok == 0,
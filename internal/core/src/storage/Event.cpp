@@ -259,45 +259,10 @@ BaseEventData::Serialize() {
         switch (data_type) {
             case DataType::VARCHAR:
             case DataType::STRING:
-            case DataType::TEXT: {
-                for (size_t offset = 0; offset < field_data->get_num_rows();
-                     ++offset) {
-                    auto str = static_cast<const std::string*>(
-                        field_data->RawValue(offset));
-                    auto size = field_data->is_valid(offset) ? str->size() : -1;
-                    payload_writer->add_one_string_payload(str->c_str(), size);
-                }
-                break;
-            }
-            case DataType::ARRAY: {
-                for (size_t offset = 0; offset < field_data->get_num_rows();
-                     ++offset) {
-                    auto array =
-                        static_cast<const Array*>(field_data->RawValue(offset));
-                    auto array_string =
-                        array->output_data().SerializeAsString();
-                    auto size =
-                        field_data->is_valid(offset) ? array_string.size() : -1;
-
-                    payload_writer->add_one_binary_payload(
-                        reinterpret_cast<const uint8_t*>(array_string.c_str()),
-                        size);
-                }
-                break;
-            }
+            case DataType::TEXT:
+            case DataType::ARRAY:
             case DataType::JSON: {
-                for (size_t offset = 0; offset < field_data->get_num_rows();
-                     ++offset) {
-                    auto string_view =
-                        static_cast<const Json*>(field_data->RawValue(offset))
-                            ->data();
-                    auto size =
-                        field_data->is_valid(offset) ? string_view.size() : -1;
-                    payload_writer->add_one_binary_payload(
-                        reinterpret_cast<const uint8_t*>(
-                            std::string(string_view).c_str()),
-                        size);
-                }
+                payload_writer->add_variable_length_payload(*field_data);
                 break;
             }
             case DataType::VECTOR_SPARSE_FLOAT: {
@@ -25,6 +25,7 @@ FileWriter::FileWriter(std::string filename) : filename_(std::move(filename)) {
     auto mode = GetMode();
     use_direct_io_ = mode == WriteMode::DIRECT;
     auto open_flags = O_CREAT | O_RDWR | O_TRUNC;
+    InitIoUring();
     if (use_direct_io_) {
         // check if the file is aligned to the alignment size
         size_t buf_size = GetBufferSize();
@@ -36,13 +37,17 @@ FileWriter::FileWriter(std::string filename) : filename_(std::move(filename)) {
             ALIGNMENT_BYTES,
             strerror(errno));
         capacity_ = buf_size;
-        auto err = posix_memalign(&aligned_buf_, ALIGNMENT_BYTES, capacity_);
-        if (err != 0) {
-            aligned_buf_ = nullptr;
-            PanicInfo(
-                ErrorCode::MemAllocateFailed,
-                "Failed to allocate aligned buffer for direct io, error: {}",
-                strerror(err));
+        // the io_uring buffers are aligned as well
+        if (ring_ == nullptr) {
+            auto err =
+                posix_memalign(&aligned_buf_, ALIGNMENT_BYTES, capacity_);
+            if (err != 0) {
+                aligned_buf_ = nullptr;
+                PanicInfo(ErrorCode::MemAllocateFailed,
+                          "Failed to allocate aligned buffer for direct io, "
+                          "error: {}",
+                          strerror(err));
+            }
         }
 #ifndef __APPLE__
         open_flags |= O_DIRECT;
@@ -76,8 +81,50 @@ FileWriter::~FileWriter() {
     Cleanup();
 }
 
+void
+FileWriter::InitIoUring() {
+    auto queue_depth = IoUring::GetQueueDepth();
+    if (queue_depth == 0) {
+        return;
+    }
+    ring_ = IoUring::Create(queue_depth);
+    if (ring_ == nullptr) {
+        return;
+    }
+
+    capacity_ = GetBufferSize();
+    std::vector<iovec> iovecs;
+    iovecs.reserve(queue_depth);
+    for (uint32_t i = 0; i < queue_depth; ++i) {
+        void* buf = nullptr;
+        auto err = posix_memalign(&buf, ALIGNMENT_BYTES, capacity_);
+        if (err != 0) {
+            Cleanup();
+            PanicInfo(ErrorCode::MemAllocateFailed,
+                      "Failed to allocate io_uring buffer, error: {}",
+                      strerror(err));
+        }
+        ring_bufs_.push_back(buf);
+        iovecs.push_back({buf, capacity_});
+    }
+    ring_bufs_registered_ = ring_->RegisterBuffers(iovecs);
+    ring_writes_.resize(queue_depth);
+    // popped from the back, so that buffer 0 is used first
+    for (int i = static_cast<int>(queue_depth) - 1; i >= 0; --i) {
+        free_bufs_.push_back(i);
+    }
+}
+
 void
 FileWriter::Cleanup() noexcept {
+    // the kernel may still read the buffers of the writes in flight
+    while (inflight_ > 0) {
+        IoUring::Completion completion;
+        if (ring_->WaitCompletion(completion) != 0) {
+            break;
+        }
+        --inflight_;
+    }
     if (fd_ != -1) {
         close(fd_);
         fd_ = -1;
@@ -86,6 +133,17 @@ FileWriter::Cleanup() noexcept {
         free(aligned_buf_);
         aligned_buf_ = nullptr;
     }
+    ring_.reset();
+    // leaked rather than freed if writes may still be in flight
+    if (inflight_ == 0) {
+        for (auto buf : ring_bufs_) {
+            free(buf);
+        }
+    }
+    ring_bufs_.clear();
+    free_bufs_.clear();
+    cur_buf_ = -1;
+    inflight_ = 0;
 }
 
 bool
@@ -183,6 +241,119 @@ FileWriter::WriteWithDirectIO(const void* data, size_t nbyte) {
     monitor::disk_write_total_bytes_direct.Increment(nbyte);
 }
 
+void
+FileWriter::SubmitIoUringBuffer(size_t nbyte) {
+    ring_writes_[cur_buf_] = {file_size_, nbyte};
+    ring_->PrepWrite(fd_,
+                     ring_bufs_[cur_buf_],
+                     nbyte,
+                     file_size_,
+                     cur_buf_,
+                     ring_bufs_registered_ ? cur_buf_ : -1);
+    auto ret = ring_->Submit();
+    if (ret != 0) {
+        Cleanup();
+        PanicInfo(ErrorCode::FileWriteFailed,
+                  "Failed to submit write to file: {}, error: {}",
+                  filename_,
+                  strerror(-ret));
+    }
+    ++inflight_;
+    cur_buf_ = -1;
+    offset_ = 0;
+}
+
+void
+FileWriter::ReapIoUring() {
+    IoUring::Completion completion;
+    auto ret = ring_->WaitCompletion(completion);
+    if (ret != 0) {
+        Cleanup();
+        PanicInfo(ErrorCode::FileWriteFailed,
+                  "Failed to wait for write to file: {}, error: {}",
+                  filename_,
+                  strerror(-ret));
+    }
+    --inflight_;
+    auto buf_index = static_cast<int>(completion.user_data_);
+    if (completion.res_ < 0) {
+        Cleanup();
+        PanicInfo(ErrorCode::FileWriteFailed,
+                  "Failed to write to file: {}, error: {}",
+                  filename_,
+                  strerror(-completion.res_));
+    }
+    auto [file_offset, nbyte] = ring_writes_[buf_index];
+    auto done = static_cast<size_t>(completion.res_);
+    if (done < nbyte) {
+        // short write, the rest is written in place
+        PositionedWriteWithCheck(
+            static_cast<char*>(ring_bufs_[buf_index]) + done,
+            nbyte - done,
+            file_offset + done);
+    }
+    free_bufs_.push_back(buf_index);
+}
+
+void
+FileWriter::WriteWithIoUring(const void* data, size_t nbyte) {
+    const char* src = static_cast<const char*>(data);
+    size_t left_size = nbyte;
+    while (left_size != 0) {
+        if (cur_buf_ == -1) {
+            if (free_bufs_.empty()) {
+                ReapIoUring();
+            }
+            cur_buf_ = free_bufs_.back();
+            free_bufs_.pop_back();
+        }
+        size_t copy_size = std::min(left_size, capacity_ - offset_);
+        memcpy(static_cast<char*>(ring_bufs_[cur_buf_]) + offset_,
+               src,
+               copy_size);
+        offset_ += copy_size;
+        src += copy_size;
+        left_size -= copy_size;
+        if (offset_ == capacity_) {
+            SubmitIoUringBuffer(capacity_);
+            file_size_ += capacity_;
+        }
+    }
+
+    if (use_direct_io_) {
+        monitor::disk_write_total_bytes_direct.Increment(nbyte);
+    } else {
+        monitor::disk_write_total_bytes_buffered.Increment(nbyte);
+    }
+}
+
+void
+FileWriter::FlushWithIoUring() {
+    if (offset_ != 0) {
+        size_t tail_size = offset_;
+        size_t nbyte = offset_;
+        if (use_direct_io_) {
+            nbyte = (offset_ + ALIGNMENT_MASK) & ~ALIGNMENT_MASK;
+            memset(static_cast<char*>(ring_bufs_[cur_buf_]) + offset_,
+                   0,
+                   nbyte - offset_);
+        }
+        SubmitIoUringBuffer(nbyte);
+        file_size_ += tail_size;
+    }
+    while (inflight_ > 0) {
+        ReapIoUring();
+    }
+    // the padding of the aligned tail is cut as in FlushWithDirectIO
+    if (use_direct_io_ && ftruncate(fd_, file_size_) != 0) {
+        Cleanup();
+        PanicInfo(ErrorCode::FileWriteFailed,
+                  "Failed to truncate file: {}, error: {}",
+                  filename_,
+                  strerror(errno));
+    }
+}
+
 void
 FileWriter::WriteWithBufferedIO(const void* data, size_t nbyte) {
     PositionedWriteWithCheck(data, nbyte, file_size_);
@@ -197,6 +368,12 @@ FileWriter::Write(const void* data, size_t nbyte) {
         return;
     }
 
+    // io_uring writes are asynchronous already, no need for the workers
+    if (ring_ != nullptr) {
+        WriteWithIoUring(data, nbyte);
+        return;
+    }
+
     auto promise = std::make_shared<folly::Promise<folly::Unit>>();
     auto future = promise->getFuture();
     auto task = [this, data, nbyte, promise]() {
@@ -257,6 +434,12 @@ size_t
 FileWriter::Finish() {
     AssertInfo(fd_ != -1, "FileWriter is not initialized or finished");
 
+    if (ring_ != nullptr) {
+        FlushWithIoUring();
+        Cleanup();
+        return file_size_;
+    }
+
     // if the aligned buffer is not empty, we should flush it to the file
     if (offset_ != 0) {
         auto promise = std::make_shared<folly::Promise<folly::Unit>>();
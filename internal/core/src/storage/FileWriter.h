@@ -29,6 +29,7 @@
 #include <folly/executors/SerialExecutor.h>
 
 #include "common/EasyAssert.h"
+#include "storage/IoUring.h"
 #include "storage/PayloadWriter.h"
 #include "storage/ThreadPools.h"
 
@@ -37,6 +38,8 @@ namespace milvus::storage {
 /**
  * FileWriter is a class that sequentially writes data to new files, designed specifically for saving temporary data downloaded from remote storage.
  * It supports both buffered and direct I/O, and can use an additional thread pool to write data to files.
+ * If an io_uring queue depth is configured and io_uring is available, the data is instead copied to a ring of registered
+ * buffers and written asynchronously, with up to queue depth buffers in flight, and the thread pool is not used.
  * FileWriter is not thread-safe, so you should take care of the thread safety when using the same FileWriter object in multiple threads.
  * For now, only QueryNode uses FileWriter to write data to files. If you want to use it in DataNode, you need to add it to the configuration.
  *
@@ -102,6 +105,23 @@ class FileWriter {
                              size_t nbyte,
                              size_t file_offset);
 
+    void
+    InitIoUring();
+
+    void
+    WriteWithIoUring(const void* data, size_t nbyte);
+
+    void
+    FlushWithIoUring();
+
+    // submits the filled current buffer, at file_size_
+    void
+    SubmitIoUringBuffer(size_t nbyte);
+
+    // waits for one write in flight and returns its buffer to free_bufs_
+    void
+    ReapIoUring();
+
     void
     Cleanup() noexcept;
 
@@ -115,6 +135,16 @@ class FileWriter {
     size_t capacity_{0};
     size_t offset_{0};
 
+    // for io_uring, every buffer has capacity_ bytes
+    std::unique_ptr<IoUring> ring_{nullptr};
+    std::vector<void*> ring_bufs_{};
+    bool ring_bufs_registered_{false};
+    // offset and size of the write in flight of every buffer
+    std::vector<std::pair<size_t, size_t>> ring_writes_{};
+    std::vector<int> free_bufs_{};
+    int cur_buf_{-1};
+    size_t inflight_{0};
+
     // for global configuration
     static WriteMode
         mode_;  // The write mode, which can be 'buffered' (default) or 'direct'.
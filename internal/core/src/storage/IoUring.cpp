@@ -0,0 +1,373 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/IoUring.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup)
+#define MILVUS_WITH_IO_URING 1
+#endif
+#endif
+
+#include "common/EasyAssert.h"
+#include "log/Log.h"
+
+namespace milvus::storage {
+
+std::atomic<uint32_t> IoUring::queue_depth_config_{0};
+
+void
+IoUring::SetQueueDepth(int queue_depth) {
+    if (queue_depth < 0) {
+        LOG_WARN("Invalid io_uring queue depth: {}, expected: >= 0, set to 0",
+                 queue_depth);
+        queue_depth = 0;
+    } else if (queue_depth > static_cast<int>(MAX_QUEUE_DEPTH)) {
+        LOG_WARN(
+            "Invalid io_uring queue depth: {}, expected: <= {}, set to {}",
+            queue_depth,
+            MAX_QUEUE_DEPTH,
+            MAX_QUEUE_DEPTH);
+        queue_depth = MAX_QUEUE_DEPTH;
+    }
+    queue_depth_config_.store(queue_depth);
+    LOG_INFO("Set io_uring queue depth to {}", queue_depth);
+}
+
+uint32_t
+IoUring::GetQueueDepth() {
+    return queue_depth_config_.load();
+}
+
+namespace {
+thread_local std::unique_ptr<IoUring> thread_ring;
+thread_local uint32_t thread_ring_queue_depth = 0;
+}  // namespace
+
+IoUring*
+IoUring::ThreadLocal() {
+    auto queue_depth = GetQueueDepth();
+    if (queue_depth != thread_ring_queue_depth) {
+        // a failed Create is not retried until the config changes
+        thread_ring = queue_depth > 0 ? Create(queue_depth) : nullptr;
+        thread_ring_queue_depth = queue_depth;
+    }
+    return thread_ring.get();
+}
+
+void
+IoUring::AbandonThreadLocal() {
+    // leaked, the kernel may still complete its requests
+    thread_ring.release();
+    thread_ring_queue_depth = 0;
+}
+
+#ifdef MILVUS_WITH_IO_URING
+
+namespace {
+// logs the reason of the first fallback only, as every writer tries
+std::atomic<bool> unavailable_logged{false};
+
+void
+LogUnavailable(const char* what, int err) {
+    if (!unavailable_logged.exchange(true)) {
+        LOG_WARN("io_uring is unavailable, {} failed: {}, fall back to "
+                 "blocking io",
+                 what,
+                 strerror(err));
+    }
+}
+}  // namespace
+
+std::unique_ptr<IoUring>
+IoUring::Create(uint32_t queue_depth) {
+    AssertInfo(queue_depth > 0 && queue_depth <= MAX_QUEUE_DEPTH,
+               "invalid io_uring queue depth {}",
+               queue_depth);
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = syscall(__NR_io_uring_setup, queue_depth, &params);
+    if (fd < 0) {
+        LogUnavailable("io_uring_setup", errno);
+        return nullptr;
+    }
+
+    std::unique_ptr<IoUring> ring(new IoUring());
+    ring->ring_fd_ = fd;
+#ifdef IORING_FEAT_RW_CUR_POS
+    // came with IORING_OP_READ and IORING_OP_WRITE in linux 5.6
+    if ((params.features & IORING_FEAT_RW_CUR_POS) == 0) {
+        LogUnavailable("probe of IORING_OP_WRITE", EINVAL);
+        return nullptr;
+    }
+#endif
+    ring->queue_depth_ = queue_depth;
+    ring->sq_ring_size_ =
+        params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size_ =
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = false;
+#ifdef IORING_FEAT_SINGLE_MMAP
+    single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+#endif
+    if (single_mmap) {
+        ring->sq_ring_size_ = ring->cq_ring_size_ =
+            std::max(ring->sq_ring_size_, ring->cq_ring_size_);
+    }
+
+    auto map = [fd](size_t size, off_t offset) -> void* {
+        auto ptr = mmap(nullptr,
+                        size,
+                        PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE,
+                        fd,
+                        offset);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+    };
+    ring->sq_ring_ = map(ring->sq_ring_size_, IORING_OFF_SQ_RING);
+    if (ring->sq_ring_ == nullptr) {
+        LogUnavailable("mmap of the submission queue", errno);
+        return nullptr;
+    }
+    if (single_mmap) {
+        ring->cq_ring_ = ring->sq_ring_;
+    } else {
+        ring->cq_ring_ = map(ring->cq_ring_size_, IORING_OFF_CQ_RING);
+        if (ring->cq_ring_ == nullptr) {
+            LogUnavailable("mmap of the completion queue", errno);
+            return nullptr;
+        }
+    }
+    ring->sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    ring->sqes_ = map(ring->sqes_size_, IORING_OFF_SQES);
+    if (ring->sqes_ == nullptr) {
+        LogUnavailable("mmap of the submission entries", errno);
+        return nullptr;
+    }
+
+    auto sq = static_cast<char*>(ring->sq_ring_);
+    ring->sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    ring->sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    ring->sq_mask_ =
+        reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    ring->sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    auto cq = static_cast<char*>(ring->cq_ring_);
+    ring->cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    ring->cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    ring->cq_mask_ =
+        reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    ring->cqes_ = cq + params.cq_off.cqes;
+    ring->prepared_ = ring->submitted_ = *ring->sq_tail_;
+    return ring;
+}
+
+IoUring::~IoUring() {
+    if (sqes_ != nullptr) {
+        munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+        munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != nullptr) {
+        munmap(sq_ring_, sq_ring_size_);
+    }
+    if (ring_fd_ != -1) {
+        close(ring_fd_);
+    }
+}
+
+bool
+IoUring::RegisterBuffers(const std::vector<iovec>& buffers) {
+    auto ret = syscall(__NR_io_uring_register,
+                       ring_fd_,
+                       IORING_REGISTER_BUFFERS,
+                       buffers.data(),
+                       buffers.size());
+    if (ret != 0) {
+        LOG_DEBUG("Failed to register {} io_uring buffers: {}",
+                  buffers.size(),
+                  strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+void
+IoUring::Prep(uint8_t opcode,
+              int fd,
+              const void* buf,
+              uint32_t nbyte,
+              uint64_t offset,
+              uint64_t user_data,
+              int buf_index) {
+    auto head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    AssertInfo(prepared_ - head < queue_depth_,
+               "io_uring submission queue is full, queue depth: {}",
+               queue_depth_);
+    auto index = prepared_ & *sq_mask_;
+    auto sqe = static_cast<io_uring_sqe*>(sqes_) + index;
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(buf);
+    sqe->len = nbyte;
+    sqe->off = offset;
+    sqe->user_data = user_data;
+    if (buf_index >= 0) {
+        sqe->buf_index = buf_index;
+    }
+    sq_array_[index] = index;
+    ++prepared_;
+}
+
+void
+IoUring::PrepWrite(int fd,
+                   const void* buf,
+                   uint32_t nbyte,
+                   uint64_t offset,
+                   uint64_t user_data,
+                   int buf_index) {
+    Prep(buf_index >= 0 ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE,
+         fd,
+         buf,
+         nbyte,
+         offset,
+         user_data,
+         buf_index);
+}
+
+void
+IoUring::PrepRead(int fd,
+                  void* buf,
+                  uint32_t nbyte,
+                  uint64_t offset,
+                  uint64_t user_data,
+                  int buf_index) {
+    Prep(buf_index >= 0 ? IORING_OP_READ_FIXED : IORING_OP_READ,
+         fd,
+         buf,
+         nbyte,
+         offset,
+         user_data,
+         buf_index);
+}
+
+int
+IoUring::Submit(uint32_t min_complete) {
+    __atomic_store_n(sq_tail_, prepared_, __ATOMIC_RELEASE);
+    unsigned flags = min_complete > 0 ? IORING_ENTER_GETEVENTS : 0;
+    while (true) {
+        auto to_submit = prepared_ - submitted_;
+        auto ret = syscall(__NR_io_uring_enter,
+                           ring_fd_,
+                           to_submit,
+                           min_complete,
+                           flags,
+                           nullptr,
+                           0);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -errno;
+        }
+        submitted_ += ret;
+        if (submitted_ == prepared_) {
+            return 0;
+        }
+    }
+}
+
+bool
+IoUring::PopCompletion(Completion& completion) {
+    auto head = *cq_head_;
+    if (head == __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    auto cqe = static_cast<io_uring_cqe*>(cqes_) + (head & *cq_mask_);
+    completion.user_data_ = cqe->user_data;
+    completion.res_ = cqe->res;
+    __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+#else
+
+std::unique_ptr<IoUring>
+IoUring::Create(uint32_t queue_depth) {
+    return nullptr;
+}
+
+IoUring::~IoUring() = default;
+
+bool
+IoUring::RegisterBuffers(const std::vector<iovec>& buffers) {
+    return false;
+}
+
+void
+IoUring::PrepWrite(int fd,
+                   const void* buf,
+                   uint32_t nbyte,
+                   uint64_t offset,
+                   uint64_t user_data,
+                   int buf_index) {
+    PanicInfo(NotImplemented, "io_uring is not supported on this platform");
+}
+
+void
+IoUring::PrepRead(int fd,
+                  void* buf,
+                  uint32_t nbyte,
+                  uint64_t offset,
+                  uint64_t user_data,
+                  int buf_index) {
+    PanicInfo(NotImplemented, "io_uring is not supported on this platform");
+}
+
+int
+IoUring::Submit(uint32_t min_complete) {
+    return -ENOSYS;
+}
+
+bool
+IoUring::PopCompletion(Completion& completion) {
+    return false;
+}
+
+#endif
+
+int
+IoUring::WaitCompletion(Completion& completion) {
+    while (!PopCompletion(completion)) {
+        auto ret = Submit(1);
+        if (ret != 0) {
+            return ret;
+        }
+    }
+    return 0;
+}
+
+}  // namespace milvus::storage
@@ -0,0 +1,166 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <sys/uio.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace milvus::storage {
+
+/**
+ * IoUring is a minimal Linux io_uring ring driven by the raw system calls,
+ * used to keep many local disk reads and writes in flight from one thread.
+ * Create returns nullptr when the kernel or the build has no io_uring, or
+ * when it is denied (e.g. by seccomp), and the callers fall back to the
+ * blocking pread / pwrite paths.
+ *
+ * IoUring is not thread-safe, every ring must be used by one thread at a
+ * time. At most queue_depth() requests may be in flight, i.e. prepared and
+ * not yet popped as completions.
+ *
+ * The basic usage is:
+ *
+ * auto ring = IoUring::Create(32);
+ * ring->PrepWrite(fd, buf, size, offset, user_data);
+ * ring->Submit();
+ * IoUring::Completion completion;
+ * ring->WaitCompletion(completion);
+ */
+class IoUring {
+ public:
+    static constexpr uint32_t MAX_QUEUE_DEPTH = 4096;
+
+    struct Completion {
+        uint64_t user_data_{0};
+        // bytes transferred, or -errno
+        int32_t res_{0};
+    };
+
+    static std::unique_ptr<IoUring>
+    Create(uint32_t queue_depth);
+
+    // Ring of the calling thread with the configured queue depth, nullptr
+    // if io_uring is disabled or unavailable.
+    static IoUring*
+    ThreadLocal();
+
+    // Drops the ring of the calling thread without waiting for its requests
+    // in flight, for when they can no longer be reaped. The next ThreadLocal
+    // call creates a new ring.
+    static void
+    AbandonThreadLocal();
+
+    ~IoUring();
+
+    IoUring(const IoUring&) = delete;
+    IoUring&
+    operator=(const IoUring&) = delete;
+
+    // Registers buffers the kernel can access without mapping them per
+    // request, their indexes can then be passed as buf_index. Returns
+    // false if the registration failed, e.g. over RLIMIT_MEMLOCK.
+    bool
+    RegisterBuffers(const std::vector<iovec>& buffers);
+
+    void
+    PrepWrite(int fd,
+              const void* buf,
+              uint32_t nbyte,
+              uint64_t offset,
+              uint64_t user_data,
+              int buf_index = -1);
+
+    void
+    PrepRead(int fd,
+             void* buf,
+             uint32_t nbyte,
+             uint64_t offset,
+             uint64_t user_data,
+             int buf_index = -1);
+
+    // Submits the prepared requests and waits for at least min_complete
+    // completions, returns 0 or -errno.
+    int
+    Submit(uint32_t min_complete = 0);
+
+    // Returns false if no completion is ready.
+    bool
+    PopCompletion(Completion& completion);
+
+    // Submits the prepared requests and blocks until a completion is ready,
+    // returns 0 or -errno.
+    int
+    WaitCompletion(Completion& completion);
+
+    uint32_t
+    queue_depth() const {
+        return queue_depth_;
+    }
+
+    // static functions for global configuration, a queue depth of 0
+    // disables io_uring
+    static void
+    SetQueueDepth(int queue_depth);
+
+    static uint32_t
+    GetQueueDepth();
+
+ private:
+    IoUring() = default;
+
+    void
+    Prep(uint8_t opcode,
+         int fd,
+         const void* buf,
+         uint32_t nbyte,
+         uint64_t offset,
+         uint64_t user_data,
+         int buf_index);
+
+    int ring_fd_{-1};
+    uint32_t queue_depth_{0};
+
+    void* sq_ring_{nullptr};
+    size_t sq_ring_size_{0};
+    void* cq_ring_{nullptr};
+    size_t cq_ring_size_{0};
+    void* sqes_{nullptr};
+    size_t sqes_size_{0};
+
+    // shared with the kernel
+    unsigned* sq_head_{nullptr};
+    unsigned* sq_tail_{nullptr};
+    unsigned* sq_mask_{nullptr};
+    unsigned* sq_array_{nullptr};
+    unsigned* cq_head_{nullptr};
+    unsigned* cq_tail_{nullptr};
+    unsigned* cq_mask_{nullptr};
+    void* cqes_{nullptr};
+
+    // prepared and submitted sqes, the kernel sees the former on Submit
+    unsigned prepared_{0};
+    unsigned submitted_{0};
+
+    static std::atomic<uint32_t> queue_depth_config_;
+};
+
+}  // namespace milvus::storage
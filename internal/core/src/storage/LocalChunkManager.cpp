@@ -21,14 +21,150 @@
 
 #include <boost/filesystem.hpp>
 #include <boost/system/error_code.hpp>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <fstream>
 #include <sstream>
 
 #include "common/EasyAssert.h"
 #include "common/Exception.h"
+#include "storage/IoUring.h"
 
 namespace milvus::storage {
 
+namespace {
+// reads of at least this size go through the io_uring of the calling
+// thread, split into parts of this size which are read concurrently
+constexpr uint64_t kIoUringReadPartSize = 1 << 20;
+
+// pread until nbyte bytes are read, returns 0 or the errno, EIO if the file
+// ends before
+int
+PositionedReadFully(int fd, char* buf, uint64_t nbyte, uint64_t offset) {
+    while (nbyte != 0) {
+        auto done = pread(fd, buf, nbyte, offset);
+        if (done < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno;
+        }
+        if (done == 0) {
+            return EIO;
+        }
+        buf += done;
+        nbyte -= done;
+        offset += done;
+    }
+    return 0;
+}
+
+// WaitCompletion retrying the errors of an interrupted or busy wait,
+// returns 0 or -errno
+int
+WaitCompletionRetry(IoUring& ring, IoUring::Completion& completion) {
+    while (true) {
+        auto ret = ring.WaitCompletion(completion);
+        if (ret != -EINTR && ret != -EAGAIN && ret != -EBUSY) {
+            return ret;
+        }
+    }
+}
+
+uint64_t
+ReadWithIoUring(IoUring& ring,
+                const std::string& filepath,
+                uint64_t offset,
+                void* buf,
+                uint64_t size) {
+    int fd = open(filepath.c_str(), O_RDONLY);
+    if (fd == -1) {
+        PanicInfo(FileOpenFailed,
+                  fmt::format("Error: open local file '{}' failed, {}",
+                              filepath,
+                              strerror(errno)));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        auto err = errno;
+        close(fd);
+        PanicInfo(FileReadFailed,
+                  fmt::format("Error: stat local file '{}' failed, {}",
+                              filepath,
+                              strerror(err)));
+    }
+    // as the stream read, stop at the end of the file
+    auto file_size = static_cast<uint64_t>(st.st_size);
+    size = offset < file_size ? std::min(size, file_size - offset) : 0;
+
+    auto dst = static_cast<char*>(buf);
+    auto num_parts = (size + kIoUringReadPartSize - 1) / kIoUringReadPartSize;
+    auto part_size = [&](uint64_t part) {
+        return std::min(kIoUringReadPartSize,
+                        size - part * kIoUringReadPartSize);
+    };
+    uint64_t next_part = 0;
+    uint64_t inflight = 0;
+    int err = 0;
+    int wait_err = 0;
+    while ((err == 0 && next_part < num_parts) || inflight > 0) {
+        while (err == 0 && next_part < num_parts &&
+               inflight < ring.queue_depth()) {
+            auto part_offset = next_part * kIoUringReadPartSize;
+            ring.PrepRead(fd,
+                          dst + part_offset,
+                          part_size(next_part),
+                          offset + part_offset,
+                          next_part);
+            ++next_part;
+            ++inflight;
+        }
+        IoUring::Completion completion;
+        auto ret = WaitCompletionRetry(ring, completion);
+        if (ret != 0) {
+            // the reads in flight can no longer be reaped
+            wait_err = -ret;
+            break;
+        }
+        --inflight;
+        if (completion.res_ < 0) {
+            err = err == 0 ? -completion.res_ : err;
+            continue;
+        }
+        auto part = completion.user_data_;
+        auto done = static_cast<uint64_t>(completion.res_);
+        auto nbyte = part_size(part);
+        if (done < nbyte) {
+            // short read, the rest is read in place
+            auto part_offset = part * kIoUringReadPartSize + done;
+            auto read_err = PositionedReadFully(
+                fd, dst + part_offset, nbyte - done, offset + part_offset);
+            err = err == 0 ? read_err : err;
+        }
+    }
+    if (wait_err != 0) {
+        // the fd is kept open so that its number is not reused while the
+        // kernel may still read it, and the completions still to come must
+        // not reach the next read of this thread
+        IoUring::AbandonThreadLocal();
+        PanicInfo(FileReadFailed,
+                  fmt::format("Error: wait for reads of local file '{}' "
+                              "failed, {}",
+                              filepath,
+                              strerror(wait_err)));
+    }
+    close(fd);
+    if (err != 0) {
+        PanicInfo(FileReadFailed,
+                  fmt::format("Error: read local file '{}' failed, {}",
+                              filepath,
+                              strerror(err)));
+    }
+    return size;
+}
+}  // namespace
+
 bool
 LocalChunkManager::Exist(const std::string& filepath) {
     boost::filesystem::path absPath(filepath);
@@ -84,6 +220,13 @@ LocalChunkManager::Read(const std::string& filepath,
                         uint64_t offset,
                         void* buf,
                         uint64_t size) {
+    if (size >= kIoUringReadPartSize) {
+        auto ring = IoUring::ThreadLocal();
+        if (ring != nullptr) {
+            return ReadWithIoUring(*ring, filepath, offset, buf, size);
+        }
+    }
+
     std::ifstream infile;
     infile.open(filepath.data(), std::ios_base::binary);
     if (infile.fail()) {
@@ -16,12 +16,18 @@
 
 #include "storage/MinioChunkManager.h"
 
+#include <algorithm>
 #include <fstream>
 #include <aws/core/auth/AWSCredentials.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/auth/STSCredentialsProvider.h>
 #include <aws/core/utils/logging/ConsoleLogSystem.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/CompletedMultipartUpload.h>
+#include <aws/s3/model/CompletedPart.h>
 #include <aws/s3/model/CreateBucketRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
 #include <aws/s3/model/DeleteBucketRequest.h>
 #include <aws/s3/model/DeleteObjectRequest.h>
 #include <aws/s3/model/GetObjectRequest.h>
@@ -29,6 +35,7 @@
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <aws/s3/model/ListObjectsRequest.h>
 #include <aws/s3/model/PutObjectRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
 
 #include "storage/AliyunSTSClient.h"
 #include "storage/AliyunCredentialsProvider.h"
@@ -38,7 +45,10 @@
 #include "common/EasyAssert.h"
 #include "log/Log.h"
 #include "signal.h"
+#include "common/Common.h"
 #include "common/Consts.h"
+#include "futures/Executor.h"
+#include "futures/ParallelFor.h"
 
 namespace milvus::storage {
 
@@ -61,6 +71,35 @@ SwallowHandler(int signal) {
 #pragma GCC diagnostic pop
 }
 
+// upper bound of the parts of one object in flight at the same time
+constexpr uint64_t kMaxPartParallelism = 16;
+constexpr int kPartMaxAttempts = 3;
+
+/**
+ * @brief run fn(part) for every part in [0, num_parts), with
+ * futures::ParallelFor on up to kMaxPartParallelism workers of the io
+ * executor, the calling thread included. An exception thrown by fn stops
+ * the remaining parts and is rethrown once all started workers are done.
+ */
+static void
+ForEachPart(uint64_t num_parts, const std::function<void(uint64_t)>& fn) {
+    std::atomic<uint64_t> next_part{0};
+    auto run = [&](int64_t) {
+        for (auto part = next_part.fetch_add(1); part < num_parts;
+             part = next_part.fetch_add(1)) {
+            try {
+                fn(part);
+            } catch (...) {
+                next_part = num_parts;
+                throw;
+            }
+        }
+    };
+    milvus::futures::ParallelFor(milvus::futures::getGlobalIOExecutor(),
+                                 std::min(num_parts, kMaxPartParallelism),
+                                 run);
+}
+
 /**
  * @brief convert std::string to Aws::String
  * because Aws has String type internally
@@ -568,6 +607,12 @@ MinioChunkManager::PutObjectBuffer(const std::string& bucket_name,
                                    const std::string& object_name,
                                    void* buf,
                                    uint64_t size) {
+    auto part_size = static_cast<uint64_t>(STORAGE_MULTIPART_SIZE);
+    if (part_size > 0 && size > part_size) {
+        return PutObjectBufferInParts(
+            bucket_name, object_name, buf, size, part_size);
+    }
+
     Aws::S3::Model::PutObjectRequest request;
     request.SetBucket(bucket_name.c_str());
     request.SetKey(object_name.c_str());
@@ -599,6 +644,116 @@ MinioChunkManager::PutObjectBuffer(const std::string& bucket_name,
     return true;
 }
 
+bool
+MinioChunkManager::PutObjectBufferInParts(const std::string& bucket_name,
+                                          const std::string& object_name,
+                                          void* buf,
+                                          uint64_t size,
+                                          uint64_t part_size) {
+    Aws::S3::Model::CreateMultipartUploadRequest create_request;
+    create_request.SetBucket(bucket_name.c_str());
+    create_request.SetKey(object_name.c_str());
+    auto create_outcome = client_->CreateMultipartUpload(create_request);
+    if (!create_outcome.IsSuccess()) {
+        monitor::internal_storage_op_count_put_fail.Increment();
+        ThrowS3Error("CreateMultipartUpload",
+                     create_outcome.GetError(),
+                     "params, bucket={}, object={}",
+                     bucket_name,
+                     object_name);
+    }
+    auto upload_id = create_outcome.GetResult().GetUploadId();
+
+    auto data = static_cast<char*>(buf);
+    auto num_parts = (size + part_size - 1) / part_size;
+    std::vector<Aws::S3::Model::CompletedPart> parts(num_parts);
+    try {
+        ForEachPart(num_parts, [&](uint64_t part) {
+            auto offset = part * part_size;
+            auto length = std::min(part_size, size - offset);
+            // part numbers of s3 start from 1
+            auto part_number = static_cast<int>(part + 1);
+
+            Aws::S3::Model::UploadPartRequest request;
+            request.SetBucket(bucket_name.c_str());
+            request.SetKey(object_name.c_str());
+            request.SetUploadId(upload_id);
+            request.SetPartNumber(part_number);
+            request.SetContentLength(length);
+
+            const std::shared_ptr<Aws::IOStream> input_data =
+                Aws::MakeShared<Aws::StringStream>("");
+            input_data->write(data + offset, length);
+            request.SetBody(input_data);
+
+            for (int attempt = 1;; ++attempt) {
+                input_data->clear();
+                input_data->seekg(0);
+                auto start = std::chrono::system_clock::now();
+                auto outcome = client_->UploadPart(request);
+                monitor::internal_storage_request_latency_put.Observe(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::system_clock::now() - start)
+                        .count());
+                if (outcome.IsSuccess()) {
+                    parts[part].SetETag(outcome.GetResult().GetETag());
+                    parts[part].SetPartNumber(part_number);
+                    return;
+                }
+                const auto& err = outcome.GetError();
+                if (attempt >= kPartMaxAttempts) {
+                    ThrowS3Error("UploadPart",
+                                 err,
+                                 "params, bucket={}, object={}, part={}",
+                                 bucket_name,
+                                 object_name,
+                                 part_number);
+                }
+                LOG_WARN("retry uploading part {} of object {}, attempt {}: {}",
+                         part_number,
+                         object_name,
+                         attempt,
+                         ConvertFromAwsString(err.GetMessage()));
+            }
+        });
+
+        Aws::S3::Model::CompletedMultipartUpload completed;
+        completed.SetParts(std::move(parts));
+        Aws::S3::Model::CompleteMultipartUploadRequest complete_request;
+        complete_request.SetBucket(bucket_name.c_str());
+        complete_request.SetKey(object_name.c_str());
+        complete_request.SetUploadId(upload_id);
+        complete_request.SetMultipartUpload(std::move(completed));
+        auto complete_outcome =
+            client_->CompleteMultipartUpload(complete_request);
+        if (!complete_outcome.IsSuccess()) {
+            ThrowS3Error("CompleteMultipartUpload",
+                         complete_outcome.GetError(),
+                         "params, bucket={}, object={}",
+                         bucket_name,
+                         object_name);
+        }
+    } catch (...) {
+        monitor::internal_storage_op_count_put_fail.Increment();
+        // best effort, the original error is what the caller should see
+        Aws::S3::Model::AbortMultipartUploadRequest abort_request;
+        abort_request.SetBucket(bucket_name.c_str());
+        abort_request.SetKey(object_name.c_str());
+        abort_request.SetUploadId(upload_id);
+        auto abort_outcome = client_->AbortMultipartUpload(abort_request);
+        if (!abort_outcome.IsSuccess()) {
+            LOG_WARN("failed to abort multipart upload of object {}: {}",
+                     object_name,
+                     ConvertFromAwsString(
+                         abort_outcome.GetError().GetMessage()));
+        }
+        throw;
+    }
+    monitor::internal_storage_kv_size_put.Observe(size);
+    monitor::internal_storage_op_count_put_suc.Increment();
+    return true;
+}
+
 class AwsStreambuf : public std::streambuf {
  public:
     AwsStreambuf(char* buffer, std::streamsize buffer_size) {
@@ -638,27 +793,40 @@ class AwsResponseStream : public Aws::IOStream {
     AwsStreambuf aws_streambuf;
 };
 
+// response body is written straight into [buf, buf + size)
+static Aws::IOStreamFactory
+BufferStreamFactory(char* buf, uint64_t size) {
+    return [buf, size]() {
+    // For macOs, pubsetbuf interface not implemented
+#ifdef __linux__
+        std::unique_ptr<Aws::StringStream> stream(
+            Aws::New<Aws::StringStream>(""));
+        stream->rdbuf()->pubsetbuf(buf, size);
+#else
+        std::unique_ptr<Aws::IOStream> stream(
+            Aws::New<AwsResponseStream>("AwsResponseStream", buf, size));
+#endif
+        return stream.release();
+    };
+}
+
 uint64_t
 MinioChunkManager::GetObjectBuffer(const std::string& bucket_name,
                                    const std::string& object_name,
                                    void* buf,
                                    uint64_t size) {
+    auto part_size = static_cast<uint64_t>(STORAGE_MULTIPART_SIZE);
+    if (part_size > 0 && size > part_size) {
+        return GetObjectBufferInParts(
+            bucket_name, object_name, buf, size, part_size);
+    }
+
     Aws::S3::Model::GetObjectRequest request;
     request.SetBucket(bucket_name.c_str());
     request.SetKey(object_name.c_str());
 
-    request.SetResponseStreamFactory([buf, size]() {
-    // For macOs, pubsetbuf interface not implemented
-#ifdef __linux__
-        std::unique_ptr<Aws::StringStream> stream(
-            Aws::New<Aws::StringStream>(""));
-        stream->rdbuf()->pubsetbuf(static_cast<char*>(buf), size);
-#else
-        std::unique_ptr<Aws::IOStream> stream(Aws::New<AwsResponseStream>(
-            "AwsResponseStream", static_cast<char*>(buf), size));
-#endif
-        return stream.release();
-    });
+    request.SetResponseStreamFactory(
+        BufferStreamFactory(static_cast<char*>(buf), size));
     auto start = std::chrono::system_clock::now();
     auto outcome = client_->GetObject(request);
     monitor::internal_storage_request_latency_get.Observe(
@@ -680,6 +848,81 @@ MinioChunkManager::GetObjectBuffer(const std::string& bucket_name,
     return size;
 }
 
+void
+MinioChunkManager::GetObjectRange(const std::string& bucket_name,
+                                  const std::string& object_name,
+                                  char* buf,
+                                  uint64_t offset,
+                                  uint64_t size) {
+    Aws::S3::Model::GetObjectRequest request;
+    request.SetBucket(bucket_name.c_str());
+    request.SetKey(object_name.c_str());
+    request.SetRange(fmt::format("bytes={}-{}", offset, offset + size - 1));
+    request.SetResponseStreamFactory(BufferStreamFactory(buf, size));
+
+    for (int attempt = 1;; ++attempt) {
+        auto start = std::chrono::system_clock::now();
+        auto outcome = client_->GetObject(request);
+        monitor::internal_storage_request_latency_get.Observe(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now() - start)
+                .count());
+        if (outcome.IsSuccess()) {
+            auto length = outcome.GetResult().GetContentLength();
+            AssertInfo(length == static_cast<int64_t>(size),
+                       "short read of object {}, range [{}, {}), got {} "
+                       "bytes",
+                       object_name,
+                       offset,
+                       offset + size,
+                       length);
+            return;
+        }
+        const auto& err = outcome.GetError();
+        if (attempt >= kPartMaxAttempts || IsNotFound(err.GetErrorType())) {
+            ThrowS3Error("GetObjectRange",
+                         err,
+                         "params, bucket={}, object={}, offset={}, size={}",
+                         bucket_name,
+                         object_name,
+                         offset,
+                         size);
+        }
+        LOG_WARN("retry reading object {} range [{}, {}), attempt {}: {}",
+                 object_name,
+                 offset,
+                 offset + size,
+                 attempt,
+                 ConvertFromAwsString(err.GetMessage()));
+    }
+}
+
+uint64_t
+MinioChunkManager::GetObjectBufferInParts(const std::string& bucket_name,
+                                          const std::string& object_name,
+                                          void* buf,
+                                          uint64_t size,
+                                          uint64_t part_size) {
+    auto data = static_cast<char*>(buf);
+    auto num_parts = (size + part_size - 1) / part_size;
+    try {
+        ForEachPart(num_parts, [&](uint64_t part) {
+            auto offset = part * part_size;
+            GetObjectRange(bucket_name,
+                           object_name,
+                           data + offset,
+                           offset,
+                           std::min(part_size, size - offset));
+        });
+    } catch (...) {
+        monitor::internal_storage_op_count_get_fail.Increment();
+        throw;
+    }
+    monitor::internal_storage_kv_size_get.Observe(size);
+    monitor::internal_storage_op_count_get_suc.Increment();
+    return size;
+}
+
 std::vector<std::string>
 MinioChunkManager::ListObjects(const std::string& bucket_name,
                                const std::string& prefix) {
@@ -237,6 +237,33 @@ class MinioChunkManager : public ChunkManager {
     BuildAccessKeyClient(const StorageConfig& storage_config,
                          const Aws::Client::ClientConfiguration& config);
 
+    // ranged GETs of part_size bytes issued concurrently, each written to
+    // its place in buf
+    uint64_t
+    GetObjectBufferInParts(const std::string& bucket_name,
+                           const std::string& object_name,
+                           void* buf,
+                           uint64_t size,
+                           uint64_t part_size);
+
+    // reads [offset, offset + size) of the object into buf, retried on
+    // failure
+    void
+    GetObjectRange(const std::string& bucket_name,
+                   const std::string& object_name,
+                   char* buf,
+                   uint64_t offset,
+                   uint64_t size);
+
+    // multipart upload of parts of part_size bytes issued concurrently,
+    // aborted if any part fails
+    bool
+    PutObjectBufferInParts(const std::string& bucket_name,
+                           const std::string& object_name,
+                           void* buf,
+                           uint64_t size,
+                           uint64_t part_size);
+
     Aws::SDKOptions sdk_options_;
     static std::atomic<size_t> init_count_;
     static std::mutex client_mutex_;
@@ -17,7 +17,9 @@
 #include "storage/MmapChunkManager.h"
 #include "storage/LocalChunkManagerSingleton.h"
 #include <fstream>
+#include <sstream>
 #include <sys/mman.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 #include "stdio.h"
 #include <fcntl.h>
@@ -28,15 +30,114 @@ namespace milvus::storage {
 namespace {
 static constexpr int kMmapDefaultProt = PROT_WRITE | PROT_READ;
 static constexpr int kMmapDefaultFlags = MAP_SHARED;
+static constexpr int kMmapAnonFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+static constexpr uint64_t kHugePageSize = 2 * 1024 * 1024;
+// MPOL_PREFERRED of linux/mempolicy.h
+static constexpr int kMpolPreferred = 1;
+static constexpr unsigned kMaxNumaNodes = 1024;
+
+uint64_t
+AlignUp(uint64_t size, uint64_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+// anonymous mapping of size bytes starting at a multiple of alignment, so
+// that transparent huge pages can back all of it
+char*
+MapAlignedAnon(uint64_t size, uint64_t alignment) {
+    auto reserved = size + alignment;
+    auto addr =
+        mmap(nullptr, reserved, kMmapDefaultProt, kMmapAnonFlags, -1, 0);
+    if (addr == MAP_FAILED) {
+        return nullptr;
+    }
+    auto begin = reinterpret_cast<uintptr_t>(addr);
+    auto aligned_begin = AlignUp(begin, alignment);
+    if (aligned_begin > begin) {
+        munmap(addr, aligned_begin - begin);
+    }
+    auto end = begin + reserved;
+    auto aligned_end = aligned_begin + size;
+    if (end > aligned_end) {
+        munmap(reinterpret_cast<void*>(aligned_end), end - aligned_end);
+    }
+    return reinterpret_cast<char*>(aligned_begin);
+}
+
+bool
+HasMultipleNumaNodes() {
+    static const bool multiple =
+        access("/sys/devices/system/node/node1", F_OK) == 0;
+    return multiple;
+}
+
+// best effort, the pages are placed by first touch if it fails
+void
+BindToLocalNumaNode(void* addr, uint64_t size) {
+#if defined(SYS_getcpu) && defined(SYS_mbind)
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0 ||
+        node >= kMaxNumaNodes) {
+        return;
+    }
+    constexpr unsigned kBits = 8 * sizeof(unsigned long);
+    unsigned long mask[kMaxNumaNodes / kBits] = {0};
+    mask[node / kBits] |= 1UL << (node % kBits);
+    if (syscall(SYS_mbind,
+                addr,
+                size,
+                kMpolPreferred,
+                mask,
+                kMaxNumaNodes + 1,
+                0) != 0) {
+        LOG_DEBUG("Failed to bind mmap_block to numa node {}: {}",
+                  node,
+                  strerror(errno));
+    }
+#endif
+}
+
+// logs the first failure only, it is the same for every block
+std::atomic<bool> hugetlb_failure_logged{false};
 };  // namespace
 
+HugePageMode
+HugePageModeFromString(const std::string& mode) {
+    if (mode.empty() || mode == "none") {
+        return HugePageMode::None;
+    }
+    if (mode == "transparent") {
+        return HugePageMode::Transparent;
+    }
+    if (mode == "explicit") {
+        return HugePageMode::Explicit;
+    }
+    PanicInfo(ErrorCode::ConfigInvalid,
+              "Invalid huge page mode: {}, expected: none, transparent or "
+              "explicit",
+              mode);
+}
+
+std::string
+MmapBlockOptions::ToString() const {
+    static const char* huge_page_modes[] = {"none", "transparent", "explicit"};
+    std::stringstream ss;
+    ss << "[anon=" << std::boolalpha << anon_
+       << ", huge_page=" << huge_page_modes[static_cast<int>(huge_page_)]
+       << ", numa_local=" << std::boolalpha << numa_local_ << "]";
+    return ss.str();
+}
+
 // todo(cqy): After confirming the append parallelism of multiple fields, adjust the lock granularity.
 
 MmapBlock::MmapBlock(const std::string& file_name,
                      const uint64_t file_size,
-                     BlockType type)
+                     BlockType type,
+                     const MmapBlockOptions& options)
     : file_name_(file_name),
       file_size_(file_size),
+      options_(options),
       block_type_(type),
       is_valid_(false) {
 }
@@ -48,6 +149,18 @@ MmapBlock::Init() {
         LOG_WARN("This mmap block has been init.");
         return;
     }
+    if (options_.anon_) {
+        InitAnon();
+    } else {
+        InitFile();
+    }
+    offset_.store(0);
+    is_valid_ = true;
+    allocated_size_.fetch_add(file_size_);
+}
+
+void
+MmapBlock::InitFile() {
     // create tmp file
     int fd = open(file_name_.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
     if (fd == -1) {
@@ -74,7 +187,7 @@ MmapBlock::Init() {
                   "Failed to mmap in mmap_block:{}",
                   file_name_);
     }
-    offset_.store(0);
+    map_size_ = file_size_;
     close(fd);
 
     milvus::monitor::internal_mmap_allocated_space_bytes_file.Observe(
@@ -82,8 +195,63 @@ MmapBlock::Init() {
     milvus::monitor::internal_mmap_in_used_space_bytes_file.Increment(
         file_size_);
     milvus::monitor::internal_mmap_in_used_count_file.Increment();
-    is_valid_ = true;
-    allocated_size_.fetch_add(file_size_);
+}
+
+void
+MmapBlock::InitAnon() {
+    addr_ = nullptr;
+    map_size_ = options_.huge_page_ == HugePageMode::None
+                    ? file_size_
+                    : AlignUp(file_size_, kHugePageSize);
+#ifdef MAP_HUGETLB
+    if (options_.huge_page_ == HugePageMode::Explicit) {
+        auto addr = mmap(nullptr,
+                         map_size_,
+                         kMmapDefaultProt,
+                         kMmapAnonFlags | MAP_HUGETLB,
+                         -1,
+                         0);
+        if (addr != MAP_FAILED) {
+            addr_ = static_cast<char*>(addr);
+        } else if (!hugetlb_failure_logged.exchange(true)) {
+            LOG_WARN(
+                "Failed to mmap_block from the reserved huge pages, fall "
+                "back to transparent huge pages, error: {}",
+                strerror(errno));
+        }
+    }
+#endif
+    if (addr_ == nullptr) {
+        if (options_.huge_page_ == HugePageMode::None) {
+            auto addr = mmap(
+                nullptr, map_size_, kMmapDefaultProt, kMmapAnonFlags, -1, 0);
+            addr_ = addr == MAP_FAILED ? nullptr : static_cast<char*>(addr);
+        } else {
+            addr_ = MapAlignedAnon(map_size_, kHugePageSize);
+#ifdef MADV_HUGEPAGE
+            if (addr_ != nullptr &&
+                madvise(addr_, map_size_, MADV_HUGEPAGE) != 0) {
+                LOG_DEBUG("Failed to madvise huge pages for mmap_block: {}",
+                          strerror(errno));
+            }
+#endif
+        }
+    }
+    if (addr_ == nullptr) {
+        PanicInfo(ErrorCode::MmapError,
+                  "Failed to mmap anonymous mmap_block of {} bytes, error: {}",
+                  map_size_,
+                  strerror(errno));
+    }
+    if (options_.numa_local_ && HasMultipleNumaNodes()) {
+        BindToLocalNumaNode(addr_, map_size_);
+    }
+
+    milvus::monitor::internal_mmap_allocated_space_bytes_anon.Observe(
+        file_size_);
+    milvus::monitor::internal_mmap_in_used_space_bytes_anon.Increment(
+        file_size_);
+    milvus::monitor::internal_mmap_in_used_count_anon.Increment();
 }
 
 void
@@ -94,11 +262,20 @@ MmapBlock::Close() {
         return;
     }
     if (addr_ != nullptr) {
-        if (munmap(addr_, file_size_) != 0) {
+        if (munmap(addr_, map_size_) != 0) {
             PanicInfo(ErrorCode::MemAllocateSizeNotMatch,
                       "Failed to munmap in mmap_block under file:{}",
                       file_name_);
         }
+        addr_ = nullptr;
+    }
+    allocated_size_.fetch_sub(file_size_);
+    if (options_.anon_) {
+        milvus::monitor::internal_mmap_in_used_space_bytes_anon.Decrement(
+            file_size_);
+        milvus::monitor::internal_mmap_in_used_count_anon.Decrement();
+        is_valid_ = false;
+        return;
     }
     if (access(file_name_.c_str(), F_OK) == 0) {
         if (remove(file_name_.c_str()) != 0) {
@@ -107,7 +284,6 @@ MmapBlock::Close() {
                       file_name_);
         }
     }
-    allocated_size_.fetch_sub(file_size_);
     milvus::monitor::internal_mmap_in_used_space_bytes_file.Decrement(
         file_size_);
     milvus::monitor::internal_mmap_in_used_count_file.Decrement();
@@ -154,8 +330,11 @@ MmapBlocksHandler::AllocateFixSizeBlock() {
                       max_disk_limit_,
                       mmap_file_prefix_);
         }
-        auto new_block = std::make_unique<MmapBlock>(
-            GetMmapFilePath(), GetFixFileSize(), MmapBlock::BlockType::Fixed);
+        auto new_block =
+            std::make_unique<MmapBlock>(GetMmapFilePath(),
+                                        GetFixFileSize(),
+                                        MmapBlock::BlockType::Fixed,
+                                        options_);
         new_block->Init();
         return std::move(new_block);
     }
@@ -178,7 +357,7 @@ MmapBlocksHandler::AllocateLargeBlock(const uint64_t size) {
                   mmap_file_prefix_);
     }
     auto new_block = std::make_unique<MmapBlock>(
-        GetMmapFilePath(), size, MmapBlock::BlockType::Variable);
+        GetMmapFilePath(), size, MmapBlock::BlockType::Variable, options_);
     new_block->Init();
     return std::move(new_block);
 }
@@ -313,9 +492,10 @@ MmapChunkManager::Allocate(const MmapChunkDescriptorPtr descriptor,
 
 MmapChunkManager::MmapChunkManager(std::string root_path,
                                    const uint64_t disk_limit,
-                                   const uint64_t file_size) {
-    blocks_handler_ =
-        std::make_unique<MmapBlocksHandler>(disk_limit, file_size, root_path);
+                                   const uint64_t file_size,
+                                   const MmapBlockOptions& options) {
+    blocks_handler_ = std::make_unique<MmapBlocksHandler>(
+        disk_limit, file_size, root_path, options);
     mmap_file_prefix_ = root_path;
     auto cm =
         storage::LocalChunkManagerSingleton::GetInstance().GetChunkManager();
@@ -328,9 +508,10 @@ MmapChunkManager::MmapChunkManager(std::string root_path,
     this->descriptor_counter_.store(0);
     LOG_INFO(
         "Init MappChunkManager with: Path {}, MaxDiskSize {} MB, "
-        "FixedFileSize {} MB.",
+        "FixedFileSize {} MB, BlockOptions {}.",
         root_path,
         disk_limit / (1024 * 1024),
-        file_size / (1024 * 1024));
+        file_size / (1024 * 1024),
+        options.ToString());
 }
 }  // namespace milvus::storage
\ No newline at end of file
@@ -52,6 +52,38 @@ struct MmapChunkDescriptor {
 };
 using MmapChunkDescriptorPtr = std::shared_ptr<MmapChunkDescriptor>;
 
+enum class HugePageMode {
+    // base pages only
+    None = 0,
+    // madvise(MADV_HUGEPAGE), the kernel backs the aligned parts of a block
+    // with transparent huge pages when it can
+    Transparent = 1,
+    // MAP_HUGETLB from the reserved huge page pool, falls back to
+    // Transparent if the pool is exhausted
+    Explicit = 2,
+};
+
+HugePageMode
+HugePageModeFromString(const std::string& mode);
+
+/**
+ * @brief MmapBlockOptions decides how the memory of the MmapBlocks is backed.
+ * By default every block maps a tmp file; with anon_ set, the blocks are
+ * anonymous memory instead, which can use huge pages to cut the TLB misses
+ * of scanning large vector columns, and the chunks still share the blocks.
+ */
+struct MmapBlockOptions {
+    bool anon_ = false;
+    // only for anonymous blocks
+    HugePageMode huge_page_ = HugePageMode::None;
+    // prefer the numa node of the allocating thread for the pages of a
+    // block, only on hosts with several nodes and for anonymous blocks
+    bool numa_local_ = false;
+
+    std::string
+    ToString() const;
+};
+
 /**
  * @brief MmapBlock is a basic unit of MmapChunkManager. It handle all memory mmaping in one tmp file.
  * static function(TotalBlocksSize) is used to get total files size of chunk mmap.
@@ -64,7 +96,8 @@ struct MmapBlock {
     };
     MmapBlock(const std::string& file_name,
               const uint64_t file_size,
-              BlockType type = BlockType::Fixed);
+              BlockType type = BlockType::Fixed,
+              const MmapBlockOptions& options = {});
     ~MmapBlock();
     void
     Init();
@@ -93,9 +126,19 @@ struct MmapBlock {
         return allocated_size_.load();
     }
 
+ private:
+    void
+    InitFile();
+    void
+    InitAnon();
+
  private:
     const std::string file_name_;
     const uint64_t file_size_;
+    const MmapBlockOptions options_;
+    // length of the mapping, file_size_ rounded up to huge pages for
+    // anonymous blocks with huge pages
+    uint64_t map_size_ = 0;
     char* addr_ = nullptr;
     std::atomic<uint64_t> offset_ = 0;
     const BlockType block_type_;
@@ -114,10 +157,12 @@ class MmapBlocksHandler {
  public:
     MmapBlocksHandler(const uint64_t disk_limit,
                       const uint64_t fix_file_size,
-                      const std::string file_prefix)
+                      const std::string file_prefix,
+                      const MmapBlockOptions& options = {})
         : max_disk_limit_(disk_limit),
           mmap_file_prefix_(file_prefix),
-          fix_mmap_file_size_(fix_file_size) {
+          fix_mmap_file_size_(fix_file_size),
+          options_(options) {
         mmmap_file_counter_.store(0);
         MmapBlock::ClearAllocSize();
     }
@@ -163,6 +208,7 @@ class MmapBlocksHandler {
     std::string mmap_file_prefix_;
     std::atomic<uint64_t> mmmap_file_counter_;
     uint64_t fix_mmap_file_size_;
+    MmapBlockOptions options_;
     std::queue<MmapBlockPtr> fix_size_blocks_cache_;
     const float cache_threshold = 0.25;
 };
@@ -172,13 +218,15 @@ class MmapBlocksHandler {
  * MmapChunkManager manages the memory-mapping space in mmap manager;
  * MmapChunkManager uses blocks_table_ to record the relationship of segments and the mapp space it uses.
  * The basic space unit of MmapChunkManager is MmapBlock, and is managed by MmapBlocksHandler.
+ * With anonymous blocks, disk_limit bounds the anonymous memory of the blocks instead of the tmp files.
  * todo(cqy): blocks_handler_ and blocks_table_ is not thread safe, we need use fine-grained locks for better performance.
  */
 class MmapChunkManager {
  public:
     explicit MmapChunkManager(std::string root_path,
                               const uint64_t disk_limit,
-                              const uint64_t file_size);
+                              const uint64_t file_size,
+                              const MmapBlockOptions& options = {});
     ~MmapChunkManager();
     MmapChunkDescriptorPtr
     Register();
@@ -53,10 +53,16 @@ class MmapManager {
                 init_mutex_);  // in case many threads call init
             mmap_config_ = config;
             if (mcm_ == nullptr) {
+                MmapBlockOptions options;
+                options.anon_ = mmap_config_.anon_arena_enable;
+                options.huge_page_ =
+                    HugePageModeFromString(mmap_config_.huge_page_mode);
+                options.numa_local_ = mmap_config_.numa_local;
                 mcm_ = std::make_shared<MmapChunkManager>(
                     mmap_config_.mmap_path,
                     mmap_config_.disk_limit,
-                    mmap_config_.fix_file_size);
+                    mmap_config_.fix_file_size,
+                    options);
             }
             LOG_INFO("Init MmapConfig with MmapConfig: {}",
                      mmap_config_.ToString());
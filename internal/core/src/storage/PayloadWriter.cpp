@@ -70,6 +70,15 @@ PayloadWriter::add_one_binary_payload(const uint8_t* data, int length) {
     rows_.fetch_add(1);
 }
 
+void
+PayloadWriter::add_variable_length_payload(FieldDataBase& field_data) {
+    AssertInfo(output_ == nullptr, "payload writer has been finished");
+    AssertInfo(column_type_ == field_data.get_data_type(),
+               "mismatch data type");
+    AddVariableLengthColumnToArrowBuilder(builder_, field_data);
+    rows_.fetch_add(field_data.get_num_rows());
+}
+
 void
 PayloadWriter::add_payload(const Payload& raw_data) {
     AssertInfo(output_ == nullptr, "payload writer has been finished");
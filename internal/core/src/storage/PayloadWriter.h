@@ -19,6 +19,7 @@
 #include <memory>
 #include <vector>
 
+#include "common/FieldDataInterface.h"
 #include "storage/PayloadStream.h"
 #include <parquet/arrow/writer.h>
 
@@ -38,6 +39,10 @@ class PayloadWriter {
     void
     add_one_binary_payload(const uint8_t* data, int length);
 
+    // appends every row of a string, json or array column at once
+    void
+    add_variable_length_payload(FieldDataBase& field_data);
+
     void
     finish();
 
@@ -134,6 +134,11 @@ struct MmapConfig {
     bool scalar_field_enable_mmap;
     bool vector_index_enable_mmap;
     bool vector_field_enable_mmap;
+    // anonymous memory instead of tmp files for the mmap chunk manager
+    bool anon_arena_enable = false;
+    // none, transparent or explicit, only for the anonymous arena
+    std::string huge_page_mode = "none";
+    bool numa_local = false;
     bool
     GetEnableGrowingMmap() const {
         return growing_enable_mmap;
@@ -194,7 +199,10 @@ struct MmapConfig {
            << ", vector_index_enable_mmap=" << std::boolalpha
            << vector_index_enable_mmap
            << ", vector_field_enable_mmap=" << std::boolalpha
-           << vector_field_enable_mmap << "]";
+           << vector_field_enable_mmap
+           << ", anon_arena_enable=" << std::boolalpha << anon_arena_enable
+           << ", huge_page_mode=" << huge_page_mode
+           << ", numa_local=" << std::boolalpha << numa_local << "]";
         return ss.str();
     }
 };
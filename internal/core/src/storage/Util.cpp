@@ -24,10 +24,12 @@
 #include "index/Utils.h"
 #include "log/Log.h"
 
+#include "common/Array.h"
 #include "common/Consts.h"
 #include "common/EasyAssert.h"
 #include "common/FieldData.h"
 #include "common/FieldDataInterface.h"
+#include "common/Json.h"
 #ifdef AZURE_BUILD_DIR
 #include "storage/azure/AzureChunkManager.h"
 #endif
@@ -251,6 +253,86 @@ AddOneBinaryToArrowBuilder(std::shared_ptr<arrow::ArrayBuilder> builder,
         ast.ok(), "append value to arrow builder failed: {}", ast.ToString());
 }
 
+void
+AddVariableLengthColumnToArrowBuilder(
+    std::shared_ptr<arrow::ArrayBuilder> builder, FieldDataBase& field_data) {
+    AssertInfo(builder != nullptr, "empty arrow builder");
+    auto binary_builder =
+        std::dynamic_pointer_cast<arrow::BinaryBuilder>(builder);
+    AssertInfo(binary_builder != nullptr, "mismatch arrow builder type");
+    int64_t rows = field_data.get_num_rows();
+    auto ast = binary_builder->Reserve(rows);
+    AssertInfo(ast.ok(), "reserve arrow builder failed: {}", ast.ToString());
+
+    // read the rows and the validity bitmap directly, RawValue and is_valid
+    // check bounds and take a lock on every call
+    const uint8_t* valid_data =
+        field_data.IsNullable() ? field_data.ValidData() : nullptr;
+    auto is_valid = [valid_data](int64_t i) {
+        return valid_data == nullptr ||
+               ((valid_data[i >> 3] >> (i & 0x07)) & 1);
+    };
+
+    // strings and json already hold contiguous bytes per row, so the value
+    // buffer is reserved once and filled without reallocation
+    auto append_views = [&](auto&& row_view) {
+        int64_t total_size = 0;
+        for (int64_t i = 0; i < rows; ++i) {
+            if (is_valid(i)) {
+                total_size += row_view(i).size();
+            }
+        }
+        ast = binary_builder->ReserveData(total_size);
+        AssertInfo(
+            ast.ok(), "reserve arrow builder failed: {}", ast.ToString());
+        for (int64_t i = 0; i < rows; ++i) {
+            if (is_valid(i)) {
+                binary_builder->UnsafeAppend(row_view(i));
+            } else {
+                binary_builder->UnsafeAppendNull();
+            }
+        }
+    };
+
+    switch (field_data.get_data_type()) {
+        case DataType::VARCHAR:
+        case DataType::STRING:
+        case DataType::TEXT: {
+            auto strs = static_cast<const std::string*>(field_data.Data());
+            append_views(
+                [strs](int64_t i) { return std::string_view(strs[i]); });
+            break;
+        }
+        case DataType::JSON: {
+            auto jsons = static_cast<const Json*>(field_data.Data());
+            append_views([jsons](int64_t i) { return jsons[i].data(); });
+            break;
+        }
+        case DataType::ARRAY: {
+            // arrays are serialized on the fly into one reused buffer
+            auto arrays = static_cast<const Array*>(field_data.Data());
+            std::string buffer;
+            for (int64_t i = 0; i < rows; ++i) {
+                if (!is_valid(i)) {
+                    binary_builder->UnsafeAppendNull();
+                    continue;
+                }
+                arrays[i].output_data().SerializeToString(&buffer);
+                ast = binary_builder->Append(buffer);
+                AssertInfo(ast.ok(),
+                           "append value to arrow builder failed: {}",
+                           ast.ToString());
+            }
+            break;
+        }
+        default: {
+            PanicInfo(DataTypeInvalid,
+                      "unsupported variable length data type {}",
+                      field_data.get_data_type());
+        }
+    }
+}
+
 std::shared_ptr<arrow::ArrayBuilder>
 CreateArrowBuilder(DataType data_type) {
     switch (static_cast<DataType>(data_type)) {
@@ -55,6 +55,13 @@ AddOneBinaryToArrowBuilder(std::shared_ptr<arrow::ArrayBuilder> builder,
                            const uint8_t* data,
                            int length);
 
+// Appends all rows of a string, json or array column. The builder is sized
+// once for the whole column and every row is copied straight from the field
+// data, without a temporary string per row.
+void
+AddVariableLengthColumnToArrowBuilder(
+    std::shared_ptr<arrow::ArrayBuilder> builder, FieldDataBase& field_data);
+
 std::shared_ptr<arrow::ArrayBuilder>
 CreateArrowBuilder(DataType data_type);
 
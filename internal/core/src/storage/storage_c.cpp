@@ -16,6 +16,7 @@
 
 #include "storage/storage_c.h"
 #include "storage/FileWriter.h"
+#include "storage/IoUring.h"
 #include "monitor/prometheus_client.h"
 #include "storage/RemoteChunkManagerSingleton.h"
 #include "storage/LocalChunkManagerSingleton.h"
@@ -110,6 +111,10 @@ InitMmapManager(CMmapConfig c_mmap_config) {
             c_mmap_config.vector_index_enable_mmap;
         mmap_config.vector_field_enable_mmap =
             c_mmap_config.vector_field_enable_mmap;
+        mmap_config.anon_arena_enable = c_mmap_config.anon_arena_enable;
+        mmap_config.huge_page_mode =
+            std::string(c_mmap_config.huge_page_mode);
+        mmap_config.numa_local = c_mmap_config.numa_local;
         milvus::storage::MmapManager::GetInstance().Init(mmap_config);
         return milvus::SuccessCStatus();
     } catch (std::exception& e) {
@@ -118,7 +123,10 @@ InitMmapManager(CMmapConfig c_mmap_config) {
 }
 
 CStatus
-InitFileWriterConfig(const char* mode, uint64_t buffer_size_kb, int nr_threads) {
+InitFileWriterConfig(const char* mode,
+                     uint64_t buffer_size_kb,
+                     int nr_threads,
+                     int io_uring_queue_depth) {
     try {
         std::string mode_str(mode);
         if (mode_str == "direct") {
@@ -132,6 +140,7 @@ InitFileWriterConfig(const char* mode, uint64_t buffer_size_kb, int nr_threads)
             return milvus::FailureCStatus(milvus::ConfigInvalid, "Invalid mode");
         }
         milvus::storage::FileWriteWorkerPool::GetInstance().Configure(nr_threads);
+        milvus::storage::IoUring::SetQueueDepth(io_uring_queue_depth);
         return milvus::SuccessCStatus();
     } catch (std::exception& e) {
         return milvus::FailureCStatus(&e);
@@ -40,7 +40,10 @@ void
 ResizeTheadPool(int64_t priority, float ratio);
 
 CStatus
-InitFileWriterConfig(const char* mode, uint64_t buffer_size_kb, int nr_threads);
+InitFileWriterConfig(const char* mode,
+                     uint64_t buffer_size_kb,
+                     int nr_threads,
+                     int io_uring_queue_depth);
 
 #ifdef __cplusplus
 };
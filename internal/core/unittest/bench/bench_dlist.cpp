@@ -0,0 +1,107 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cachinglayer/Utils.h"
+#include "cachinglayer/lrucache/DList.h"
+#include "cachinglayer/lrucache/ListNode.h"
+
+using namespace milvus::cachinglayer;
+using namespace milvus::cachinglayer::internal;
+
+namespace {
+constexpr int64_t kNumCells = 4096;
+constexpr int64_t kCellSize = 1024;
+
+// A cell loaded instantly, so that only the cost of the cache is measured.
+class BenchNode : public ListNode {
+ public:
+    BenchNode(DList* dlist, int64_t id)
+        : ListNode(dlist, {kCellSize, 0}), key_(std::to_string(id)) {
+    }
+
+    NodePin
+    Pin() {
+        auto [need_load, future] = pin();
+        if (need_load) {
+            mark_loaded([]() {}, true);
+        }
+        return SemiInlineGet(std::move(future));
+    }
+
+ protected:
+    std::string
+    key() const override {
+        return key_;
+    }
+
+ private:
+    std::string key_;
+};
+
+struct Cache {
+    std::unique_ptr<DList> dlist;
+    std::vector<std::unique_ptr<BenchNode>> cells;
+};
+
+// Cache shared by the threads of a benchmark, with all the cells fitting in if
+// fits, otherwise a quarter of them.
+Cache&
+GetCache(int64_t shards, bool fits) {
+    static std::mutex mtx;
+    static std::map<std::pair<int64_t, bool>, Cache> caches;
+    std::lock_guard<std::mutex> lock(mtx);
+    auto& cache = caches[{shards, fits}];
+    if (!cache.dlist) {
+        auto capacity = kNumCells * kCellSize / (fits ? 1 : 4);
+        // touch on every unpin, the worst case of contention on the list.
+        cache.dlist = std::make_unique<DList>(
+            ResourceUsage{capacity, 0},
+            ResourceUsage{capacity * 7 / 10, 0},
+            ResourceUsage{capacity * 9 / 10, 0},
+            EvictionConfig(0, 10, CacheEvictionPolicy_LRU, shards));
+        for (int64_t i = 0; i < kNumCells; ++i) {
+            cache.cells.push_back(
+                std::make_unique<BenchNode>(cache.dlist.get(), i));
+        }
+    }
+    return cache;
+}
+
+// range(0): number of shards, range(1): whether all the cells fit in the cache
+// or pins keep evicting.
+void
+BM_DListPinUnpin(benchmark::State& state) {
+    auto& cache = GetCache(state.range(0), state.range(1) != 0);
+    std::default_random_engine e(state.thread_index());
+    std::uniform_int_distribution<int64_t> dist(0, kNumCells - 1);
+    for (auto _ : state) {
+        auto pin = cache.cells[dist(e)]->Pin();
+        benchmark::DoNotOptimize(pin);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_DListPinUnpin)
+    ->ArgsProduct({{1, 8, 32}, {1, 0}})
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+
+}  // namespace
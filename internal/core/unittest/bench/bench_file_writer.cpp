@@ -0,0 +1,96 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storage/FileWriter.h"
+#include "storage/IoUring.h"
+
+using namespace milvus::storage;
+
+namespace {
+constexpr size_t kFileSize = 64 << 20;
+constexpr size_t kChunkSize = 256 << 10;
+constexpr size_t kBufferSize = 64 << 10;
+
+// backend 0: blocking writes of the caller, 1: FileWriteWorkerPool,
+// 2: io_uring
+void
+Configure(int backend, bool direct, int queue_depth) {
+    FileWriter::SetMode(direct ? FileWriter::WriteMode::DIRECT
+                               : FileWriter::WriteMode::BUFFERED);
+    FileWriter::SetBufferSize(kBufferSize);
+    FileWriteWorkerPool::GetInstance().Configure(backend == 1 ? 4 : 0);
+    IoUring::SetQueueDepth(backend == 2 ? queue_depth : 0);
+}
+
+// every thread writes its own file of kFileSize in chunks of kChunkSize,
+// as the index slices cached by a query node
+void
+BM_FileWriter(benchmark::State& state) {
+    auto backend = static_cast<int>(state.range(0));
+    auto direct = state.range(1) != 0;
+    auto num_writers = static_cast<int>(state.range(2));
+    Configure(backend, direct, 32);
+
+    std::vector<char> chunk(kChunkSize);
+    std::default_random_engine e(42);
+    for (auto& c : chunk) {
+        c = static_cast<char>(e());
+    }
+    auto dir = std::filesystem::temp_directory_path() / "bench_file_writer";
+    std::filesystem::create_directories(dir);
+
+    for (auto _ : state) {
+        std::vector<std::thread> writers;
+        for (int i = 0; i < num_writers; ++i) {
+            writers.emplace_back([&, i]() {
+                FileWriter writer((dir / std::to_string(i)).string());
+                for (size_t written = 0; written < kFileSize;
+                     written += kChunkSize) {
+                    writer.Write(chunk.data(), chunk.size());
+                }
+                benchmark::DoNotOptimize(writer.Finish());
+            });
+        }
+        for (auto& writer : writers) {
+            writer.join();
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * num_writers * kFileSize);
+
+    std::filesystem::remove_all(dir);
+    Configure(0, false, 0);
+}
+
+void
+FileWriterArgs(benchmark::internal::Benchmark* b) {
+    for (int backend : {0, 1, 2}) {
+        for (int direct : {0, 1}) {
+            for (int num_writers : {1, 8}) {
+                b->Args({backend, direct, num_writers});
+            }
+        }
+    }
+}
+}  // namespace
+
+BENCHMARK(BM_FileWriter)
+    ->ArgNames({"backend", "direct", "writers"})
+    ->Apply(FileWriterArgs)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
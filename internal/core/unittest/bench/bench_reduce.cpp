@@ -0,0 +1,138 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "segcore/SegmentGrowingImpl.h"
+#include "segcore/reduce/Reduce.h"
+#include "test_utils/DataGen.h"
+
+using namespace milvus;
+using namespace milvus::query;
+using namespace milvus::segcore;
+
+namespace {
+constexpr int64_t kNumRows = 1024 * 64;
+
+const auto reduce_schema = []() {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+    return schema;
+}();
+
+const auto reduce_plan = [] {
+    const char* raw_plan = R"(vector_anns: <
+                                field_id: 100
+                                query_info: <
+                                  topk: 10
+                                  round_decimal: -1
+                                  metric_type: "L2"
+                                  search_params: "{\"nprobe\": 10}"
+                                >
+                                placeholder_tag: "$0"
+        >)";
+    auto plan_str = translate_text_plan_to_binary_plan(raw_plan);
+    return CreateSearchPlanByExpr(
+        reduce_schema, plan_str.data(), plan_str.size());
+}();
+
+const auto reduce_segment = [] {
+    auto segment = CreateGrowingSegment(reduce_schema, empty_index_meta);
+    auto dataset = DataGen(reduce_schema, kNumRows);
+    segment->PreInsert(kNumRows);
+    segment->Insert(0,
+                    kNumRows,
+                    dataset.row_ids_.data(),
+                    dataset.timestamps_.data(),
+                    dataset.raw_);
+    return segment;
+}();
+
+// per segment results sorted by distance for every nq, with pks drawn from
+// the same segment so that segments overlap and dedup has work to do
+std::vector<std::unique_ptr<SearchResult>>
+GenSearchResults(int64_t num_segments, int64_t nq, int64_t topk) {
+    std::default_random_engine e(42);
+    std::uniform_int_distribution<int64_t> offset_dist(0, kNumRows - 1);
+    std::uniform_real_distribution<float> distance_dist(0, 1);
+    std::vector<std::unique_ptr<SearchResult>> results;
+    for (int64_t i = 0; i < num_segments; ++i) {
+        auto result = std::make_unique<SearchResult>();
+        result->segment_ = reduce_segment.get();
+        result->total_nq_ = nq;
+        result->unity_topK_ = topk;
+        result->total_data_cnt_ = kNumRows;
+        result->seg_offsets_.resize(nq * topk);
+        result->distances_.resize(nq * topk);
+        for (int64_t q = 0; q < nq; ++q) {
+            auto begin = q * topk;
+            for (int64_t k = 0; k < topk; ++k) {
+                result->seg_offsets_[begin + k] = offset_dist(e);
+                result->distances_[begin + k] = distance_dist(e);
+            }
+            std::sort(result->distances_.begin() + begin,
+                      result->distances_.begin() + begin + topk,
+                      std::greater<float>());
+        }
+        results.emplace_back(std::move(result));
+    }
+    return results;
+}
+}  // namespace
+
+static void
+Reduce_LargeNqTopK(benchmark::State& state) {
+    auto nq = state.range(0);
+    auto topk = state.range(1);
+    auto num_segments = state.range(2);
+    std::vector<int64_t> slice_nqs{nq};
+    std::vector<int64_t> slice_topks{topk};
+    tracer::TraceContext trace_ctx{};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto results = GenSearchResults(num_segments, nq, topk);
+        std::vector<SearchResult*> result_ptrs;
+        for (auto& result : results) {
+            result_ptrs.push_back(result.get());
+        }
+        state.ResumeTiming();
+
+        ReduceHelper reduce_helper(result_ptrs,
+                                   reduce_plan.get(),
+                                   slice_nqs.data(),
+                                   slice_topks.data(),
+                                   1,
+                                   &trace_ctx);
+        reduce_helper.Reduce();
+        reduce_helper.Marshal();
+        auto blobs = static_cast<SearchResultDataBlobs*>(
+            reduce_helper.GetSearchResultDataBlobs());
+        benchmark::DoNotOptimize(blobs->blobs.size());
+        delete blobs;
+    }
+    state.SetItemsProcessed(state.iterations() * nq * topk * num_segments);
+}
+
+BENCHMARK(Reduce_LargeNqTopK)
+    ->Unit(benchmark::kMillisecond)
+    ->Args({10, 100, 32})
+    ->Args({1000, 100, 32})
+    ->Args({1000, 1024, 16})
+    ->Args({100, 16384, 4})
+    ->Args({10, 16384, 32});
@@ -12,7 +12,10 @@
 #include <cstdint>
 #include <benchmark/benchmark.h>
 #include <string>
+#include "common/Common.h"
 #include "common/type_c.h"
+#include "mmap/ChunkedColumn.h"
+#include "query/SearchOnSealed.h"
 #include "segcore/segment_c.h"
 #include "segcore/SegmentGrowing.h"
 #include "segcore/SegmentSealed.h"
@@ -144,3 +147,68 @@ Search_Sealed(benchmark::State& state) {
 }
 
 BENCHMARK(Search_Sealed)->MinTime(5)->Arg(1)->Arg(0);
+
+static void
+Search_SealedChunkParallel(benchmark::State& state) {
+    static int64_t N = 1024 * 64;
+    static const auto dataset_ = [] {
+        auto dataset_ = DataGen(schema, N);
+        return dataset_;
+    }();
+    static const auto raw_vec = dataset_.get_col<float>(milvus::FieldId(100));
+
+    auto num_chunks = state.range(0);
+    auto parallelism = state.range(1);
+    auto fakevec_id = schema->get_field_id(FieldName("fakevec"));
+    auto& field_meta = (*schema)[fakevec_id];
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::vector<int64_t> num_rows_per_chunk;
+    for (int64_t i = 0; i < num_chunks; i++) {
+        auto begin = N * i / num_chunks;
+        auto rows = N * (i + 1) / num_chunks - begin;
+        num_rows_per_chunk.push_back(rows);
+        // chunks only reference the data, raw_vec outlives them
+        auto buf = reinterpret_cast<char*>(
+            const_cast<float*>(raw_vec.data() + begin * dim));
+        chunks.emplace_back(std::make_unique<FixedWidthChunk>(
+            rows, dim, buf, rows * dim * sizeof(float), sizeof(float), false));
+    }
+    auto translator = std::make_unique<TestChunkTranslator>(
+        num_rows_per_chunk, "", std::move(chunks));
+    auto column =
+        std::make_shared<ChunkedColumn>(std::move(translator), field_meta);
+
+    SearchInfo search_info;
+    search_info.field_id_ = fakevec_id;
+    search_info.metric_type_ = knowhere::metric::L2;
+    search_info.search_params_ = knowhere::Json{
+        {knowhere::meta::METRIC_TYPE, knowhere::metric::L2}};
+    search_info.topk_ = 5;
+    search_info.round_decimal_ = -1;
+
+    auto num_queries = 10;
+    auto query_ds = DataGen(schema, num_queries);
+    auto query_data = query_ds.get_col<float>(fakevec_id);
+    auto index_info = std::map<std::string, std::string>{};
+    BitsetView bv;
+
+    SetDefaultBruteForceChunkParallelism(parallelism);
+    for (auto _ : state) {
+        SearchResult result;
+        SearchOnSealedColumn(*schema,
+                             column.get(),
+                             search_info,
+                             index_info,
+                             query_data.data(),
+                             num_queries,
+                             N,
+                             bv,
+                             result);
+    }
+    SetDefaultBruteForceChunkParallelism(DEFAULT_BRUTE_FORCE_CHUNK_PARALLELISM);
+}
+
+BENCHMARK(Search_SealedChunkParallel)
+    ->MinTime(5)
+    ->ArgsProduct({{1, 4, 16, 64}, {1, 2, 4, 8}});
@@ -0,0 +1,121 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "exec/expression/Element.h"
+#include "exec/expression/TermSet.h"
+
+using namespace milvus::exec;
+
+namespace {
+constexpr int64_t kNumRows = 1024 * 64;
+
+// IN list of n values and rows drawn from [0, max), about 1 in 8 rows match
+// when max is 8 * n
+std::pair<std::vector<int64_t>, std::vector<int64_t>>
+GenInts(int64_t n, int64_t max) {
+    std::default_random_engine e(42);
+    std::uniform_int_distribution<int64_t> dist(0, max - 1);
+    std::vector<int64_t> values(n);
+    for (auto& v : values) {
+        v = dist(e);
+    }
+    std::vector<int64_t> rows(kNumRows);
+    for (auto& v : rows) {
+        v = dist(e);
+    }
+    return {values, rows};
+}
+
+std::pair<std::vector<std::string>, std::vector<std::string>>
+GenStrings(int64_t n) {
+    auto [values, rows] = GenInts(n, n * 8);
+    std::vector<std::string> str_values;
+    std::vector<std::string> str_rows;
+    for (auto v : values) {
+        str_values.push_back("user_id_" + std::to_string(v));
+    }
+    for (auto v : rows) {
+        str_rows.push_back("user_id_" + std::to_string(v));
+    }
+    return {str_values, str_rows};
+}
+
+// kind 0: SortVectorElement, 1: SetElement, 2: TermSet
+template <typename T>
+void
+RunTerm(benchmark::State& state,
+        const std::vector<T>& values,
+        const std::vector<T>& rows) {
+    auto kind = state.range(1);
+    SortVectorElement<T> sorted(values);
+    SetElement<T> tree(values);
+    TermSet<T> term_set(values);
+    for (auto _ : state) {
+        int64_t hits = 0;
+        for (const auto& row : rows) {
+            switch (kind) {
+                case 0:
+                    hits += sorted.In(row);
+                    break;
+                case 1:
+                    hits += tree.In(row);
+                    break;
+                default:
+                    hits += term_set.Contains(row);
+            }
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * rows.size());
+}
+}  // namespace
+
+// values spread over the whole int64 range, hashed by TermSet
+static void
+Term_Int64Wide(benchmark::State& state) {
+    auto [values, rows] = GenInts(state.range(0), INT64_MAX);
+    for (auto i = 0; i < kNumRows / 8; ++i) {
+        rows[i * 8] = values[i % values.size()];
+    }
+    RunTerm<int64_t>(state, values, rows);
+}
+
+// values within a narrow id range, a bitmap in TermSet
+static void
+Term_Int64Narrow(benchmark::State& state) {
+    auto [values, rows] = GenInts(state.range(0), state.range(0) * 8);
+    RunTerm<int64_t>(state, values, rows);
+}
+
+static void
+Term_String(benchmark::State& state) {
+    auto [values, rows] = GenStrings(state.range(0));
+    RunTerm<std::string>(state, values, rows);
+}
+
+static void
+TermArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t n : {4, 16, 64, 1024, 16384}) {
+        for (int64_t kind : {0, 1, 2}) {
+            b->Args({n, kind});
+        }
+    }
+}
+
+BENCHMARK(Term_Int64Wide)->Apply(TermArgs);
+BENCHMARK(Term_Int64Narrow)->Apply(TermArgs);
+BENCHMARK(Term_String)->Apply(TermArgs);
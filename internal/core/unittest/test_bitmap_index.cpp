@@ -423,6 +423,47 @@ class BitmapIndexTest : public testing::Test {
         }
     }
 
+    void
+    TestWindowFunc() {
+        auto index_ptr = dynamic_cast<index::BitmapIndex<T>*>(index_.get());
+        ASSERT_TRUE(index_ptr->SupportWindowQuery());
+        boost::container::vector<T> test_data(data_.begin(),
+                                              data_.begin() + 10);
+        auto lower = std::min(data_[0], data_[1]);
+        auto upper = std::max(data_[0], data_[1]);
+        auto in_res = index_ptr->In(test_data.size(), test_data.data());
+        auto not_in_res = index_ptr->NotIn(test_data.size(), test_data.data());
+        auto range_res = index_ptr->Range(data_[0], OpType::LessEqual);
+        auto binary_res = index_ptr->Range(lower, true, upper, false);
+        auto valid_res = index_ptr->IsNotNull();
+
+        int64_t total = index_ptr->Count();
+        for (int64_t offset = 0; offset < total; offset += 3001) {
+            int64_t len = std::min<int64_t>(2048, total - offset);
+            TargetBitmap window(len);
+            auto check = [&](const TargetBitmap& expected) {
+                for (int64_t i = 0; i < len; ++i) {
+                    ASSERT_EQ(bool(window[i]), bool(expected[offset + i]))
+                        << "offset: " << offset << ", @" << i;
+                }
+            };
+            index_ptr->InWindow(
+                test_data.size(), test_data.data(), offset, window.view());
+            check(in_res);
+            index_ptr->NotInWindow(
+                test_data.size(), test_data.data(), offset, window.view());
+            check(not_in_res);
+            index_ptr->RangeWindow(
+                data_[0], OpType::LessEqual, offset, window.view());
+            check(range_res);
+            index_ptr->RangeWindow(
+                lower, true, upper, false, offset, window.view());
+            check(binary_res);
+            index_ptr->IsNotNullWindow(offset, window.view());
+            check(valid_res);
+        }
+    }
+
     void
     TestRangeCompareFunc() {
         if constexpr (!std::is_same_v<T, std::string>) {
@@ -551,6 +592,10 @@ TYPED_TEST_P(BitmapIndexTest, IsNotNullFuncTest) {
     this->TestIsNotNullFunc();
 }
 
+TYPED_TEST_P(BitmapIndexTest, WindowFuncTest) {
+    this->TestWindowFunc();
+}
+
 using BitmapType =
     testing::Types<int8_t, int16_t, int32_t, int64_t, std::string>;
 
@@ -560,7 +605,8 @@ REGISTER_TYPED_TEST_SUITE_P(BitmapIndexTest,
                             NotINFuncTest,
                             CompareValFuncTest,
                             IsNullFuncTest,
-                            IsNotNullFuncTest);
+                            IsNotNullFuncTest,
+                            WindowFuncTest);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(BitmapE2ECheck, BitmapIndexTest, BitmapType);
 
@@ -611,6 +657,10 @@ TYPED_TEST_P(BitmapIndexTestV2, IsNotNullFuncTest) {
     this->TestIsNotNullFunc();
 }
 
+TYPED_TEST_P(BitmapIndexTestV2, WindowFuncTest) {
+    this->TestWindowFunc();
+}
+
 using BitmapType =
     testing::Types<int8_t, int16_t, int32_t, int64_t, std::string>;
 
@@ -621,7 +671,8 @@ REGISTER_TYPED_TEST_SUITE_P(BitmapIndexTestV2,
                             CompareValFuncTest,
                             TestRangeCompareFuncTest,
                             IsNullFuncTest,
-                            IsNotNullFuncTest);
+                            IsNotNullFuncTest,
+                            WindowFuncTest);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(BitmapIndexE2ECheck_HighCardinality,
                                BitmapIndexTestV2,
@@ -675,6 +726,10 @@ TYPED_TEST_P(BitmapIndexTestV3, IsNotNullFuncTest) {
     this->TestIsNotNullFunc();
 }
 
+TYPED_TEST_P(BitmapIndexTestV3, WindowFuncTest) {
+    this->TestWindowFunc();
+}
+
 using BitmapType =
     testing::Types<int8_t, int16_t, int32_t, int64_t, std::string>;
 
@@ -685,7 +740,8 @@ REGISTER_TYPED_TEST_SUITE_P(BitmapIndexTestV3,
                             CompareValFuncTest,
                             TestRangeCompareFuncTest,
                             IsNullFuncTest,
-                            IsNotNullFuncTest);
+                            IsNotNullFuncTest,
+                            WindowFuncTest);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(BitmapIndexE2ECheck_Mmap,
                                BitmapIndexTestV3,
@@ -739,6 +795,10 @@ TYPED_TEST_P(BitmapIndexTestV4, IsNotNullFuncTest) {
     this->TestIsNotNullFunc();
 }
 
+TYPED_TEST_P(BitmapIndexTestV4, WindowFuncTest) {
+    this->TestWindowFunc();
+}
+
 using BitmapType =
     testing::Types<int8_t, int16_t, int32_t, int64_t, std::string>;
 
@@ -749,7 +809,8 @@ REGISTER_TYPED_TEST_SUITE_P(BitmapIndexTestV4,
                             CompareValFuncTest,
                             TestRangeCompareFuncTest,
                             IsNullFuncTest,
-                            IsNotNullFuncTest);
+                            IsNotNullFuncTest,
+                            WindowFuncTest);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(BitmapIndexE2ECheck_Mmap,
                                BitmapIndexTestV4,
@@ -196,7 +196,11 @@ using Ttypes2 = ::testing::Types<
     std::tuple<int64_t, int64_t, uint64_t, uint8_t>,
     std::tuple<float, float, uint64_t, uint8_t>,
     std::tuple<double, double, uint64_t, uint8_t>,
-    std::tuple<std::string, std::string, uint64_t, uint8_t>
+    std::tuple<std::string, std::string, uint64_t, uint8_t>,
+    std::tuple<int32_t, int64_t, uint64_t, uint8_t>,
+    std::tuple<int64_t, int32_t, uint64_t, uint8_t>,
+    std::tuple<float, double, uint64_t, uint8_t>,
+    std::tuple<double, float, uint64_t, uint8_t>
 
 #if FULL_TESTS == 1
     ,
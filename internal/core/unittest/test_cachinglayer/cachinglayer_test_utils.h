@@ -250,27 +250,41 @@ class DListTestFriend {
     }
     static ResourceUsage
     get_max_memory(const DList& dlist) {
-        std::lock_guard lock(dlist.list_mtx_);
-        return dlist.max_memory_;
+        return dlist.max_memory_.load();
+    }
+    static size_t
+    num_shards(const DList& dlist) {
+        return dlist.shards_.size();
+    }
+    // the list of a DList of a single shard with the LRU eviction policy.
+    static const NodeList&
+    lru_list(const DList& dlist) {
+        return dynamic_cast<const LRUPolicy&>(*dlist.shards_[0]->policy_)
+            .list();
+    }
+    static const TwoQueuePolicy&
+    two_queue_policy(const DList& dlist) {
+        return dynamic_cast<const TwoQueuePolicy&>(
+            *dlist.shards_[0]->policy_);
     }
     static ListNode*
     get_head(const DList& dlist) {
-        std::lock_guard lock(dlist.list_mtx_);
-        return dlist.head_;
+        std::lock_guard lock(dlist.shards_[0]->mtx_);
+        return lru_list(dlist).head_;
     }
     static ListNode*
     get_tail(const DList& dlist) {
-        std::lock_guard lock(dlist.list_mtx_);
-        return dlist.tail_;
+        std::lock_guard lock(dlist.shards_[0]->mtx_);
+        return lru_list(dlist).tail_;
     }
     static void
     test_push_head(DList* dlist, ListNode* node) {
-        std::lock_guard lock(dlist->list_mtx_);
+        std::lock_guard lock(dlist->shardOf(node).mtx_);
         dlist->pushHead(node);
     }
     static void
     test_pop_item(DList* dlist, ListNode* node) {
-        std::lock_guard lock(dlist->list_mtx_);
+        std::lock_guard lock(dlist->shardOf(node).mtx_);
         dlist->popItem(node);
     }
     static void
@@ -282,9 +296,30 @@ class DListTestFriend {
     // nodes are from tail to head
     static void
     verify_list(DList* dlist, std::vector<ListNode*> nodes) {
-        std::lock_guard lock(dlist->list_mtx_);
-        EXPECT_EQ(nodes.front(), dlist->tail_);
-        EXPECT_EQ(nodes.back(), dlist->head_);
+        std::lock_guard lock(dlist->shards_[0]->mtx_);
+        verify_node_list(lru_list(*dlist), nodes);
+    }
+
+    // nodes are from tail to head
+    static void
+    verify_two_queue(DList* dlist,
+                     std::vector<ListNode*> probation,
+                     std::vector<ListNode*> protected_nodes) {
+        std::lock_guard lock(dlist->shards_[0]->mtx_);
+        auto& policy = two_queue_policy(*dlist);
+        verify_node_list(policy.probation(), probation);
+        verify_node_list(policy.protected_list(), protected_nodes);
+    }
+
+    // nodes are from tail to head
+    static void
+    verify_node_list(const NodeList& list, std::vector<ListNode*> nodes) {
+        if (nodes.empty()) {
+            EXPECT_TRUE(list.IsEmpty());
+            return;
+        }
+        EXPECT_EQ(nodes.front(), list.tail_);
+        EXPECT_EQ(nodes.back(), list.head_);
         for (size_t i = 0; i < nodes.size(); ++i) {
             auto current = nodes[i];
             auto expected_prev = i == 0 ? nullptr : nodes[i - 1];
@@ -299,20 +334,29 @@ class DListTestFriend {
         std::lock_guard lock(dlist->list_mtx_);
 
         ResourceUsage total_size;
-        EXPECT_EQ(dlist->tail_->prev_, nullptr);
-        ListNode* current = dlist->tail_;
-        ListNode* prev = nullptr;
-
-        while (current != nullptr) {
-            EXPECT_EQ(current->prev_, prev);
-            total_size += current->size();
-            prev = current;
-            current = current->next_;
+        for (auto& shard : dlist->shards_) {
+            std::lock_guard shard_lock(shard->mtx_);
+            auto& list =
+                dynamic_cast<const LRUPolicy&>(*shard->policy_).list();
+            if (list.IsEmpty()) {
+                continue;
+            }
+            EXPECT_EQ(list.tail_->prev_, nullptr);
+            ListNode* current = list.tail_;
+            ListNode* prev = nullptr;
+
+            while (current != nullptr) {
+                EXPECT_EQ(current->prev_, prev);
+                EXPECT_EQ(&dlist->shardOf(current), shard.get());
+                total_size += current->size();
+                prev = current;
+                current = current->next_;
+            }
+
+            EXPECT_EQ(prev, list.head_);
+            EXPECT_EQ(list.head_->next_, nullptr);
         }
 
-        EXPECT_EQ(prev, dlist->head_);
-        EXPECT_EQ(dlist->head_->next_, nullptr);
-
         EXPECT_EQ(total_size, dlist->used_memory_.load());
     }
 };
@@ -510,6 +510,48 @@ TEST_F(CacheSlotTest, TranslatorReturnsExtraCells) {
     EXPECT_EQ(extra_cell->cid, extra_cid);
 }
 
+TEST_F(CacheSlotTest, ReadAheadPinsCellsAheadOfScanner) {
+    // one uid per cell, in scan order.
+    std::vector<cl_uid_t> sequence = {10, 20, 30, 40, 50};
+    translator_->ResetCounters();
+
+    // inline executor: background pins complete before the calls return.
+    auto read_ahead = cache_slot_->ReadAhead(
+        sequence,
+        2,
+        folly::getKeepAliveToken(folly::InlineExecutor::instance()));
+    ASSERT_NE(read_ahead, nullptr);
+    // the scanner pins position 0 itself, read ahead covers positions 1 and 2.
+    EXPECT_EQ(read_ahead->inflight_count(), 2);
+    ASSERT_EQ(translator_->GetCellsCallCount(), 2);
+    EXPECT_EQ(translator_->GetRequestedCids()[0], std::vector<cid_t>{1});
+    EXPECT_EQ(translator_->GetRequestedCids()[1], std::vector<cid_t>{2});
+
+    // the scanner's own pin of a read ahead cell is a cache hit.
+    translator_->ResetCounters();
+    read_ahead->Advance(1);
+    auto accessor = SemiInlineGet(cache_slot_->PinCells({20}));
+    EXPECT_EQ(accessor->get_cell_of(20)->cid, 1);
+    EXPECT_EQ(read_ahead->inflight_count(), 2);
+    ASSERT_EQ(translator_->GetCellsCallCount(), 1);
+    EXPECT_EQ(translator_->GetRequestedCids()[0], std::vector<cid_t>{3});
+
+    // moving backward is a no-op, jumping forward releases the passed positions.
+    translator_->ResetCounters();
+    read_ahead->Advance(0);
+    EXPECT_EQ(translator_->GetCellsCallCount(), 0);
+    read_ahead->Advance(4);
+    EXPECT_EQ(read_ahead->inflight_count(), 0);
+    ASSERT_EQ(translator_->GetCellsCallCount(), 0);
+
+    // cell 4 was never read ahead, all read ahead pins are released.
+    accessor.reset();
+    read_ahead.reset();
+    EXPECT_TRUE(cache_slot_->ManualEvict(1));
+    EXPECT_TRUE(cache_slot_->ManualEvict(2));
+    EXPECT_TRUE(cache_slot_->ManualEvict(3));
+}
+
 TEST_F(CacheSlotTest, EvictionTest) {
     // Sizes: 0:50, 1:150, 2:100, 3:200
     ResourceUsage new_limit = ResourceUsage(300, 0);
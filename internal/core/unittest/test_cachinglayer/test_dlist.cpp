@@ -1,9 +1,11 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <atomic>
 #include <thread>
 #include <vector>
 #include <memory>
+#include <string>
 
 #include "cachinglayer/lrucache/DList.h"
 #include "cachinglayer/Utils.h"
@@ -703,3 +705,261 @@ TEST_F(DListTest, ReserveMemoryUsesLowWatermark) {
     EXPECT_EQ(get_used_memory(), usage2 + reserve_size);
     DLF::verify_list(dlist.get(), {node2});
 }
+
+TEST_F(DListTest, TwoQueueEvictsScannedBeforeHot) {
+    dlist = std::make_unique<DList>(
+        initial_limit,
+        low_watermark,
+        high_watermark,
+        EvictionConfig(10, 10, CacheEvictionPolicy_TwoQueue));
+
+    // touched again after being loaded, the hot node is protected.
+    MockListNode* hot = add_and_load_node({20, 10}, "hot");
+    DLF::verify_two_queue(dlist.get(), {hot}, {});
+    {
+        std::unique_lock node_lock(hot->test_get_mutex());
+        dlist->touchItem(hot);
+    }
+    DLF::verify_two_queue(dlist.get(), {}, {hot});
+
+    // nodes loaded by a scan are used once and stay in probation.
+    MockListNode* scan1 = add_and_load_node({30, 10}, "scan1");
+    MockListNode* scan2 = add_and_load_node({30, 10}, "scan2");
+    DLF::verify_two_queue(dlist.get(), {scan1, scan2}, {hot});
+
+    // LRU would evict the hot node, the least recently used one.
+    EXPECT_CALL(*hot, clear_data()).Times(0);
+    EXPECT_CALL(*scan1, clear_data()).Times(1);
+    EXPECT_CALL(*scan2, clear_data()).Times(0);
+
+    // Current usage 80/30, reserve 30/0. Evicting scan1 (30/10) gets below
+    // the low watermark 80/40.
+    ResourceUsage reserve_size{30, 0};
+    EXPECT_TRUE(dlist->reserveMemory(reserve_size));
+
+    EXPECT_EQ(get_used_memory(), hot->size() + scan2->size() + reserve_size);
+    DLF::verify_two_queue(dlist.get(), {scan2}, {hot});
+}
+
+TEST_F(DListTest, TwoQueueDemotesBeyondProtectedRatio) {
+    dlist = std::make_unique<DList>(
+        initial_limit,
+        low_watermark,
+        high_watermark,
+        EvictionConfig(10, 10, CacheEvictionPolicy_TwoQueue));
+
+    MockListNode* node1 = add_and_load_node({10, 0}, "key1");
+    MockListNode* node2 = add_and_load_node({10, 0}, "key2");
+    DLF::verify_two_queue(dlist.get(), {node1, node2}, {});
+
+    {
+        std::unique_lock node_lock(node1->test_get_mutex());
+        dlist->touchItem(node1);
+    }
+    DLF::verify_two_queue(dlist.get(), {node2}, {node1});
+
+    // all the memory would be protected, node1 is demoted to probation.
+    {
+        std::unique_lock node_lock(node2->test_get_mutex());
+        dlist->touchItem(node2);
+    }
+    DLF::verify_two_queue(dlist.get(), {node1}, {node2});
+
+    // removed nodes leave either queue.
+    {
+        std::unique_lock node_lock(node2->test_get_mutex());
+        dlist->removeItem(node2, node2->size());
+    }
+    DLF::verify_two_queue(dlist.get(), {node1}, {});
+    EXPECT_EQ(get_used_memory(), node1->size());
+}
+
+TEST_F(DListTest, ShardedReserveMemoryEvictsAcrossShards) {
+    dlist = std::make_unique<DList>(
+        initial_limit,
+        low_watermark,
+        high_watermark,
+        EvictionConfig(10, 10, CacheEvictionPolicy_LRU, 4));
+    EXPECT_EQ(DLF::num_shards(*dlist), 4);
+
+    std::vector<MockListNode*> nodes;
+    for (int i = 0; i < 8; ++i) {
+        nodes.push_back(add_and_load_node({10, 0}, "key", i));
+        EXPECT_CALL(*nodes.back(), clear_data()).Times(::testing::AtMost(1));
+    }
+    DLF::verify_integrity(dlist.get());
+
+    // Current usage 80/0, reserve 40/0. Evicting 4 nodes gets to the low
+    // watermark 80/40, wherever their shards are.
+    ResourceUsage reserve_size{40, 0};
+    EXPECT_TRUE(dlist->reserveMemory(reserve_size));
+    EXPECT_EQ(get_used_memory(), ResourceUsage(80, 0));
+
+    int evicted = 0;
+    for (auto* node : nodes) {
+        if (node->test_get_state() == ListNode::State::NOT_LOADED) {
+            evicted++;
+        }
+    }
+    EXPECT_EQ(evicted, 4);
+
+    dlist->releaseMemory(reserve_size);
+    DLF::verify_integrity(dlist.get());
+}
+
+namespace {
+// A cell loaded instantly, pinned by many threads while being evicted.
+class StressNode : public ListNode {
+ public:
+    StressNode(DList* dlist, ResourceUsage size, int id)
+        : ListNode(dlist, size), key_(std::to_string(id)) {
+    }
+
+    // Pins the cell, loads it first if needed.
+    NodePin
+    Pin() {
+        auto [need_load, future] = pin();
+        if (need_load) {
+            mark_loaded([this]() { loaded_ = true; }, true);
+        }
+        return SemiInlineGet(std::move(future));
+    }
+
+    bool
+    loaded() const {
+        return loaded_;
+    }
+
+ protected:
+    std::string
+    key() const override {
+        return key_;
+    }
+
+    void
+    unload() override {
+        loaded_ = false;
+    }
+
+ private:
+    std::string key_;
+    std::atomic<bool> loaded_{false};
+};
+}  // namespace
+
+TEST_F(DListTest, ShardedConcurrentPinAndEvict) {
+    constexpr int kNodes = 64;
+    constexpr int kThreads = 8;
+    constexpr int kPins = 2000;
+    // the cells do not fit, pinning them keeps evicting.
+    ResourceUsage limit{200, 100};
+    dlist = std::make_unique<DList>(
+        limit,
+        ResourceUsage{100, 50},
+        ResourceUsage{150, 75},
+        EvictionConfig(10, 1, CacheEvictionPolicy_LRU, 4));
+
+    std::vector<std::unique_ptr<StressNode>> nodes;
+    for (int i = 0; i < kNodes; ++i) {
+        nodes.push_back(
+            std::make_unique<StressNode>(dlist.get(), ResourceUsage{10, 0}, i));
+    }
+
+    std::atomic<int> unloaded_pins{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            uint32_t seed = t + 1;
+            for (int i = 0; i < kPins; ++i) {
+                seed = seed * 1103515245 + 12345;
+                // a few hot cells are pinned by all the threads at once.
+                auto id = (seed >> 16) % (i % 2 == 0 ? 4 : kNodes);
+                auto pin = nodes[id]->Pin();
+                if (!nodes[id]->loaded()) {
+                    unloaded_pins++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // a pinned cell is never evicted.
+    EXPECT_EQ(unloaded_pins.load(), 0);
+    EXPECT_TRUE(limit.CanHold(get_used_memory()));
+    DLF::verify_integrity(dlist.get());
+
+    nodes.clear();
+    EXPECT_TRUE(dlist->IsEmpty());
+    EXPECT_EQ(get_used_memory(), ResourceUsage(0, 0));
+}
+
+TEST_F(DListTest, ConcurrentReserveNeverExceedsLimit) {
+    constexpr int kNodes = 32;
+    constexpr int kPinThreads = 4;
+    constexpr int kReserveThreads = 4;
+    constexpr int kIterations = 2000;
+    // the pinned cells and the reservations in flight always fit, but only
+    // with the unpinned cells evicted, so that the fast path, the locked path
+    // and the eviction race on the usage.
+    ResourceUsage limit{150, 0};
+    dlist = std::make_unique<DList>(
+        limit,
+        ResourceUsage{90, 0},
+        ResourceUsage{130, 0},
+        EvictionConfig(10, 1, CacheEvictionPolicy_LRU, 4));
+
+    std::vector<std::unique_ptr<StressNode>> nodes;
+    for (int i = 0; i < kNodes; ++i) {
+        nodes.push_back(
+            std::make_unique<StressNode>(dlist.get(), ResourceUsage{10, 0}, i));
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> over_limit{0};
+    std::thread monitor([&]() {
+        while (!stop.load()) {
+            if (!limit.CanHold(get_used_memory())) {
+                over_limit++;
+            }
+        }
+    });
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kPinThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            uint32_t seed = t + 1;
+            for (int i = 0; i < kIterations; ++i) {
+                seed = seed * 1103515245 + 12345;
+                auto pin = nodes[(seed >> 16) % kNodes]->Pin();
+            }
+        });
+    }
+    for (int t = 0; t < kReserveThreads; ++t) {
+        threads.emplace_back([&]() {
+            ResourceUsage size{10, 0};
+            for (int i = 0; i < kIterations; ++i) {
+                if (!dlist->reserveMemory(size)) {
+                    continue;
+                }
+                if (!limit.CanHold(get_used_memory())) {
+                    over_limit++;
+                }
+                dlist->releaseMemory(size);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    stop = true;
+    monitor.join();
+
+    EXPECT_EQ(over_limit.load(), 0);
+    EXPECT_TRUE(limit.CanHold(get_used_memory()));
+    DLF::verify_integrity(dlist.get());
+
+    nodes.clear();
+    EXPECT_TRUE(dlist->IsEmpty());
+    EXPECT_EQ(get_used_memory(), ResourceUsage(0, 0));
+}
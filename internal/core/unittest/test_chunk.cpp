@@ -16,12 +16,14 @@
 #include <parquet/arrow/reader.h>
 #include <unistd.h>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <string>
 
 #include "boost/filesystem/operations.hpp"
 #include "boost/filesystem/path.hpp"
 #include "common/Chunk.h"
+#include "common/ArrowDataWrapper.h"
 #include "common/ChunkWriter.h"
 #include "common/EasyAssert.h"
 #include "common/FieldDataInterface.h"
@@ -76,6 +78,52 @@ TEST(chunk, test_int64_field) {
     }
 }
 
+TEST(chunk, test_fixed_width_field_from_batches) {
+    auto dim = 4;
+    auto row_num = 1000;
+    std::vector<float> data(row_num * dim);
+    std::iota(data.begin(), data.end(), 0);
+    auto field_data = milvus::storage::CreateFieldData(
+        storage::DataType::VECTOR_FLOAT, false, dim);
+    field_data->FillFieldData(data.data(), row_num);
+    storage::InsertEventData event_data;
+    event_data.payload_reader =
+        std::make_shared<milvus::storage::PayloadReader>(field_data);
+    auto ser_data = event_data.Serialize();
+    auto buffer = std::make_shared<arrow::io::BufferReader>(
+        ser_data.data() + 2 * sizeof(milvus::Timestamp),
+        ser_data.size() - 2 * sizeof(milvus::Timestamp));
+
+    // small batches, so the chunk is written from several of them
+    auto arrow_reader_props = parquet::ArrowReaderProperties();
+    arrow_reader_props.set_batch_size(128);
+    parquet::arrow::FileReaderBuilder reader_builder;
+    auto s = reader_builder.Open(buffer);
+    EXPECT_TRUE(s.ok());
+    reader_builder.properties(arrow_reader_props);
+    std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
+    s = reader_builder.Build(&arrow_reader);
+    EXPECT_TRUE(s.ok());
+
+    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+    s = arrow_reader->GetRecordBatchReader(&rb_reader);
+    EXPECT_TRUE(s.ok());
+    ArrowDataWrapper wrapper(rb_reader, std::move(arrow_reader), nullptr);
+
+    FieldMeta field_meta(FieldName("a"),
+                         milvus::FieldId(1),
+                         DataType::VECTOR_FLOAT,
+                         dim,
+                         knowhere::metric::L2,
+                         false,
+                         std::nullopt);
+    auto chunk = create_chunk(field_meta, wrapper);
+    auto fixed_chunk = static_cast<FixedWidthChunk*>(chunk.get());
+    auto span = fixed_chunk->Span();
+    EXPECT_EQ(span.row_count(), row_num);
+    EXPECT_EQ(0, memcmp(span.data(), data.data(), data.size() * sizeof(float)));
+}
+
 TEST(chunk, test_variable_field) {
     FixedVector<std::string> data = {
         "test1", "test2", "test3", "test4", "test5"};
@@ -9,10 +9,17 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
+#include <arrow/builder.h>
 #include <cachinglayer/Translator.h>
+#include <algorithm>
+#include <cstring>
+#include <random>
 #include "common/Chunk.h"
+#include "common/ChunkWriter.h"
+#include "common/GroupChunk.h"
 #include "gtest/gtest.h"
 #include "mmap/ChunkedColumn.h"
+#include "mmap/ChunkedColumnGroup.h"
 #include "test_cachinglayer/cachinglayer_test_utils.h"
 
 namespace milvus {
@@ -44,4 +51,369 @@ TEST(test_chunked_column, test_get_chunkid) {
         }
     }
 }
+
+namespace {
+// with empty chunks in front, in between and at the end
+const std::vector<int64_t> kBulkRowsPerChunk = {0, 7, 0, 13, 1, 0, 9, 0};
+constexpr int64_t kBulkDim = 4;
+const FieldId kInt64Field(1);
+const FieldId kStringField(2);
+const FieldId kJsonField(3);
+const FieldId kVectorField(4);
+
+int64_t
+Int64Of(int64_t row) {
+    return row * 10 + 1;
+}
+
+std::string
+StringOf(int64_t row) {
+    return "str_" + std::string(row % 5, 'x') + std::to_string(row);
+}
+
+std::string
+JsonOf(int64_t row) {
+    return "{\"row\":" + std::to_string(row) + "}";
+}
+
+float
+VectorOf(int64_t row, int64_t d) {
+    return row * kBulkDim + d + 0.5f;
+}
+
+FieldMeta
+BulkFieldMeta(FieldId field_id) {
+    if (field_id == kInt64Field) {
+        return FieldMeta(
+            FieldName("int64"), field_id, DataType::INT64, false, std::nullopt);
+    } else if (field_id == kStringField) {
+        return FieldMeta(FieldName("string"),
+                         field_id,
+                         DataType::VARCHAR,
+                         false,
+                         std::nullopt);
+    } else if (field_id == kJsonField) {
+        return FieldMeta(
+            FieldName("json"), field_id, DataType::JSON, false, std::nullopt);
+    }
+    return FieldMeta(FieldName("vector"),
+                     field_id,
+                     DataType::VECTOR_FLOAT,
+                     kBulkDim,
+                     knowhere::metric::L2,
+                     false,
+                     std::nullopt);
+}
+
+// the rows [begin, begin + rows) of a field as a chunk
+std::unique_ptr<Chunk>
+MakeBulkChunk(FieldId field_id, int64_t begin, int64_t rows) {
+    auto field_meta = BulkFieldMeta(field_id);
+    if (rows == 0) {
+        if (field_id == kInt64Field) {
+            return std::make_unique<FixedWidthChunk>(
+                0, 1, nullptr, 0, sizeof(int64_t), false);
+        } else if (field_id == kVectorField) {
+            return std::make_unique<FixedWidthChunk>(
+                0, kBulkDim, nullptr, 0, sizeof(float), false);
+        }
+        return std::make_unique<StringChunk>(0, nullptr, 0, false);
+    }
+    std::shared_ptr<arrow::Array> array;
+    if (field_id == kInt64Field) {
+        arrow::Int64Builder builder;
+        for (int64_t row = begin; row < begin + rows; ++row) {
+            EXPECT_TRUE(builder.Append(Int64Of(row)).ok());
+        }
+        EXPECT_TRUE(builder.Finish(&array).ok());
+    } else if (field_id == kStringField) {
+        arrow::StringBuilder builder;
+        for (int64_t row = begin; row < begin + rows; ++row) {
+            EXPECT_TRUE(builder.Append(StringOf(row)).ok());
+        }
+        EXPECT_TRUE(builder.Finish(&array).ok());
+    } else if (field_id == kJsonField) {
+        arrow::BinaryBuilder builder;
+        for (int64_t row = begin; row < begin + rows; ++row) {
+            EXPECT_TRUE(builder.Append(JsonOf(row)).ok());
+        }
+        EXPECT_TRUE(builder.Finish(&array).ok());
+    } else {
+        arrow::FixedSizeBinaryBuilder builder(
+            arrow::fixed_size_binary(kBulkDim * sizeof(float)));
+        for (int64_t row = begin; row < begin + rows; ++row) {
+            float vec[kBulkDim];
+            for (int64_t d = 0; d < kBulkDim; ++d) {
+                vec[d] = VectorOf(row, d);
+            }
+            EXPECT_TRUE(
+                builder.Append(reinterpret_cast<const uint8_t*>(vec)).ok());
+        }
+        EXPECT_TRUE(builder.Finish(&array).ok());
+    }
+    return create_chunk(field_meta, arrow::ArrayVector{array});
+}
+
+std::shared_ptr<ChunkedColumnInterface>
+MakeChunkedColumn(FieldId field_id) {
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    int64_t begin = 0;
+    for (auto rows : kBulkRowsPerChunk) {
+        chunks.push_back(MakeBulkChunk(field_id, begin, rows));
+        begin += rows;
+    }
+    auto translator = std::make_unique<TestChunkTranslator>(
+        kBulkRowsPerChunk,
+        "bulk_chunk_at_" + std::to_string(field_id.get()),
+        std::move(chunks));
+    auto field_meta = BulkFieldMeta(field_id);
+    if (field_id == kStringField) {
+        return std::make_shared<ChunkedVariableColumn<std::string>>(
+            std::move(translator), field_meta);
+    } else if (field_id == kJsonField) {
+        return std::make_shared<ChunkedVariableColumn<Json>>(
+            std::move(translator), field_meta);
+    }
+    return std::make_shared<ChunkedColumn>(std::move(translator), field_meta);
+}
+
+std::shared_ptr<ChunkedColumnGroup>
+MakeColumnGroup() {
+    std::vector<std::unique_ptr<GroupChunk>> group_chunks;
+    int64_t begin = 0;
+    for (auto rows : kBulkRowsPerChunk) {
+        std::unordered_map<FieldId, std::shared_ptr<Chunk>> chunks;
+        for (auto field_id :
+             {kInt64Field, kStringField, kJsonField, kVectorField}) {
+            chunks[field_id] = MakeBulkChunk(field_id, begin, rows);
+        }
+        group_chunks.push_back(std::make_unique<GroupChunk>(chunks));
+        begin += rows;
+    }
+    auto translator =
+        std::make_unique<TestGroupChunkTranslator>(4,
+                                                   kBulkRowsPerChunk,
+                                                   "bulk_chunk_at_group",
+                                                   std::move(group_chunks));
+    return std::make_shared<ChunkedColumnGroup>(std::move(translator));
+}
+
+// every row but the first and the last, some of them more than once, in
+// random order
+std::vector<int64_t>
+ShuffledOffsets() {
+    int64_t num_rows = 0;
+    for (auto rows : kBulkRowsPerChunk) {
+        num_rows += rows;
+    }
+    std::vector<int64_t> offsets;
+    for (int64_t row = 1; row < num_rows - 1; ++row) {
+        offsets.push_back(row);
+        if (row % 4 == 0) {
+            offsets.push_back(row);
+        }
+    }
+    offsets.push_back(num_rows / 2);
+    std::shuffle(offsets.begin(), offsets.end(), std::mt19937(42));
+    return offsets;
+}
+
+// BulkChunkAt must visit every offset once, the chunks in order and only
+// non empty ones, and each chunk's offsets in the order they are given.
+void
+CheckChunkGroups(const ChunkedColumnInterface& column,
+                 const std::vector<int64_t>& offsets) {
+    std::vector<int> visits(offsets.size(), 0);
+    int64_t last_chunk_id = -1;
+    column.BulkChunkAt(
+        [&](const Chunk* chunk,
+            const int64_t* offsets_in_chunk,
+            const int64_t* indices,
+            int64_t n) {
+            ASSERT_GT(n, 0);
+            auto [chunk_id, _] = column.GetChunkIDByOffset(offsets[indices[0]]);
+            ASSERT_GT(int64_t(chunk_id), last_chunk_id);
+            last_chunk_id = chunk_id;
+            ASSERT_EQ(chunk, column.GetChunk(chunk_id).get());
+            for (int64_t j = 0; j < n; ++j) {
+                if (j > 0) {
+                    ASSERT_LT(indices[j - 1], indices[j]);
+                }
+                auto [cid, offset_in_chunk] =
+                    column.GetChunkIDByOffset(offsets[indices[j]]);
+                ASSERT_EQ(cid, chunk_id);
+                ASSERT_EQ(offsets_in_chunk[j], int64_t(offset_in_chunk));
+                visits[indices[j]]++;
+            }
+        },
+        offsets.data(),
+        offsets.size());
+    for (auto count : visits) {
+        ASSERT_EQ(count, 1);
+    }
+}
+
+// The gathers below do what the bulk_subscript paths of sealed segments do
+// with BulkChunkAt, and are checked against the row wise accessors.
+void
+CheckScalarGather(ChunkedColumnInterface& column,
+                  const std::vector<int64_t>& offsets) {
+    std::vector<int64_t> dst(offsets.size(), -1);
+    column.BulkChunkAt(
+        [&](const Chunk* chunk,
+            const int64_t* offsets_in_chunk,
+            const int64_t* indices,
+            int64_t n) {
+            auto src = reinterpret_cast<const int64_t*>(chunk->Data());
+            for (int64_t j = 0; j < n; ++j) {
+                dst[indices[j]] = src[offsets_in_chunk[j]];
+            }
+        },
+        offsets.data(),
+        offsets.size());
+    size_t checked = 0;
+    column.BulkValueAt(
+        [&](const char* value, size_t i) {
+            ASSERT_EQ(dst[i], *reinterpret_cast<const int64_t*>(value));
+            ASSERT_EQ(dst[i], Int64Of(offsets[i]));
+            checked++;
+        },
+        offsets.data(),
+        offsets.size());
+    ASSERT_EQ(checked, offsets.size());
+}
+
+std::vector<std::string>
+GatherStrings(const ChunkedColumnInterface& column,
+              const std::vector<int64_t>& offsets) {
+    std::vector<std::string> dst(offsets.size());
+    column.BulkChunkAt(
+        [&](const Chunk* chunk,
+            const int64_t* offsets_in_chunk,
+            const int64_t* indices,
+            int64_t n) {
+            auto string_chunk = static_cast<const StringChunk*>(chunk);
+            for (int64_t j = 0; j < n; ++j) {
+                auto value = (*string_chunk)[offsets_in_chunk[j]];
+                dst[indices[j]].assign(value.data(), value.size());
+            }
+        },
+        offsets.data(),
+        offsets.size());
+    return dst;
+}
+
+void
+CheckStringGather(const ChunkedColumnInterface& column,
+                  const std::vector<int64_t>& offsets) {
+    auto dst = GatherStrings(column, offsets);
+    size_t checked = 0;
+    column.BulkRawStringAt(
+        [&](std::string_view value, size_t i, bool is_valid) {
+            ASSERT_TRUE(is_valid);
+            ASSERT_EQ(dst[i], value);
+            ASSERT_EQ(dst[i], StringOf(offsets[i]));
+            checked++;
+        },
+        offsets.data(),
+        offsets.size());
+    ASSERT_EQ(checked, offsets.size());
+}
+
+void
+CheckJsonGather(const ChunkedColumnInterface& column,
+                const std::vector<int64_t>& offsets) {
+    auto dst = GatherStrings(column, offsets);
+    size_t checked = 0;
+    column.BulkRawJsonAt(
+        [&](Json value, size_t i, bool is_valid) {
+            ASSERT_TRUE(is_valid);
+            ASSERT_EQ(dst[i], value.data());
+            ASSERT_EQ(dst[i], JsonOf(offsets[i]));
+            checked++;
+        },
+        offsets.data(),
+        offsets.size());
+    ASSERT_EQ(checked, offsets.size());
+}
+
+void
+CheckVectorGather(ChunkedColumnInterface& column,
+                  const std::vector<int64_t>& offsets) {
+    constexpr int64_t element_sizeof = kBulkDim * sizeof(float);
+    std::vector<float> dst(offsets.size() * kBulkDim, -1);
+    auto dst_vec = reinterpret_cast<char*>(dst.data());
+    column.BulkChunkAt(
+        [&](const Chunk* chunk,
+            const int64_t* offsets_in_chunk,
+            const int64_t* indices,
+            int64_t n) {
+            auto src = chunk->Data();
+            for (int64_t j = 0; j < n; ++j) {
+                memcpy(dst_vec + indices[j] * element_sizeof,
+                       src + offsets_in_chunk[j] * element_sizeof,
+                       element_sizeof);
+            }
+        },
+        offsets.data(),
+        offsets.size());
+    size_t checked = 0;
+    column.BulkValueAt(
+        [&](const char* value, size_t i) {
+            ASSERT_EQ(memcmp(dst_vec + i * element_sizeof,
+                             value,
+                             element_sizeof),
+                      0);
+            for (int64_t d = 0; d < kBulkDim; ++d) {
+                ASSERT_EQ(dst[i * kBulkDim + d], VectorOf(offsets[i], d));
+            }
+            checked++;
+        },
+        offsets.data(),
+        offsets.size());
+    ASSERT_EQ(checked, offsets.size());
+}
+
+void
+CheckBulkChunkAt(
+    const std::function<std::shared_ptr<ChunkedColumnInterface>(FieldId)>&
+        make_column) {
+    auto offsets = ShuffledOffsets();
+    auto int64_column = make_column(kInt64Field);
+    auto string_column = make_column(kStringField);
+    auto json_column = make_column(kJsonField);
+    auto vector_column = make_column(kVectorField);
+    for (auto& column :
+         {int64_column, string_column, json_column, vector_column}) {
+        CheckChunkGroups(*column, offsets);
+    }
+    CheckScalarGather(*int64_column, offsets);
+    CheckStringGather(*string_column, offsets);
+    CheckJsonGather(*json_column, offsets);
+    CheckVectorGather(*vector_column, offsets);
+
+    // the rows of a single chunk, and no rows at all
+    std::vector<int64_t> single_chunk = {12, 8, 12, 19};
+    CheckChunkGroups(*int64_column, single_chunk);
+    CheckScalarGather(*int64_column, single_chunk);
+    int64_column->BulkChunkAt(
+        [](const Chunk*, const int64_t*, const int64_t*, int64_t) {
+            FAIL() << "no chunk expected for no offsets";
+        },
+        nullptr,
+        0);
+}
+}  // namespace
+
+TEST(test_chunked_column, test_bulk_chunk_at) {
+    CheckBulkChunkAt(MakeChunkedColumn);
+}
+
+TEST(test_chunked_column, test_proxy_bulk_chunk_at) {
+    auto group = MakeColumnGroup();
+    CheckBulkChunkAt([&](FieldId field_id) {
+        return std::make_shared<ProxyChunkColumn>(
+            group, field_id, BulkFieldMeta(field_id));
+    });
+}
 }  // namespace milvus
@@ -24,6 +24,7 @@
 #include <gtest/gtest.h>
 #include "arrow/type_fwd.h"
 #include "common/BitsetView.h"
+#include "common/Common.h"
 #include "common/Consts.h"
 #include "common/QueryInfo.h"
 #include "common/Schema.h"
@@ -174,6 +175,92 @@ TEST(test_chunk_segment, TestSearchOnSealed) {
     }
 }
 
+TEST(test_chunk_segment, TestSearchOnSealedParallelChunks) {
+    DeferRelease defer;
+
+    int dim = 16;
+    int chunk_num = 7;
+    int chunk_size = 100;
+    int total_row_count = chunk_num * chunk_size;
+
+    auto schema = std::make_shared<Schema>();
+    auto fakevec_id = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+
+    auto field_meta = schema->operator[](fakevec_id);
+
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    std::vector<int64_t> num_rows_per_chunk;
+    for (int i = 0; i < chunk_num; i++) {
+        num_rows_per_chunk.push_back(chunk_size);
+        auto dataset = segcore::DataGen(schema, chunk_size, 42 + i);
+        auto data = dataset.get_col<float>(fakevec_id);
+        auto buf_size = 4 * data.size();
+
+        char* buf = new char[buf_size];
+        defer.AddDefer([buf]() { delete[] buf; });
+        memcpy(buf, data.data(), 4 * data.size());
+
+        chunks.emplace_back(std::make_unique<FixedWidthChunk>(
+            chunk_size, dim, buf, buf_size, 4, false));
+    }
+
+    auto translator = std::make_unique<TestChunkTranslator>(
+        num_rows_per_chunk, "", std::move(chunks));
+    auto column =
+        std::make_shared<ChunkedColumn>(std::move(translator), field_meta);
+
+    SearchInfo search_info;
+    search_info.search_params_ = knowhere::Json{
+        {knowhere::meta::METRIC_TYPE, knowhere::metric::L2},
+    };
+    search_info.field_id_ = fakevec_id;
+    search_info.metric_type_ = knowhere::metric::L2;
+    search_info.topk_ = 10;
+    search_info.round_decimal_ = -1;
+
+    // filter out every third row so that the bitset is honored per range
+    BitsetType bitset(total_row_count, false);
+    for (int i = 0; i < total_row_count; i += 3) {
+        bitset[i] = true;
+    }
+    BitsetView bv(bitset);
+
+    int num_queries = 4;
+    auto query_ds = segcore::DataGen(schema, num_queries);
+    auto query_data = query_ds.get_col<float>(fakevec_id);
+    auto index_info = std::map<std::string, std::string>{};
+
+    auto search = [&](int64_t parallelism) {
+        SetDefaultBruteForceChunkParallelism(parallelism);
+        SearchResult result;
+        query::SearchOnSealedColumn(*schema,
+                                    column.get(),
+                                    search_info,
+                                    index_info,
+                                    query_data.data(),
+                                    num_queries,
+                                    total_row_count,
+                                    bv,
+                                    result);
+        return result;
+    };
+    auto expected = search(1);
+    for (int64_t parallelism : {2, 3, 7, 16}) {
+        auto result = search(parallelism);
+        ASSERT_EQ(expected.seg_offsets_, result.seg_offsets_);
+        ASSERT_EQ(expected.distances_, result.distances_);
+        ASSERT_EQ(expected.unity_topK_, result.unity_topK_);
+        ASSERT_EQ(expected.total_nq_, result.total_nq_);
+    }
+    SetDefaultBruteForceChunkParallelism(DEFAULT_BRUTE_FORCE_CHUNK_PARALLELISM);
+
+    for (auto offset : expected.seg_offsets_) {
+        ASSERT_NE(offset, INVALID_SEG_OFFSET);
+        ASSERT_NE(offset % 3, 0);
+    }
+}
+
 class TestChunkSegment : public testing::TestWithParam<bool> {
  protected:
     void
@@ -10,6 +10,7 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <random>
 #include <string>
 #include <thread>
@@ -110,3 +111,102 @@ TEST(ConcurrentVector, TestAckSingle) {
     }
     EXPECT_EQ(ack.GetAck(), N);
 }
+
+TEST(ConcurrentVector, TestValidDataMultithreads) {
+    constexpr int threads = 8;
+    constexpr int64_t total_rows = 3 * ThreadSafeValidData::kRowsPerChunk + 7;
+    milvus::FieldMeta field_meta(milvus::FieldName("nullable"),
+                                 milvus::FieldId(100),
+                                 milvus::DataType::INT64,
+                                 true,
+                                 std::nullopt);
+    auto expected = [](int64_t offset) { return offset % 3 != 0; };
+
+    ThreadSafeValidData valid_data;
+    std::atomic<int64_t> reserved = 0;
+    auto executor = [&](int thread_id) {
+        std::default_random_engine e(42 + thread_id);
+        while (true) {
+            int64_t insert_size = e() % 150 + 1;
+            auto offset = reserved.fetch_add(insert_size);
+            if (offset >= total_rows) {
+                break;
+            }
+            insert_size = std::min(insert_size, total_rows - offset);
+            milvus::DataArray data;
+            for (int64_t i = 0; i < insert_size; ++i) {
+                data.add_valid_data(expected(offset + i));
+            }
+            valid_data.set_data_raw(offset, insert_size, &data, field_meta);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (int i = 0; i < threads; ++i) {
+        pool.emplace_back(executor, i);
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    ASSERT_GE(valid_data.capacity(), total_rows);
+    for (int64_t i = 0; i < total_rows; ++i) {
+        ASSERT_EQ(valid_data.is_valid(i), expected(i));
+    }
+
+    int64_t offset = 61;
+    int64_t count = ThreadSafeValidData::kRowsPerChunk + 100;
+    milvus::FixedVector<bool> buffer(count);
+    valid_data.get_valid(offset, count, buffer.data());
+    milvus::TargetBitmap bitmap(count, true);
+    valid_data.and_valid(offset, count, bitmap.view());
+    for (int64_t i = 0; i < count; ++i) {
+        ASSERT_EQ(buffer[i], expected(offset + i));
+        ASSERT_EQ(bool(bitmap[i]), expected(offset + i));
+    }
+}
+
+TEST(ConcurrentVector, TestValidDataChunkBitmap) {
+    // chunks of a row count which is not a multiple of a word
+    constexpr int64_t rows_per_chunk = 1000;
+    constexpr int64_t total_rows = 3 * rows_per_chunk + 7;
+    milvus::FieldMeta field_meta(milvus::FieldName("nullable"),
+                                 milvus::FieldId(100),
+                                 milvus::DataType::INT64,
+                                 true,
+                                 std::nullopt);
+    auto expected = [](int64_t offset) { return offset % 7 != 0; };
+
+    ThreadSafeValidData valid_data(rows_per_chunk);
+    milvus::DataArray data;
+    for (int64_t i = 0; i < total_rows; ++i) {
+        data.add_valid_data(expected(i));
+    }
+    valid_data.set_data_raw(0, total_rows, &data, field_meta);
+    ASSERT_EQ(valid_data.capacity(), 4 * rows_per_chunk);
+
+    for (int64_t i = 0; i < total_rows; ++i) {
+        ASSERT_EQ(valid_data.is_valid(i), expected(i));
+    }
+    for (int64_t chunk_id = 0; chunk_id < 4; ++chunk_id) {
+        auto begin = chunk_id * rows_per_chunk;
+        auto count = std::min(rows_per_chunk, total_rows - begin) - 3;
+        auto [words, bit] = valid_data.get_bitmap(begin + 3, count);
+        for (int64_t i = 0; i < count; ++i) {
+            auto pos = bit + i;
+            ASSERT_EQ(bool((words[pos >> 6] >> (pos & 63)) & 1),
+                      expected(begin + 3 + i));
+        }
+    }
+    EXPECT_ANY_THROW(valid_data.get_bitmap(rows_per_chunk - 1, 2));
+
+    int64_t offset = 61;
+    int64_t count = 2 * rows_per_chunk + 100;
+    milvus::FixedVector<bool> buffer(count);
+    valid_data.get_valid(offset, count, buffer.data());
+    milvus::TargetBitmap bitmap(count, true);
+    valid_data.and_valid(offset, count, bitmap.view());
+    for (int64_t i = 0; i < count; ++i) {
+        ASSERT_EQ(buffer[i], expected(offset + i));
+        ASSERT_EQ(bool(bitmap[i]), expected(offset + i));
+    }
+}
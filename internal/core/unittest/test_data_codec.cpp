@@ -866,4 +866,37 @@ TEST(storage, InsertDataJsonFillWithNull) {
     ASSERT_EQ(new_payload->get_null_count(), size);
     ASSERT_EQ(*new_payload->ValidData(), *valid_data);
     delete[] valid_data;
-}
\ No newline at end of file
+}
+TEST(storage, InsertDataJson) {
+    FixedVector<Json> data;
+    for (int i = 0; i < 100; ++i) {
+        data.emplace_back(simdjson::padded_string(
+            fmt::format(R"({{"id": {}, "name": "row_{}"}})", i, i)));
+    }
+    data.emplace_back(simdjson::padded_string(std::string("{}")));
+    auto field_data =
+        milvus::storage::CreateFieldData(storage::DataType::JSON, false);
+    field_data->FillFieldData(data.data(), data.size());
+
+    auto payload_reader =
+        std::make_shared<milvus::storage::PayloadReader>(field_data);
+    storage::InsertData insert_data(payload_reader);
+    storage::FieldDataMeta field_data_meta{100, 101, 102, 103};
+    insert_data.SetFieldDataMeta(field_data_meta);
+    insert_data.SetTimestamps(0, 100);
+
+    auto serialized_bytes = insert_data.Serialize(storage::StorageType::Remote);
+    std::shared_ptr<uint8_t[]> serialized_data_ptr(serialized_bytes.data(),
+                                                   [&](uint8_t*) {});
+    auto new_insert_data = storage::DeserializeFileData(
+        serialized_data_ptr, serialized_bytes.size());
+    ASSERT_EQ(new_insert_data->GetCodecType(), storage::InsertDataType);
+    auto new_payload = new_insert_data->GetFieldData();
+    ASSERT_EQ(new_payload->get_data_type(), storage::DataType::JSON);
+    ASSERT_EQ(new_payload->get_num_rows(), data.size());
+    ASSERT_EQ(new_payload->get_null_count(), 0);
+    for (size_t i = 0; i < data.size(); ++i) {
+        auto json = static_cast<const Json*>(new_payload->RawValue(i));
+        ASSERT_EQ(json->data(), data[i].data());
+    }
+}
@@ -306,6 +306,131 @@ TEST(DeleteMVCC, snapshot) {
     ASSERT_EQ(snapshots[2].second.count(), 30000);
 }
 
+TEST(DeleteMVCC, query_between_snapshots) {
+    using namespace milvus;
+    using namespace milvus::query;
+    using namespace milvus::segcore;
+
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("age", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+    auto N = 50000;
+    InsertRecord<false> insert_record(*schema, N);
+    DeletedRecord<false> delete_record(
+        &insert_record,
+        [&insert_record](const PkType& pk, Timestamp timestamp) {
+            return insert_record.search_pk(pk, timestamp);
+        },
+        0);
+
+    std::vector<int64_t> age_data(N);
+    std::vector<Timestamp> tss(N);
+    for (int i = 0; i < N; ++i) {
+        age_data[i] = i;
+        tss[i] = i;
+        insert_record.insert_pk(age_data[i], i);
+    }
+    auto insert_offset = insert_record.reserved.fetch_add(N);
+    insert_record.timestamps_.set_data_raw(insert_offset, tss.data(), N);
+    auto field_data = insert_record.get_data_base(i64_fid);
+    field_data->set_data_raw(insert_offset, age_data.data(), N);
+    insert_record.ack_responder_.AddSegment(insert_offset, insert_offset + N);
+
+    // delete row i at ts i + 1, in several pushes
+    auto DN = 40000;
+    auto batch = 7000;
+    for (int begin = 0; begin < DN; begin += batch) {
+        auto end = std::min(begin + batch, DN);
+        std::vector<Timestamp> delete_ts;
+        std::vector<PkType> delete_pk;
+        for (int i = begin; i < end; ++i) {
+            delete_pk.emplace_back(age_data[i]);
+            delete_ts.emplace_back(i + 1);
+        }
+        delete_record.StreamPush(delete_pk, delete_ts.data());
+    }
+    ASSERT_EQ(DN, delete_record.size());
+    ASSERT_EQ(3, delete_record.get_snapshots().size());
+    // a single dense bitmap and sparse deltas
+    ASSERT_GT(delete_record.GetSnapshotBitsSize(), N);
+    ASSERT_LT(delete_record.GetSnapshotBitsSize(), 2 * N);
+
+    // timestamps before, at and between checkpoints and buckets
+    for (Timestamp query_timestamp :
+         {0, 1, 999, 1000, 1001, 5500, 10000, 15432, 29999, 30000, 30001,
+          35500, 39000, 39999, 40000, 45000}) {
+        for (int64_t insert_barrier : {N, 20000}) {
+            BitsetType bitsets(insert_barrier);
+            BitsetTypeView bitsets_view(bitsets);
+            delete_record.Query(bitsets_view, insert_barrier, query_timestamp);
+            for (int64_t i = 0; i < insert_barrier; i++) {
+                bool deleted = i < DN && i + 1 <= query_timestamp;
+                ASSERT_EQ(bitsets_view[i], deleted)
+                    << i << " " << query_timestamp << " " << insert_barrier;
+            }
+        }
+    }
+}
+
+TEST(DeleteMVCC, push_one_at_a_time) {
+    using namespace milvus;
+    using namespace milvus::query;
+    using namespace milvus::segcore;
+
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("age", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+    auto N = 12000;
+    InsertRecord<false> insert_record(*schema, N);
+    DeletedRecord<false> delete_record(
+        &insert_record,
+        [&insert_record](const PkType& pk, Timestamp timestamp) {
+            return insert_record.search_pk(pk, timestamp);
+        },
+        0);
+
+    std::vector<int64_t> age_data(N);
+    std::vector<Timestamp> tss(N);
+    for (int i = 0; i < N; ++i) {
+        age_data[i] = i;
+        tss[i] = 0;
+        insert_record.insert_pk(age_data[i], i);
+    }
+    auto insert_offset = insert_record.reserved.fetch_add(N);
+    insert_record.timestamps_.set_data_raw(insert_offset, tss.data(), N);
+    auto field_data = insert_record.get_data_base(i64_fid);
+    field_data->set_data_raw(insert_offset, age_data.data(), N);
+    insert_record.ack_responder_.AddSegment(insert_offset, insert_offset + N);
+
+    // delete rows 2k and 2k + 1 at ts k + 1, one row per push, so that the
+    // bucket being filled is extended by every push
+    auto DN = 10500;
+    for (int i = 0; i < DN; ++i) {
+        std::vector<PkType> delete_pk{age_data[i]};
+        std::vector<Timestamp> delete_ts{Timestamp(i / 2 + 1)};
+        delete_record.StreamPush(delete_pk, delete_ts.data());
+    }
+    ASSERT_EQ(DN, delete_record.size());
+
+    auto snapshots = delete_record.get_snapshots();
+    ASSERT_EQ(1, snapshots.size());
+    ASSERT_EQ(snapshots[0].second.count(), 10000);
+
+    for (Timestamp query_timestamp : {0, 1, 499, 500, 4999, 5000, 5001, 6000}) {
+        BitsetType bitsets(N);
+        BitsetTypeView bitsets_view(bitsets);
+        delete_record.Query(bitsets_view, N, query_timestamp);
+        for (int64_t i = 0; i < N; i++) {
+            bool deleted = i < DN && i / 2 + 1 <= query_timestamp;
+            ASSERT_EQ(bitsets_view[i], deleted) << i << " " << query_timestamp;
+        }
+    }
+}
+
 TEST(DeleteMVCC, insert_after_snapshot) {
     using namespace milvus;
     using namespace milvus::query;
@@ -27,6 +27,7 @@
 #include <chrono>
 #include <roaring/roaring.hh>
 
+#include "common/Common.h"
 #include "common/FieldDataInterface.h"
 #include "common/Json.h"
 #include "common/JsonCastType.h"
@@ -17030,3 +17031,330 @@ TEST_P(JsonIndexBinaryExprTest, TestBinaryRangeExpr) {
         EXPECT_TRUE(res == expect_result);
     }
 }
+
+TEST(Expr, TestJsonShadowColumnSealed) {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("age64", DataType::INT64);
+    auto json_fid = schema->AddDebugField("json", DataType::JSON);
+    schema->set_primary_field_id(i64_fid);
+
+    int64_t N = 600;
+    std::vector<milvus::Json> jsons;
+    for (int64_t i = 0; i < N; ++i) {
+        std::string json_str;
+        switch (i % 6) {
+            case 0:
+                json_str = (boost::format(R"({"price": %1%, "tag": "t%2%",)"
+                                          R"( "flag": true,)"
+                                          R"( "nested": {"v": %3%}})") %
+                            i % (i % 3) % (i / 2))
+                               .str();
+                break;
+            case 1:
+                json_str = (boost::format(R"({"price": %1%.5, "tag": "t%2%",)"
+                                          R"( "flag": false,)"
+                                          R"( "nested": {"v": %3%.5}})") %
+                            i % (i % 3) % (i / 2))
+                               .str();
+                break;
+            case 2:
+                json_str = (boost::format(R"({"price": "p%1%", "tag": %1%,)"
+                                          R"( "nested": {"v": "x"}})") %
+                            i)
+                               .str();
+                break;
+            case 3:
+                json_str = (boost::format(R"({"other": %1%})") % i).str();
+                break;
+            case 4:
+                json_str = (boost::format(R"({"price": [1, 2], "tag": null,)"
+                                          R"( "flag": true,)"
+                                          R"( "nested": {"v": %1%}})") %
+                            i)
+                               .str();
+                break;
+            default:
+                json_str = (boost::format(R"({"price": %1%, "tag": "t%2%",)"
+                                          R"( "flag": false, "nested": 1})") %
+                            i % (i % 3))
+                               .str();
+        }
+        jsons.push_back(milvus::Json(simdjson::padded_string(json_str)));
+    }
+    // two binlogs, so the field has two chunks
+    auto json_field =
+        std::make_shared<FieldData<milvus::Json>>(DataType::JSON, false);
+    auto json_field2 =
+        std::make_shared<FieldData<milvus::Json>>(DataType::JSON, false);
+    json_field->add_json_data(jsons);
+    json_field2->add_json_data(jsons);
+
+    std::vector<std::vector<std::string>> paths = {
+        {"price"}, {"tag"}, {"flag"}, {"nested", "v"}};
+    std::vector<proto::plan::GenericValue> values(4);
+    values[0].set_int64_val(50);
+    values[1].set_float_val(49.5);
+    values[2].set_string_val("t1");
+    values[3].set_bool_val(true);
+    std::vector<proto::plan::OpType> ops = {proto::plan::GreaterThan,
+                                            proto::plan::GreaterEqual,
+                                            proto::plan::LessThan,
+                                            proto::plan::LessEqual,
+                                            proto::plan::Equal,
+                                            proto::plan::NotEqual};
+    std::vector<std::pair<proto::plan::GenericValue,
+                          proto::plan::GenericValue>>
+        ranges(3);
+    ranges[0].first.set_int64_val(10);
+    ranges[0].second.set_int64_val(300);
+    ranges[1].first.set_float_val(10.5);
+    ranges[1].second.set_float_val(299.5);
+    ranges[2].first.set_string_val("t0");
+    ranges[2].second.set_string_val("t1");
+
+    std::vector<expr::TypedExprPtr> exprs;
+    for (const auto& path : paths) {
+        auto column = expr::ColumnInfo(json_fid, DataType::JSON, path);
+        for (const auto& value : values) {
+            for (auto op : ops) {
+                exprs.push_back(std::make_shared<expr::UnaryRangeFilterExpr>(
+                    column,
+                    op,
+                    value,
+                    std::vector<proto::plan::GenericValue>()));
+            }
+        }
+        for (const auto& [lower, upper] : ranges) {
+            for (auto inclusive : {true, false}) {
+                exprs.push_back(std::make_shared<expr::BinaryRangeFilterExpr>(
+                    column, lower, upper, inclusive, !inclusive));
+            }
+        }
+    }
+
+    auto cm = milvus::storage::RemoteChunkManagerSingleton::GetInstance()
+                  .GetRemoteChunkManager();
+    // chunks may be built lazily, so evaluate with the knob still set
+    auto evaluate = [&](int64_t max_paths) {
+        auto default_max_paths = JSON_SHADOW_COLUMN_MAX_PATHS;
+        JSON_SHADOW_COLUMN_MAX_PATHS = max_paths;
+        auto seg = CreateSealedSegment(schema);
+        auto load_info = PrepareSingleFieldInsertBinlog(
+            1, 1, 1, json_fid.get(), {json_field, json_field2}, cm);
+        seg->LoadFieldData(load_info);
+        for (int64_t chunk_id = 0; chunk_id < 2; ++chunk_id) {
+            auto price = seg->GetJsonShadowColumn(json_fid, chunk_id, "/price");
+            auto nested =
+                seg->GetJsonShadowColumn(json_fid, chunk_id, "/nested/v");
+            auto other = seg->GetJsonShadowColumn(json_fid, chunk_id, "/other");
+            EXPECT_EQ(price.get() != nullptr, max_paths > 0);
+            EXPECT_EQ(nested.get() != nullptr, max_paths > 0);
+            EXPECT_EQ(other.get(), nullptr);
+        }
+        std::vector<BitsetType> results;
+        for (const auto& expr : exprs) {
+            auto plan = std::make_shared<plan::FilterBitsNode>(
+                DEFAULT_PLANNODE_ID, expr);
+            results.push_back(
+                ExecuteQueryExpr(plan, seg.get(), 2 * N, MAX_TIMESTAMP));
+        }
+        JSON_SHADOW_COLUMN_MAX_PATHS = default_max_paths;
+        return results;
+    };
+    auto parsed = evaluate(0);
+    auto shadowed = evaluate(4);
+    ASSERT_EQ(parsed.size(), shadowed.size());
+    for (size_t i = 0; i < parsed.size(); ++i) {
+        EXPECT_TRUE(parsed[i] == shadowed[i]) << "expr " << i;
+    }
+}
+
+TEST(Expr, TestParallelFilterBits) {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("int64", DataType::INT64);
+    auto i32_fid = schema->AddDebugField("int32", DataType::INT32);
+    auto str_fid = schema->AddDebugField("string", DataType::VARCHAR);
+    schema->set_primary_field_id(i64_fid);
+
+    int64_t N = 10000;
+    auto raw_data = DataGen(schema, N);
+    auto sealed = CreateSealedSegment(schema);
+    LoadGeneratedDataIntoSegment(raw_data, sealed.get(), true);
+    auto growing = CreateGrowingSegment(schema, empty_index_meta);
+    growing->PreInsert(N);
+    growing->Insert(0,
+                    N,
+                    raw_data.row_ids_.data(),
+                    raw_data.timestamps_.data(),
+                    raw_data.raw_);
+
+    auto unary = [](FieldId fid, DataType type, auto op, auto set_val) {
+        proto::plan::GenericValue value;
+        set_val(value);
+        return std::make_shared<expr::UnaryRangeFilterExpr>(
+            expr::ColumnInfo(fid, type),
+            op,
+            value,
+            std::vector<proto::plan::GenericValue>{});
+    };
+    auto i32_gt = unary(i32_fid,
+                        DataType::INT32,
+                        proto::plan::OpType::GreaterThan,
+                        [](auto& v) { v.set_int64_val(0); });
+    auto i64_lt = unary(i64_fid,
+                        DataType::INT64,
+                        proto::plan::OpType::LessThan,
+                        [](auto& v) { v.set_int64_val(N / 2); });
+    auto str_prefix = unary(str_fid,
+                            DataType::VARCHAR,
+                            proto::plan::OpType::PrefixMatch,
+                            [](auto& v) { v.set_string_val("1"); });
+    std::vector<proto::plan::GenericValue> terms(100);
+    for (int i = 0; i < 100; ++i) {
+        terms[i].set_int64_val(i * 37);
+    }
+    auto i64_in = std::make_shared<expr::TermFilterExpr>(
+        expr::ColumnInfo(i64_fid, DataType::INT64), terms);
+
+    std::vector<expr::TypedExprPtr> exprs = {
+        i32_gt,
+        str_prefix,
+        i64_in,
+        std::make_shared<expr::LogicalBinaryExpr>(
+            expr::LogicalBinaryExpr::OpType::And, i32_gt, i64_lt),
+        std::make_shared<expr::LogicalBinaryExpr>(
+            expr::LogicalBinaryExpr::OpType::Or, str_prefix, i64_in),
+        std::make_shared<expr::LogicalUnaryExpr>(
+            expr::LogicalUnaryExpr::OpType::LogicalNot, str_prefix),
+    };
+
+    // small batches so the rows split into several morsels
+    auto default_batch_size = EXEC_EVAL_EXPR_BATCH_SIZE;
+    auto default_parallelism = EXEC_EVAL_EXPR_MAX_PARALLELISM;
+    EXEC_EVAL_EXPR_BATCH_SIZE = 300;
+    auto evaluate = [&](const segcore::SegmentInternalInterface* segment,
+                        int64_t parallelism) {
+        EXEC_EVAL_EXPR_MAX_PARALLELISM = parallelism;
+        std::vector<BitsetType> results;
+        for (const auto& expr : exprs) {
+            auto plan = std::make_shared<plan::FilterBitsNode>(
+                DEFAULT_PLANNODE_ID, expr);
+            results.push_back(
+                ExecuteQueryExpr(plan, segment, N, MAX_TIMESTAMP));
+        }
+        return results;
+    };
+    for (auto segment : {static_cast<segcore::SegmentInternalInterface*>(
+                             sealed.get()),
+                         static_cast<segcore::SegmentInternalInterface*>(
+                             growing.get())}) {
+        auto serial = evaluate(segment, 1);
+        for (int64_t parallelism : {2, 3, 16}) {
+            auto parallel = evaluate(segment, parallelism);
+            ASSERT_EQ(serial.size(), parallel.size());
+            for (size_t i = 0; i < serial.size(); ++i) {
+                ASSERT_EQ(parallel[i].size(), N);
+                EXPECT_TRUE(serial[i] == parallel[i])
+                    << "expr " << i << " parallelism " << parallelism;
+            }
+        }
+    }
+    EXEC_EVAL_EXPR_BATCH_SIZE = default_batch_size;
+    EXEC_EVAL_EXPR_MAX_PARALLELISM = default_parallelism;
+}
+
+TEST(Expr, TestQueryProfile) {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("int64", DataType::INT64);
+    auto i32_fid = schema->AddDebugField("int32", DataType::INT32);
+    schema->set_primary_field_id(i64_fid);
+
+    int64_t N = 10000;
+    auto raw_data = DataGen(schema, N);
+    auto sealed = CreateSealedSegment(schema);
+    LoadGeneratedDataIntoSegment(raw_data, sealed.get(), true);
+
+    auto unary = [](FieldId fid, DataType type, auto op, int64_t val) {
+        proto::plan::GenericValue value;
+        value.set_int64_val(val);
+        return std::make_shared<expr::UnaryRangeFilterExpr>(
+            expr::ColumnInfo(fid, type),
+            op,
+            value,
+            std::vector<proto::plan::GenericValue>{});
+    };
+    auto expr = std::make_shared<expr::LogicalBinaryExpr>(
+        expr::LogicalBinaryExpr::OpType::And,
+        unary(i32_fid, DataType::INT32, proto::plan::OpType::GreaterThan, 0),
+        unary(i64_fid, DataType::INT64, proto::plan::OpType::LessThan, N));
+    auto run = [&](bool profiled) {
+        auto config = std::make_shared<exec::QueryConfig>(
+            std::unordered_map<std::string, std::string>{
+                {exec::QueryConfig::kQueryProfileEnabled,
+                 profiled ? "true" : "false"}});
+        auto query_context =
+            std::make_shared<exec::QueryContext>(DEAFULT_QUERY_ID,
+                                                 sealed.get(),
+                                                 N,
+                                                 MAX_TIMESTAMP,
+                                                 0,
+                                                 0,
+                                                 config);
+        auto plan = plan::PlanFragment(std::make_shared<plan::FilterBitsNode>(
+            DEFAULT_PLANNODE_ID, expr));
+        auto bitset = ExecPlanNodeVisitor::ExecuteTask(plan, query_context);
+        return std::make_pair(query_context, bitset);
+    };
+
+    ASSERT_EQ(run(false).first->profile(), nullptr);
+
+    auto [query_context, bitset] = run(true);
+    ASSERT_NE(query_context->profile(), nullptr);
+    auto operators = query_context->profile()->operators();
+    auto filter = std::find_if(
+        operators.begin(), operators.end(), [](const auto& op) {
+            return op.type_ == "PhyFilterBitsNode";
+        });
+    ASSERT_NE(filter, operators.end());
+    EXPECT_EQ(filter->stats_.output_batches_, 1);
+    EXPECT_EQ(filter->stats_.output_rows_, N);
+    EXPECT_GT(filter->stats_.wall_ns_, 0);
+
+    // the conjunction and its two inputs, in pre order
+    auto batches = upper_div(N, EXEC_EVAL_EXPR_BATCH_SIZE);
+    ASSERT_EQ(filter->exprs_.size(), 3);
+    const auto& root = filter->exprs_[0];
+    EXPECT_EQ(root.depth_, 0);
+    EXPECT_EQ(root.stats_.batches_, batches);
+    EXPECT_EQ(root.stats_.input_rows_, N);
+    // the executor marks the filtered out rows
+    EXPECT_EQ(root.stats_.output_rows_, N - bitset.count());
+    EXPECT_EQ(root.stats_.index_batches_ + root.stats_.data_batches_, 0);
+    for (size_t i = 1; i < filter->exprs_.size(); ++i) {
+        const auto& input = filter->exprs_[i];
+        EXPECT_EQ(input.depth_, 1);
+        EXPECT_GT(input.stats_.batches_, 0);
+        EXPECT_EQ(input.stats_.data_batches_, input.stats_.batches_);
+        EXPECT_EQ(input.stats_.index_batches_, 0);
+        EXPECT_LE(root.stats_.output_rows_, input.stats_.output_rows_);
+        EXPECT_GE(root.stats_.wall_ns_, input.stats_.wall_ns_);
+    }
+
+    auto json = nlohmann::json::parse(query_context->profile()->ToString());
+    ASSERT_TRUE(json.is_array());
+    bool found = false;
+    for (const auto& op : json) {
+        if (op["operator"] == "PhyFilterBitsNode") {
+            found = true;
+            ASSERT_EQ(op["exprs"].size(), 3);
+            EXPECT_EQ(op["exprs"][1]["path"], "data");
+        }
+    }
+    EXPECT_TRUE(found);
+}
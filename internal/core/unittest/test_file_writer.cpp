@@ -924,3 +924,42 @@ TEST_F(FileWriterTest, ConfigChangeDuringFileWriterOperations) {
     std::filesystem::remove(filename1);
     std::filesystem::remove(filename2);
 }
+
+// Test writing through io_uring, or the fallback if it is unavailable, with
+// fewer buffers than the chunks so that the buffers are reused
+TEST_F(FileWriterTest, IoUringWriteWithBufferedAndDirectIO) {
+    FileWriter::SetBufferSize(kBufferSize);
+    FileWriteWorkerPool::GetInstance().Configure(0);
+    IoUring::SetQueueDepth(2);
+
+    std::vector<size_t> chunk_sizes = {10,
+                                       kBufferSize - 1,
+                                       kBufferSize,
+                                       kBufferSize + 1,
+                                       kBufferSize * 10 + 7};
+    for (auto mode :
+         {FileWriter::WriteMode::BUFFERED, FileWriter::WriteMode::DIRECT}) {
+        FileWriter::SetMode(mode);
+        auto name = "io_uring_" + std::to_string(static_cast<int>(mode));
+        std::string filename = (test_dir_ / name).string();
+        FileWriter writer(filename);
+
+        std::vector<char> expected_data;
+        for (size_t size : chunk_sizes) {
+            std::vector<char> chunk(size);
+            std::generate(chunk.begin(), chunk.end(), std::rand);
+            writer.Write(chunk.data(), chunk.size());
+            expected_data.insert(
+                expected_data.end(), chunk.begin(), chunk.end());
+        }
+        EXPECT_EQ(writer.Finish(), expected_data.size());
+
+        std::ifstream file(filename, std::ios::binary);
+        std::vector<char> read_data((std::istreambuf_iterator<char>(file)),
+                                    std::istreambuf_iterator<char>());
+        EXPECT_EQ(read_data, expected_data);
+    }
+
+    IoUring::SetQueueDepth(0);
+    FileWriter::SetMode(FileWriter::WriteMode::BUFFERED);
+}
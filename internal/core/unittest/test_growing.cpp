@@ -12,7 +12,10 @@
 #include <gtest/gtest.h>
 
 #include "common/Types.h"
+#include "expr/ITypeExpr.h"
 #include "knowhere/comp/index_param.h"
+#include "plan/PlanNode.h"
+#include "query/ExecPlanNodeVisitor.h"
 #include "segcore/SegmentGrowing.h"
 #include "segcore/SegmentGrowingImpl.h"
 #include "pb/schema.pb.h"
@@ -50,6 +53,118 @@ TEST(Growing, DeleteCount) {
     ASSERT_EQ(cnt, c);
 }
 
+TEST(Growing, InterimScalarIndex) {
+    auto schema = std::make_shared<Schema>();
+    auto pk = schema->AddDebugField("pk", DataType::INT64);
+    auto int32_fid = schema->AddDebugField("int32", DataType::INT32);
+    auto nullable_fid =
+        schema->AddDebugField("nullable", DataType::INT64, true);
+    auto str_fid = schema->AddDebugField("str", DataType::VARCHAR);
+    schema->set_primary_field_id(pk);
+
+    auto config = SegcoreConfig::default_config();
+    config.set_chunk_rows(1024);
+    config.set_enable_interim_segment_index(true);
+    config.set_enable_interim_scalar_index(true);
+    auto segment = CreateGrowingSegment(schema, empty_index_meta, 1, config);
+    config.set_enable_interim_scalar_index(false);
+
+    // the second batch is inserted first, the rows are indexed once the
+    // first batch fills the gap before them
+    int64_t n1 = 3000;
+    int64_t n2 = 2500;
+    auto first = DataGen(schema, n1, 42, 0);
+    auto second = DataGen(schema, n2, 43, n1);
+    auto offset1 = segment->PreInsert(n1);
+    auto offset2 = segment->PreInsert(n2);
+    segment->Insert(offset2,
+                    n2,
+                    second.row_ids_.data(),
+                    second.timestamps_.data(),
+                    second.raw_);
+    ASSERT_FALSE(segment->HasInterimScalarIndex(int32_fid, 1));
+    segment->Insert(offset1,
+                    n1,
+                    first.row_ids_.data(),
+                    first.timestamps_.data(),
+                    first.raw_);
+    auto N = n1 + n2;
+    ASSERT_TRUE(segment->HasInterimScalarIndex(int32_fid, N));
+    ASSERT_TRUE(segment->HasInterimScalarIndex(str_fid, N));
+
+    auto concat = [](auto a, const auto& b) {
+        a.insert(a.end(), b.begin(), b.end());
+        return a;
+    };
+    auto int32s = concat(first.get_col<int32_t>(int32_fid),
+                         second.get_col<int32_t>(int32_fid));
+    auto nullables = concat(first.get_col<int64_t>(nullable_fid),
+                            second.get_col<int64_t>(nullable_fid));
+    auto valids = concat(first.get_col_valid(nullable_fid),
+                         second.get_col_valid(nullable_fid));
+    auto strs = concat(first.get_col<std::string>(str_fid),
+                       second.get_col<std::string>(str_fid));
+
+    auto execute = [&](const expr::TypedExprPtr& expr) {
+        auto plan =
+            std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, expr);
+        auto final = ExecuteQueryExpr(plan, segment.get(), N, MAX_TIMESTAMP);
+        EXPECT_EQ(final.size(), N);
+        return final;
+    };
+
+    // term on rows of both the sorted runs and the partial chunk
+    std::vector<proto::plan::GenericValue> terms;
+    for (auto i : {7, 1500, 5400}) {
+        proto::plan::GenericValue val;
+        val.set_int64_val(int32s[i]);
+        terms.push_back(val);
+    }
+    auto final = execute(std::make_shared<expr::TermFilterExpr>(
+        expr::ColumnInfo(int32_fid, DataType::INT32), terms));
+    for (int64_t i = 0; i < N; ++i) {
+        auto expected = int32s[i] == int32s[7] || int32s[i] == int32s[1500] ||
+                        int32s[i] == int32s[5400];
+        ASSERT_EQ(final[i], expected) << i;
+    }
+
+    // null rows match neither a range nor a not equal
+    proto::plan::GenericValue pivot;
+    pivot.set_int64_val(nullables[2048]);
+    final = execute(std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(nullable_fid, DataType::INT64, {}, true),
+        proto::plan::OpType::GreaterThan,
+        pivot));
+    for (int64_t i = 0; i < N; ++i) {
+        ASSERT_EQ(final[i], valids[i] && nullables[i] > nullables[2048]) << i;
+    }
+    final = execute(std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(nullable_fid, DataType::INT64, {}, true),
+        proto::plan::OpType::NotEqual,
+        pivot));
+    for (int64_t i = 0; i < N; ++i) {
+        ASSERT_EQ(final[i], valids[i] && nullables[i] != nullables[2048])
+            << i;
+    }
+
+    auto sorted = strs;
+    std::sort(sorted.begin(), sorted.end());
+    proto::plan::GenericValue lower;
+    lower.set_string_val(sorted[N / 4]);
+    proto::plan::GenericValue upper;
+    upper.set_string_val(sorted[N / 2]);
+    final = execute(std::make_shared<expr::BinaryRangeFilterExpr>(
+        expr::ColumnInfo(str_fid, DataType::VARCHAR),
+        lower,
+        upper,
+        true,
+        false));
+    for (int64_t i = 0; i < N; ++i) {
+        ASSERT_EQ(final[i], strs[i] >= sorted[N / 4] && strs[i] < sorted[N / 2])
+            << i;
+    }
+}
+
 TEST(Growing, RealCount) {
     auto schema = std::make_shared<Schema>();
     auto pk = schema->AddDebugField("pk", DataType::INT64);
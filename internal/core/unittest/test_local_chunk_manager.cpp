@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 
+#include "storage/IoUring.h"
 #include "storage/LocalChunkManagerSingleton.h"
 
 using namespace std;
@@ -250,3 +251,35 @@ TEST_F(LocalChunkManagerTest, GetSizeOfDir) {
     exist = lcm->DirExist(test_dir);
     EXPECT_EQ(exist, false);
 }
+
+TEST_F(LocalChunkManagerTest, ReadWithIoUring) {
+    auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    string test_dir = lcm->GetRootPath() + "/local-test-dir";
+    string file = test_dir + "/test-read-io-uring";
+    lcm->CreateDir(test_dir);
+
+    // several parts of 1MB and a partial one
+    std::vector<uint8_t> data((3 << 20) + 123);
+    std::default_random_engine e(42);
+    for (auto& v : data) {
+        v = e() % 256;
+    }
+    lcm->Write(file, data.data(), data.size());
+
+    // falls back to the stream read if io_uring is unavailable
+    IoUring::SetQueueDepth(2);
+    std::vector<uint8_t> read_data(data.size());
+    auto size = lcm->Read(file, read_data.data(), read_data.size());
+    EXPECT_EQ(size, data.size());
+    EXPECT_EQ(read_data, data);
+
+    // the read stops at the end of the file
+    const uint64_t offset = (1 << 20) + 5;
+    std::vector<uint8_t> tail(data.size());
+    size = lcm->Read(file, offset, tail.data(), tail.size());
+    EXPECT_EQ(size, data.size() - offset);
+    EXPECT_TRUE(std::equal(data.begin() + offset, data.end(), tail.begin()));
+    IoUring::SetQueueDepth(0);
+
+    lcm->RemoveDir(test_dir);
+}
@@ -13,6 +13,7 @@
 #include <string>
 #include <vector>
 
+#include "common/Common.h"
 #include "storage/MinioChunkManager.h"
 #include "test_utils/indexbuilder_test_utils.h"
 
@@ -211,6 +212,42 @@ TEST_F(MinioChunkManagerTest, ReadPositive) {
     chunk_manager_->DeleteBucket(testBucketName);
 }
 
+TEST_F(MinioChunkManagerTest, ReadWriteInParts) {
+    string testBucketName = configs_.bucket_name;
+    chunk_manager_->SetBucketName(testBucketName);
+    if (!chunk_manager_->BucketExists(testBucketName)) {
+        chunk_manager_->CreateBucket(testBucketName);
+    }
+
+    // s3 requires parts other than the last one to be at least 5MB
+    const uint64_t part_size = 5 << 20;
+    const uint64_t size = 2 * part_size + 123;
+    std::vector<uint8_t> data(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        data[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    auto saved = STORAGE_MULTIPART_SIZE;
+    STORAGE_MULTIPART_SIZE = part_size;
+    string path = "1/4/7";
+    chunk_manager_->Write(path, data.data(), size);
+    EXPECT_EQ(chunk_manager_->Size(path), size);
+
+    std::vector<uint8_t> readdata(size);
+    EXPECT_EQ(chunk_manager_->Read(path, readdata.data(), size), size);
+    EXPECT_EQ(readdata, data);
+
+    // a prefix of the object, split into a full part and a partial one
+    const uint64_t prefix = part_size + 17;
+    std::vector<uint8_t> prefixdata(prefix);
+    EXPECT_EQ(chunk_manager_->Read(path, prefixdata.data(), prefix), prefix);
+    EXPECT_TRUE(std::equal(prefixdata.begin(), prefixdata.end(), data.begin()));
+
+    STORAGE_MULTIPART_SIZE = saved;
+    chunk_manager_->Remove(path);
+    chunk_manager_->DeleteBucket(testBucketName);
+}
+
 TEST_F(MinioChunkManagerTest, ReadNotExist) {
     string testBucketName = configs_.bucket_name;
     chunk_manager_->SetBucketName(testBucketName);
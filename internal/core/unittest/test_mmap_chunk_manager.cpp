@@ -20,4 +20,35 @@ TEST(MmapChunkManager, Register) {
     auto segment_descriptor = mcm->Register();
     ASSERT_TRUE(mcm->HasRegister(segment_descriptor));
     ASSERT_NO_THROW(mcm->UnRegister(segment_descriptor));
-}
\ No newline at end of file
+}
+/*
+checking the anonymous blocks with huge pages, which fall back to base pages
+where huge pages are unavailable
+*/
+TEST(MmapChunkManager, AnonBlock) {
+    using namespace milvus::storage;
+    const uint64_t size = 3 * 1024 * 1024 + 5;
+    for (auto huge_page : {HugePageMode::None,
+                           HugePageMode::Transparent,
+                           HugePageMode::Explicit}) {
+        MmapBlockOptions options;
+        options.anon_ = true;
+        options.huge_page_ = huge_page;
+        options.numa_local_ = true;
+        auto total_size = MmapBlock::TotalBlocksSize();
+        MmapBlock block("", size, MmapBlock::BlockType::Variable, options);
+        block.Init();
+        EXPECT_EQ(MmapBlock::TotalBlocksSize(), total_size + size);
+
+        auto first = static_cast<char*>(block.Get(1000));
+        auto second = static_cast<char*>(block.Get(size - 1000));
+        ASSERT_NE(first, nullptr);
+        ASSERT_EQ(second, first + 1000);
+        EXPECT_EQ(block.Get(1), nullptr);
+        memset(first, 1, size);
+        EXPECT_EQ(second[size - 1001], 1);
+
+        block.Close();
+        EXPECT_EQ(MmapBlock::TotalBlocksSize(), total_size);
+    }
+}
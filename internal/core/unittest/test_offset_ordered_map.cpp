@@ -10,7 +10,9 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <random>
+#include <thread>
 #include "segcore/InsertRecord.h"
 
 using namespace milvus;
@@ -52,7 +54,7 @@ class TypedOffsetOrderedMapTest : public testing::Test {
  protected:
     int64_t offset_ = 0;
     std::vector<T> data_;
-    milvus::segcore::OffsetOrderedMap<T> map_;
+    milvus::segcore::ShardedOffsetMap<T> map_;
     std::default_random_engine er;
 };
 
@@ -131,5 +133,58 @@ TYPED_TEST_P(TypedOffsetOrderedMapTest, find_first) {
     }
 }
 
-REGISTER_TYPED_TEST_SUITE_P(TypedOffsetOrderedMapTest, find_first);
+TYPED_TEST_P(TypedOffsetOrderedMapTest, concurrent_insert) {
+    constexpr int threads = 8;
+    constexpr int num_per_thread = 10000;
+    auto keys = this->random_generate(num_per_thread);
+
+    // every thread inserts all the keys, so each key gets one offset per thread
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t]() {
+            for (int i = 0; i < num_per_thread; ++i) {
+                this->map_.insert(keys[i], int64_t(t) * num_per_thread + i);
+                if (t == 0 && i % 1000 == 0) {
+                    // refresh the sorted view while inserting
+                    this->map_.find_first(10, {});
+                }
+            }
+        });
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    for (int i = 0; i < num_per_thread; ++i) {
+        ASSERT_TRUE(this->map_.contain(keys[i]));
+        auto offsets = this->map_.find(keys[i]);
+        ASSERT_GE(offsets.size(), threads);
+        for (int t = 0; t < threads; ++t) {
+            ASSERT_NE(std::find(offsets.begin(),
+                                offsets.end(),
+                                int64_t(t) * num_per_thread + i),
+                      offsets.end());
+        }
+    }
+
+    // the latest offset of every distinct key, in key order
+    auto sorted_keys = keys;
+    std::sort(sorted_keys.begin(), sorted_keys.end());
+    sorted_keys.erase(std::unique(sorted_keys.begin(), sorted_keys.end()),
+                      sorted_keys.end());
+    BitsetType all(threads * num_per_thread);
+    all.reset();
+    auto [offsets, has_more_res] = this->map_.find_first(Unlimited, all);
+    ASSERT_FALSE(has_more_res);
+    ASSERT_EQ(sorted_keys.size(), offsets.size());
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        auto offset = offsets[i];
+        ASSERT_GE(offset, (threads - 1) * num_per_thread);
+        ASSERT_EQ(keys[offset % num_per_thread], sorted_keys[i]);
+    }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TypedOffsetOrderedMapTest,
+                            find_first,
+                            concurrent_insert);
 INSTANTIATE_TYPED_TEST_SUITE_P(Prefix, TypedOffsetOrderedMapTest, TypeOfPks);
@@ -16,6 +16,8 @@
 
 #include "knowhere/comp/index_param.h"
 #include "query/SubSearchResult.h"
+#include "segcore/reduce/LoserTree.h"
+#include "segcore/reduce/PkDedupSet.h"
 
 using namespace milvus;
 using namespace milvus::query;
@@ -133,3 +135,81 @@ TEST(Reduce, SubSearchResult) {
     TestSubSearchResultMerge<queue_type_ip>(knowhere::metric::IP, 4, 16, 1);
     TestSubSearchResultMerge<queue_type_ip>(knowhere::metric::IP, 4, 16, 10);
 }
+
+TEST(Reduce, LoserTreeMerge) {
+    std::default_random_engine e(42);
+    for (int64_t num_lists : {1, 2, 3, 7, 16}) {
+        std::vector<SearchResult> results(num_lists);
+        std::vector<float> expected;
+        for (int64_t i = 0; i < num_lists; ++i) {
+            // list i may be empty
+            int64_t size = e() % 50;
+            auto& result = results[i];
+            for (int64_t j = 0; j < size; ++j) {
+                result.distances_.push_back(float(e() % 1000) - 500);
+                result.primary_keys_.push_back(int64_t(i * 1000 + j));
+            }
+            std::sort(result.distances_.begin(),
+                      result.distances_.end(),
+                      std::greater<float>());
+            expected.insert(expected.end(),
+                            result.distances_.begin(),
+                            result.distances_.end());
+        }
+        std::sort(expected.begin(), expected.end(), std::greater<float>());
+
+        std::vector<SearchResultPair> pairs;
+        for (int64_t i = 0; i < num_lists; ++i) {
+            auto& result = results[i];
+            int64_t size = result.distances_.size();
+            if (size == 0) {
+                continue;
+            }
+            pairs.emplace_back(result.primary_keys_[0],
+                               result.distances_[0],
+                               &result,
+                               i,
+                               0,
+                               size);
+        }
+        segcore::SearchResultLoserTree tree;
+        tree.Reset(pairs);
+        std::vector<float> merged;
+        while (!tree.empty()) {
+            merged.push_back(tree.top()->distance_);
+            tree.advance();
+        }
+        ASSERT_EQ(merged, expected);
+    }
+}
+
+TEST(Reduce, PkDedupSet) {
+    segcore::PkDedupSet set;
+    std::vector<PkType> int_pks;
+    for (int64_t i = 0; i < 1000; ++i) {
+        int_pks.emplace_back(i * 7);
+    }
+    set.clear(10);
+    for (const auto& pk : int_pks) {
+        ASSERT_TRUE(set.insert(pk));
+    }
+    ASSERT_EQ(set.size(), int_pks.size());
+    for (const auto& pk : int_pks) {
+        ASSERT_FALSE(set.insert(pk));
+        ASSERT_TRUE(set.contains(pk));
+    }
+    PkType absent = int64_t(3);
+    ASSERT_FALSE(set.contains(absent));
+
+    // a new generation forgets everything
+    set.clear(int_pks.size());
+    ASSERT_EQ(set.size(), 0);
+    ASSERT_FALSE(set.contains(int_pks[0]));
+
+    std::vector<PkType> str_pks = {
+        std::string("a"), std::string("b"), std::string("a")};
+    ASSERT_TRUE(set.insert(str_pks[0]));
+    ASSERT_TRUE(set.insert(str_pks[1]));
+    ASSERT_FALSE(set.insert(str_pks[2]));
+    ASSERT_EQ(set.size(), 2);
+}
@@ -10,7 +10,9 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include <gtest/gtest.h>
+#include <limits>
 
+#include "common/Common.h"
 #include "common/Types.h"
 #include "knowhere/comp/index_param.h"
 #include "test_utils/DataGen.h"
@@ -364,6 +366,62 @@ TEST_P(RetrieveTest, FillEntry) {
     Assert(retrieve_results->fields_data_size() == target_fields.size());
 }
 
+TEST_P(RetrieveTest, ParallelFillEntry) {
+    auto schema = std::make_shared<Schema>();
+    auto fid_64 = schema->AddDebugField("i64", DataType::INT64);
+    auto DIM = 16;
+    auto fid_bool = schema->AddDebugField("bool", DataType::BOOL);
+    auto fid_f64 = schema->AddDebugField("f64", DataType::DOUBLE);
+    auto fid_str = schema->AddDebugField("str", DataType::VARCHAR);
+    auto fid_json = schema->AddDebugField("json", DataType::JSON);
+    auto fid_vec =
+        schema->AddDebugField("vector", data_type, DIM, knowhere::metric::L2);
+    auto fid_vecbin = schema->AddDebugField(
+        "vec_bin", DataType::VECTOR_BINARY, DIM, knowhere::metric::L2);
+    schema->set_primary_field_id(fid_64);
+
+    // more rows than one fill task takes, so the columns are split
+    int64_t N = 150000;
+    auto dataset = DataGen(schema, N, 42);
+    auto segment = CreateSealedWithFieldDataLoaded(schema, dataset);
+    auto plan = std::make_unique<query::RetrievePlan>(schema);
+    proto::plan::GenericValue unary_val;
+    unary_val.set_int64_val(0);
+    auto expr = std::make_shared<expr::UnaryRangeFilterExpr>(
+        milvus::expr::ColumnInfo(
+            fid_64, DataType::INT64, std::vector<std::string>()),
+        OpType::GreaterEqual,
+        unary_val,
+        std::vector<proto::plan::GenericValue>{});
+    plan->plan_node_ = std::make_unique<query::RetrievePlanNode>();
+    plan->plan_node_->plannodes_ = milvus::test::CreateRetrievePlanByExpr(expr);
+    plan->field_ids_ = {TimestampFieldID,
+                        fid_64,
+                        fid_bool,
+                        fid_f64,
+                        fid_str,
+                        fid_json,
+                        fid_vec,
+                        fid_vecbin};
+
+    auto limit_size = std::numeric_limits<int64_t>::max();
+    auto expected =
+        segment->Retrieve(nullptr, plan.get(), N, limit_size, false);
+    for (int64_t parallelism : {2, 8}) {
+        SetDefaultOutputFieldMaxParallelism(parallelism);
+        auto results =
+            segment->Retrieve(nullptr, plan.get(), N, limit_size, false);
+        ASSERT_EQ(results->fields_data_size(), expected->fields_data_size());
+        for (int i = 0; i < results->fields_data_size(); ++i) {
+            ASSERT_EQ(results->fields_data(i).SerializeAsString(),
+                      expected->fields_data(i).SerializeAsString());
+        }
+        ASSERT_EQ(results->ids().SerializeAsString(),
+                  expected->ids().SerializeAsString());
+    }
+    SetDefaultOutputFieldMaxParallelism(DEFAULT_OUTPUT_FIELD_MAX_PARALLELISM);
+}
+
 TEST_P(RetrieveTest, LargeTimestamp) {
     auto schema = std::make_shared<Schema>();
     auto fid_64 = schema->AddDebugField("i64", DataType::INT64);
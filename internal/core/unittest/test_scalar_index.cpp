@@ -17,6 +17,7 @@
 #include "index/IndexFactory.h"
 #include "index/BitmapIndex.h"
 #include "index/InvertedIndexTantivy.h"
+#include "index/ScalarIndexSort.h"
 #include "index/ScalarIndex.h"
 #include "common/CDataType.h"
 #include "common/Types.h"
@@ -524,6 +525,54 @@ TEST(ScalarTest, test_function_In) {
     TestIndexSearchIn<std::string>();
 }
 
+TEST(ScalarTest, test_sort_index_window) {
+    const int64_t n = 20000;
+    std::default_random_engine rng(42);
+    std::vector<int64_t> data(n);
+    milvus::FixedVector<bool> valid_data(n);
+    for (int64_t i = 0; i < n; ++i) {
+        data[i] = rng() % 1000;
+        valid_data[i] = rng() % 10 != 0;
+    }
+    milvus::index::ScalarIndexSort<int64_t> index;
+    index.Build(n, data.data(), valid_data.data());
+    ASSERT_TRUE(index.SupportWindowQuery());
+
+    // a single value matches few rows, a wide range most of them, so both
+    // evaluation strategies of the window are exercised
+    std::vector<int64_t> one = {data[0]};
+    std::vector<int64_t> many = {3, 7, 7, 500, 999, 1234};
+    auto in_one = index.In(one.size(), one.data());
+    auto in_many = index.In(many.size(), many.data());
+    auto not_in_many = index.NotIn(many.size(), many.data());
+    auto less = index.Range(800, milvus::OpType::LessThan);
+    auto between = index.Range(100, false, 900, true);
+    auto valid = index.IsNotNull();
+
+    for (int64_t offset = 0; offset < n; offset += 4099) {
+        int64_t len = std::min<int64_t>(8192, n - offset);
+        milvus::TargetBitmap window(len);
+        auto check = [&](const milvus::TargetBitmap& expected) {
+            for (int64_t i = 0; i < len; ++i) {
+                ASSERT_EQ(bool(window[i]), bool(expected[offset + i]))
+                    << "offset: " << offset << ", @" << i;
+            }
+        };
+        index.InWindow(one.size(), one.data(), offset, window.view());
+        check(in_one);
+        index.InWindow(many.size(), many.data(), offset, window.view());
+        check(in_many);
+        index.NotInWindow(many.size(), many.data(), offset, window.view());
+        check(not_in_many);
+        index.RangeWindow(800, milvus::OpType::LessThan, offset, window.view());
+        check(less);
+        index.RangeWindow(100, false, 900, true, offset, window.view());
+        check(between);
+        index.IsNotNullWindow(offset, window.view());
+        check(valid);
+    }
+}
+
 template <typename T>
 void
 TestIndexSearchRange() {
@@ -1929,6 +1929,164 @@ TEST(Sealed, SkipIndexSkipStringRange) {
         string_fid, 0, 1, 2, false, true));
 }
 
+TEST(Sealed, SkipIndexSkipTermAndPrefix) {
+    auto schema = std::make_shared<Schema>();
+    auto dim = 128;
+    auto metrics_type = "L2";
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    auto i64_fid = schema->AddDebugField("int64_field", DataType::INT64);
+    auto string_fid = schema->AddDebugField("string_field", DataType::VARCHAR);
+    auto fake_vec_fid = schema->AddDebugField(
+        "fakeVec", DataType::VECTOR_FLOAT, dim, metrics_type);
+    size_t N = 5;
+    auto segment = CreateSealedSegment(schema);
+    auto cm = milvus::storage::RemoteChunkManagerSingleton::GetInstance()
+                  .GetRemoteChunkManager();
+
+    std::vector<int64_t> ints = {10, 20, 30, 40, 50};
+    auto int_field_data =
+        storage::CreateFieldData(DataType::INT64, false, 1, N);
+    int_field_data->FillFieldData(ints.data(), N);
+    auto load_info = PrepareSingleFieldInsertBinlog(kCollectionID,
+                                                    kPartitionID,
+                                                    kSegmentID,
+                                                    i64_fid.get(),
+                                                    {int_field_data},
+                                                    cm);
+    segment->LoadFieldData(load_info);
+
+    std::vector<std::string> strings = {
+        "apple", "apricot", "avocado", "banana", "blueberry"};
+    auto string_field_data =
+        storage::CreateFieldData(DataType::VARCHAR, false, 1, N);
+    string_field_data->FillFieldData(strings.data(), N);
+    load_info = PrepareSingleFieldInsertBinlog(kCollectionID,
+                                               kPartitionID,
+                                               kSegmentID,
+                                               string_fid.get(),
+                                               {string_field_data},
+                                               cm);
+    segment->LoadFieldData(load_info);
+
+    auto& skip_index = segment->GetSkipIndex();
+    // inside [min, max] but absent, rejected by the bloom filter
+    ASSERT_TRUE(skip_index.CanSkipTerm<int64_t>(
+        i64_fid, 0, std::vector<int64_t>{15, 25, 35}));
+    ASSERT_TRUE(skip_index.CanSkipTerm<int64_t>(
+        i64_fid, 0, std::vector<int64_t>{1, 100}));
+    ASSERT_FALSE(skip_index.CanSkipTerm<int64_t>(
+        i64_fid, 0, std::vector<int64_t>{15, 30}));
+    ASSERT_FALSE(
+        skip_index.CanSkipTerm<int64_t>(i64_fid, 0, std::vector<int64_t>{}));
+
+    ASSERT_TRUE(skip_index.CanSkipTerm<std::string>(
+        string_fid, 0, std::vector<std::string>{"apples", "cherry"}));
+    ASSERT_FALSE(skip_index.CanSkipTerm<std::string>(
+        string_fid, 0, std::vector<std::string>{"cherry", "banana"}));
+
+    ASSERT_FALSE(skip_index.CanSkipUnaryRange<std::string>(
+        string_fid, 0, OpType::PrefixMatch, "ap"));
+    ASSERT_FALSE(skip_index.CanSkipUnaryRange<std::string>(
+        string_fid, 0, OpType::PrefixMatch, "a"));
+    ASSERT_FALSE(skip_index.CanSkipUnaryRange<std::string>(
+        string_fid, 0, OpType::PrefixMatch, "blue"));
+    ASSERT_TRUE(skip_index.CanSkipUnaryRange<std::string>(
+        string_fid, 0, OpType::PrefixMatch, "c"));
+    ASSERT_TRUE(skip_index.CanSkipUnaryRange<std::string>(
+        string_fid, 0, OpType::PrefixMatch, "0"));
+}
+
+TEST(Sealed, SkipIndexSkipJsonAndArray) {
+    auto schema = std::make_shared<Schema>();
+    auto dim = 128;
+    auto metrics_type = "L2";
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    auto json_fid = schema->AddDebugField("json_field", DataType::JSON);
+    auto array_fid =
+        schema->AddDebugField("array_field", DataType::ARRAY, DataType::INT64);
+    auto fake_vec_fid = schema->AddDebugField(
+        "fakeVec", DataType::VECTOR_FLOAT, dim, metrics_type);
+    size_t N = 3;
+    auto segment = CreateSealedSegment(schema);
+    auto cm = milvus::storage::RemoteChunkManagerSingleton::GetInstance()
+                  .GetRemoteChunkManager();
+
+    std::vector<std::string> json_strs = {
+        R"({"a": 1, "b": "x", "s": "a"})",
+        R"({"a": 5, "b": "y", "c": {"d": 2.5}})",
+        R"({"a": 3, "arr": [1, 2], "s": ")" + std::string(200, 'q') + R"("})"};
+    std::vector<Json> jsons;
+    for (const auto& str : json_strs) {
+        jsons.emplace_back(simdjson::padded_string(str));
+    }
+    auto json_field_data =
+        storage::CreateFieldData(DataType::JSON, false, 1, N);
+    json_field_data->FillFieldData(jsons.data(), N);
+    auto load_info = PrepareSingleFieldInsertBinlog(kCollectionID,
+                                                    kPartitionID,
+                                                    kSegmentID,
+                                                    json_fid.get(),
+                                                    {json_field_data},
+                                                    cm);
+    segment->LoadFieldData(load_info);
+
+    std::vector<std::vector<int64_t>> rows = {{1, 2}, {3, 5}, {9}};
+    std::vector<milvus::Array> arrays;
+    for (const auto& row : rows) {
+        milvus::proto::schema::ScalarField field_data;
+        for (auto v : row) {
+            field_data.mutable_long_data()->add_data(v);
+        }
+        arrays.emplace_back(field_data);
+    }
+    auto array_field_data =
+        storage::CreateFieldData(DataType::ARRAY, false, 1, N);
+    array_field_data->FillFieldData(arrays.data(), N);
+    load_info = PrepareSingleFieldInsertBinlog(kCollectionID,
+                                               kPartitionID,
+                                               kSegmentID,
+                                               array_fid.get(),
+                                               {array_field_data},
+                                               cm);
+    segment->LoadFieldData(load_info);
+
+    auto& skip_index = segment->GetSkipIndex();
+    ASSERT_TRUE(skip_index.CanSkipJsonUnaryRange<int64_t>(
+        json_fid, 0, "/a", OpType::GreaterThan, 10));
+    ASSERT_FALSE(skip_index.CanSkipJsonUnaryRange<int64_t>(
+        json_fid, 0, "/a", OpType::Equal, 3));
+    ASSERT_TRUE(skip_index.CanSkipJsonUnaryRange<int64_t>(
+        json_fid, 0, "/missing", OpType::Equal, 1));
+    // integers compare against the double range as well
+    ASSERT_FALSE(skip_index.CanSkipJsonUnaryRange<int64_t>(
+        json_fid, 0, "/c/d", OpType::GreaterThan, 2));
+    ASSERT_TRUE(skip_index.CanSkipJsonUnaryRange<int64_t>(
+        json_fid, 0, "/c/d", OpType::LessThan, 2));
+    ASSERT_TRUE(skip_index.CanSkipJsonUnaryRange<std::string>(
+        json_fid, 0, "/b", OpType::Equal, "z"));
+    ASSERT_FALSE(skip_index.CanSkipJsonUnaryRange<std::string>(
+        json_fid, 0, "/b", OpType::PrefixMatch, "x"));
+    ASSERT_TRUE(skip_index.CanSkipJsonUnaryRange<std::string>(
+        json_fid, 0, "/a", OpType::Equal, "1"));
+    // the range of long strings is not kept
+    ASSERT_FALSE(skip_index.CanSkipJsonUnaryRange<std::string>(
+        json_fid, 0, "/s", OpType::Equal, "z"));
+    // elements of arrays are not summarized
+    ASSERT_FALSE(skip_index.CanSkipJsonUnaryRange<int64_t>(
+        json_fid, 0, "/arr/0", OpType::Equal, 100));
+    ASSERT_FALSE(skip_index.CanSkipJsonUnaryRange<int64_t>(
+        json_fid, 0, "/a", OpType::NotEqual, 1));
+
+    ASSERT_TRUE(skip_index.CanSkipTerm<int64_t>(
+        array_fid, 0, std::vector<int64_t>{4, 100}));
+    ASSERT_FALSE(skip_index.CanSkipTerm<int64_t>(
+        array_fid, 0, std::vector<int64_t>{4, 5}));
+    ASSERT_FALSE(skip_index.CanSkipContainsAll<int64_t>(
+        array_fid, 0, std::vector<int64_t>{1, 9}));
+    ASSERT_TRUE(skip_index.CanSkipContainsAll<int64_t>(
+        array_fid, 0, std::vector<int64_t>{1, 4}));
+}
+
 TEST(Sealed, QueryAllFields) {
     auto schema = std::make_shared<Schema>();
     auto metric_type = knowhere::metric::L2;
@@ -2280,6 +2438,54 @@ TEST(Sealed, SearchSortedPk) {
     EXPECT_EQ(100, offsets2[0].get());
 }
 
+TEST(Sealed, SearchSortedPksBatch) {
+    for (auto pk_type : {DataType::INT64, DataType::VARCHAR}) {
+        auto schema = std::make_shared<Schema>();
+        auto pk_field = schema->AddDebugField("pk", pk_type);
+        schema->set_primary_field_id(pk_field);
+        auto segment_sealed = CreateSealedSegment(
+            schema, nullptr, 999, SegcoreConfig::default_config(), true);
+        auto segment =
+            dynamic_cast<ChunkedSegmentSealedImpl*>(segment_sealed.get());
+
+        int64_t dataset_size = 1000;
+        auto dataset = DataGen(schema, dataset_size, 42, 0, 10);
+        LoadGeneratedDataIntoSegment(dataset, segment);
+
+        // unsorted, duplicated and absent pks with varying timestamps
+        std::vector<PkType> pks;
+        std::vector<Timestamp> timestamps;
+        for (int64_t i : {730, 100, 5, 999, 100, 42, 0, 517}) {
+            if (pk_type == DataType::INT64) {
+                pks.emplace_back(dataset.get_col<int64_t>(pk_field)[i]);
+            } else {
+                pks.emplace_back(dataset.get_col<std::string>(pk_field)[i]);
+            }
+            timestamps.emplace_back(i % 3 == 0 ? 99999 : i + 3);
+        }
+        if (pk_type == DataType::INT64) {
+            pks.emplace_back(int64_t(-1));
+        } else {
+            pks.emplace_back(std::string("not exist"));
+        }
+        timestamps.emplace_back(99999);
+
+        std::vector<std::vector<int64_t>> batch_offsets(pks.size());
+        segment->search_pks(
+            pks, timestamps.data(), [&](size_t i, SegOffset offset) {
+                batch_offsets[i].push_back(offset.get());
+            });
+        for (size_t i = 0; i < pks.size(); ++i) {
+            std::vector<int64_t> expected;
+            for (auto offset : segment->search_pk(pks[i], timestamps[i])) {
+                expected.push_back(offset.get());
+            }
+            EXPECT_EQ(expected, batch_offsets[i]) << i;
+        }
+        EXPECT_TRUE(batch_offsets.back().empty());
+    }
+}
+
 TEST(Sealed, QueryVectorArrayAllFields) {
     auto schema = std::make_shared<Schema>();
     auto metric_type = knowhere::metric::L2;
@@ -61,7 +61,7 @@ TEST(Span, Naive) {
         auto begin = chunk_id * size_per_chunk;
         auto end = std::min((chunk_id + 1) * size_per_chunk, N);
         auto size_of_chunk = end - begin;
-        ASSERT_EQ(age_span.get().valid_data(), nullptr);
+        ASSERT_FALSE(age_span.get().nullable());
         for (int i = 0; i < size_of_chunk * 512 / 8; ++i) {
             ASSERT_EQ(vec_span.get().data()[i], vec_ptr[i + begin * 512 / 8]);
         }
@@ -76,7 +76,7 @@ TEST(Span, Naive) {
                       nullable_data_ptr[i + begin]);
         }
         for (int i = 0; i < size_of_chunk; ++i) {
-            ASSERT_EQ(null_field_span.get().valid_data()[i],
+            ASSERT_EQ(null_field_span.get().is_valid(i),
                       nullable_valid_data_ptr[i + begin]);
         }
     }
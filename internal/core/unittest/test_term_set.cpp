@@ -0,0 +1,143 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "exec/expression/TermSet.h"
+
+using namespace milvus::exec;
+
+namespace {
+template <typename T>
+void
+CheckAgainstSet(const TermSet<T>& term_set,
+                const std::vector<T>& values,
+                const std::vector<T>& probes) {
+    std::set<T> expected(values.begin(), values.end());
+    for (const auto& probe : probes) {
+        ASSERT_EQ(term_set.Contains(probe), expected.count(probe) > 0)
+            << probe;
+    }
+}
+
+std::vector<int64_t>
+RandomInts(size_t n, int64_t lo, int64_t hi, uint32_t seed) {
+    std::default_random_engine e(seed);
+    std::uniform_int_distribution<int64_t> dist(lo, hi);
+    std::vector<int64_t> values(n);
+    for (auto& v : values) {
+        v = dist(e);
+    }
+    return values;
+}
+}  // namespace
+
+TEST(TermSet, IntKinds) {
+    using Kind = TermSet<int64_t>::Kind;
+    auto probes = RandomInts(20000, -3000, 3000, 1);
+    auto wide_probes = RandomInts(20000, INT64_MIN, INT64_MAX, 2);
+
+    auto small = RandomInts(10, -3000, 3000, 3);
+    TermSet<int64_t> small_set(small);
+    ASSERT_EQ(small_set.kind(), Kind::kLinear);
+    CheckAgainstSet(small_set, small, probes);
+    CheckAgainstSet(small_set, small, small);
+
+    auto narrow = RandomInts(1000, -3000, 3000, 4);
+    TermSet<int64_t> narrow_set(narrow);
+    ASSERT_EQ(narrow_set.kind(), Kind::kBitmap);
+    CheckAgainstSet(narrow_set, narrow, probes);
+    CheckAgainstSet(narrow_set, narrow, wide_probes);
+
+    auto wide = RandomInts(1000, INT64_MIN, INT64_MAX, 5);
+    wide.push_back(0);
+    wide.push_back(-1);
+    TermSet<int64_t> wide_set(wide);
+    ASSERT_EQ(wide_set.kind(), Kind::kHash);
+    CheckAgainstSet(wide_set, wide, wide);
+    CheckAgainstSet(wide_set, wide, wide_probes);
+    CheckAgainstSet(wide_set, wide, probes);
+}
+
+TEST(TermSet, SmallInts) {
+    std::vector<int8_t> values;
+    for (int v = -128; v < 128; v += 3) {
+        values.push_back(static_cast<int8_t>(v));
+    }
+    TermSet<int8_t> term_set(values);
+    ASSERT_EQ(term_set.kind(), TermSet<int8_t>::Kind::kBitmap);
+    std::vector<int8_t> probes;
+    for (int v = -128; v < 128; ++v) {
+        probes.push_back(static_cast<int8_t>(v));
+    }
+    CheckAgainstSet(term_set, values, probes);
+
+    TermSet<bool> bool_set(std::vector<bool>{true, true});
+    ASSERT_TRUE(bool_set.Contains(true));
+    ASSERT_FALSE(bool_set.Contains(false));
+}
+
+TEST(TermSet, Floating) {
+    std::vector<double> values;
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i * 0.5);
+    }
+    values.push_back(-0.0);
+    values.push_back(NAN);
+    TermSet<double> term_set(values);
+    ASSERT_EQ(term_set.kind(), TermSet<double>::Kind::kHash);
+    ASSERT_EQ(term_set.size(), 100);
+    ASSERT_TRUE(term_set.Contains(0.0));
+    ASSERT_TRUE(term_set.Contains(-0.0));
+    ASSERT_TRUE(term_set.Contains(49.5));
+    ASSERT_FALSE(term_set.Contains(0.25));
+    ASSERT_FALSE(term_set.Contains(NAN));
+
+    TermSet<float> small_set(std::vector<float>{1.5f, -0.0f});
+    ASSERT_EQ(small_set.kind(), TermSet<float>::Kind::kLinear);
+    ASSERT_TRUE(small_set.Contains(0.0f));
+    ASSERT_TRUE(small_set.Contains(1.5f));
+    ASSERT_FALSE(small_set.Contains(2.5f));
+}
+
+TEST(TermSet, Strings) {
+    std::vector<std::string> values;
+    std::vector<std::string> probes;
+    for (int i = 0; i < 2000; ++i) {
+        probes.push_back("key_" + std::to_string(i));
+        if (i % 3 == 0) {
+            values.push_back(probes.back());
+        }
+    }
+    probes.push_back("");
+    TermSet<std::string> term_set(values);
+    ASSERT_EQ(term_set.kind(), TermSet<std::string>::Kind::kHash);
+    CheckAgainstSet(term_set, values, probes);
+
+    // views into storage that goes away once the set is built
+    std::vector<std::string_view> views;
+    {
+        std::vector<std::string> owned(values.begin(), values.begin() + 5);
+        views.assign(owned.begin(), owned.end());
+        TermSet<std::string_view> view_set(views);
+        owned.clear();
+        for (int i = 0; i < 20; ++i) {
+            auto probe = "key_" + std::to_string(i);
+            ASSERT_EQ(view_set.Contains(std::string_view(probe)),
+                      i % 3 == 0 && i < 15);
+        }
+    }
+}
@@ -52,6 +52,10 @@ func InitSegcore() {
 	cIndexSliceSize := C.int64_t(paramtable.Get().CommonCfg.IndexSliceSize.GetAsInt64())
 	C.InitIndexSliceSize(cIndexSliceSize)
 
+	// override segcore multipart size of remote objects
+	cStorageMultipartSize := C.int64_t(paramtable.Get().CommonCfg.StorageMultipartSize.GetAsInt64())
+	C.InitStorageMultipartSize(cStorageMultipartSize)
+
 	// set up thread pool for different priorities
 	cHighPriorityThreadCoreCoefficient := C.float(paramtable.Get().CommonCfg.HighPriorityThreadCoreCoefficient.GetAsFloat())
 	C.InitHighPriorityThreadCoreCoefficient(cHighPriorityThreadCoreCoefficient)
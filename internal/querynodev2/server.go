@@ -253,6 +253,10 @@ func (node *QueryNode) InitSegcore() error {
 	cIndexSliceSize := C.int64_t(paramtable.Get().CommonCfg.IndexSliceSize.GetAsInt64())
 	C.InitIndexSliceSize(cIndexSliceSize)
 
+	// override segcore multipart size of remote objects
+	cStorageMultipartSize := C.int64_t(paramtable.Get().CommonCfg.StorageMultipartSize.GetAsInt64())
+	C.InitStorageMultipartSize(cStorageMultipartSize)
+
 	// set up thread pool for different priorities
 	cHighPriorityThreadCoreCoefficient := C.float(paramtable.Get().CommonCfg.HighPriorityThreadCoreCoefficient.GetAsFloat())
 	C.InitHighPriorityThreadCoreCoefficient(cHighPriorityThreadCoreCoefficient)
@@ -280,6 +284,28 @@ func (node *QueryNode) InitSegcore() error {
 	cOptimizeExprEnabled := C.bool(paramtable.Get().CommonCfg.EnabledOptimizeExpr.GetAsBool())
 	C.InitDefaultOptimizeExprEnable(cOptimizeExprEnabled)
 
+	// read ahead only helps when cells may have been evicted.
+	cReadAheadDepth := C.int64_t(0)
+	if paramtable.Get().QueryNodeCfg.TieredEvictionEnabled.GetAsBool() {
+		cReadAheadDepth = C.int64_t(paramtable.Get().QueryNodeCfg.TieredReadAheadDepth.GetAsInt64())
+	}
+	C.InitDefaultCacheReadAheadDepth(cReadAheadDepth)
+
+	cBruteForceChunkParallelism := C.int64_t(paramtable.Get().QueryNodeCfg.BruteForceChunkParallelism.GetAsInt64())
+	C.InitDefaultBruteForceChunkParallelism(cBruteForceChunkParallelism)
+
+	cJSONShadowColumnMaxPaths := C.int64_t(paramtable.Get().QueryNodeCfg.JSONShadowColumnMaxPaths.GetAsInt64())
+	C.InitDefaultJsonShadowColumnMaxPaths(cJSONShadowColumnMaxPaths)
+
+	cExprEvalMaxParallelism := C.int64_t(paramtable.Get().QueryNodeCfg.ExprEvalMaxParallelism.GetAsInt64())
+	C.InitDefaultExprEvalMaxParallelism(cExprEvalMaxParallelism)
+
+	cOutputFieldMaxParallelism := C.int64_t(paramtable.Get().QueryNodeCfg.OutputFieldMaxParallelism.GetAsInt64())
+	C.InitDefaultOutputFieldMaxParallelism(cOutputFieldMaxParallelism)
+
+	cQueryProfileEnabled := C.bool(paramtable.Get().QueryNodeCfg.QueryProfileEnabled.GetAsBool())
+	C.InitDefaultQueryProfileEnable(cQueryProfileEnabled)
+
 	cJSONKeyStatsCommitInterval := C.int64_t(paramtable.Get().QueryNodeCfg.JSONKeyStatsCommitInterval.GetAsInt64())
 	C.InitDefaultJSONKeyStatsCommitInterval(cJSONKeyStatsCommitInterval)
 
@@ -382,6 +408,11 @@ func (node *QueryNode) InitSegcore() error {
 	evictionEnabled := C.bool(paramtable.Get().QueryNodeCfg.TieredEvictionEnabled.GetAsBool())
 	cacheTouchWindowMs := C.int64_t(paramtable.Get().QueryNodeCfg.TieredCacheTouchWindowMs.GetAsInt64())
 	evictionIntervalMs := C.int64_t(paramtable.Get().QueryNodeCfg.TieredEvictionIntervalMs.GetAsInt64())
+	evictionPolicy, err := segcore.ConvertCacheEvictionPolicy(paramtable.Get().QueryNodeCfg.TieredEvictionPolicy.GetValue())
+	if err != nil {
+		return err
+	}
+	evictionShards := C.int64_t(paramtable.Get().QueryNodeCfg.TieredEvictionShards.GetAsInt64())
 
 	C.ConfigureTieredStorage(C.CacheWarmupPolicy(scalarFieldCacheWarmupPolicy),
 		C.CacheWarmupPolicy(vectorFieldCacheWarmupPolicy),
@@ -389,7 +420,8 @@ func (node *QueryNode) InitSegcore() error {
 		C.CacheWarmupPolicy(vectorIndexCacheWarmupPolicy),
 		memoryLowWatermarkBytes, memoryHighWatermarkBytes, memoryMaxBytes,
 		diskLowWatermarkBytes, diskHighWatermarkBytes, diskMaxBytes,
-		evictionEnabled, cacheTouchWindowMs, evictionIntervalMs)
+		evictionEnabled, cacheTouchWindowMs, evictionIntervalMs,
+		C.CacheEvictionPolicy(evictionPolicy), evictionShards)
 
 	err = initcore.InitInterminIndexConfig(paramtable.Get())
 	if err != nil {
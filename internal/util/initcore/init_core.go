@@ -249,8 +249,10 @@ func InitMmapManager(params *paramtable.ComponentParam) error {
 	mmapDirPath := params.QueryNodeCfg.MmapDirPath.GetValue()
 	cMmapChunkManagerDir := C.CString(path.Join(mmapDirPath, "/mmap_chunk_manager/"))
 	cCacheReadAheadPolicy := C.CString(params.QueryNodeCfg.ReadAheadPolicy.GetValue())
+	cHugePageMode := C.CString(params.QueryNodeCfg.MmapHugePageMode.GetValue())
 	defer C.free(unsafe.Pointer(cMmapChunkManagerDir))
 	defer C.free(unsafe.Pointer(cCacheReadAheadPolicy))
+	defer C.free(unsafe.Pointer(cHugePageMode))
 	diskCapacity := params.QueryNodeCfg.DiskCapacityLimit.GetAsUint64()
 	diskLimit := uint64(float64(params.QueryNodeCfg.MaxMmapDiskPercentageForMmapManager.GetAsUint64()*diskCapacity) * 0.01)
 	mmapFileSize := params.QueryNodeCfg.FixedFileSizeForMmapManager.GetAsFloat() * 1024 * 1024
@@ -264,6 +266,9 @@ func InitMmapManager(params *paramtable.ComponentParam) error {
 		scalar_field_enable_mmap: C.bool(params.QueryNodeCfg.MmapScalarField.GetAsBool()),
 		vector_index_enable_mmap: C.bool(params.QueryNodeCfg.MmapVectorIndex.GetAsBool()),
 		vector_field_enable_mmap: C.bool(params.QueryNodeCfg.MmapVectorField.GetAsBool()),
+		anon_arena_enable:        C.bool(params.QueryNodeCfg.MmapAnonArenaEnabled.GetAsBool()),
+		huge_page_mode:           cHugePageMode,
+		numa_local:               C.bool(params.QueryNodeCfg.MmapNumaLocal.GetAsBool()),
 	}
 	status := C.InitMmapManager(mmapConfig)
 	return HandleCStatus(&status, "InitMmapManager failed")
@@ -273,11 +278,13 @@ func InitFileWriterConfig(params *paramtable.ComponentParam) error {
 	mode := params.CommonCfg.DiskWriteMode.GetValue()
 	bufferSize := params.CommonCfg.DiskWriteBufferSizeKb.GetAsUint64()
 	numThreads := params.CommonCfg.DiskWriteNumThreads.GetAsInt()
+	ioUringQueueDepth := params.CommonCfg.DiskIoUringQueueDepth.GetAsInt()
 	cMode := C.CString(mode)
 	cBufferSize := C.uint64_t(bufferSize)
 	cNumThreads := C.int(numThreads)
+	cIoUringQueueDepth := C.int(ioUringQueueDepth)
 	defer C.free(unsafe.Pointer(cMode))
-	status := C.InitFileWriterConfig(cMode, cBufferSize, cNumThreads)
+	status := C.InitFileWriterConfig(cMode, cBufferSize, cNumThreads, cIoUringQueueDepth)
 	return HandleCStatus(&status, "InitFileWriterConfig failed")
 }
 
@@ -285,6 +292,9 @@ func InitInterminIndexConfig(params *paramtable.ComponentParam) error {
 	enableInterminIndex := C.bool(params.QueryNodeCfg.EnableInterminSegmentIndex.GetAsBool())
 	C.SegcoreSetEnableInterminSegmentIndex(enableInterminIndex)
 
+	enableInterimScalarIndex := C.bool(params.QueryNodeCfg.EnableInterimScalarIndex.GetAsBool())
+	C.SegcoreSetEnableInterimScalarIndex(enableInterimScalarIndex)
+
 	nlist := C.int64_t(params.QueryNodeCfg.InterimIndexNlist.GetAsInt64())
 	C.SegcoreSetNlist(nlist)
 
@@ -306,3 +306,14 @@ func ConvertCacheWarmupPolicy(policy string) (C.CacheWarmupPolicy, error) {
 		return C.CacheWarmupPolicy_Disable, fmt.Errorf("invalid Tiered Storage cache warmup policy: %s", policy)
 	}
 }
+
+func ConvertCacheEvictionPolicy(policy string) (C.CacheEvictionPolicy, error) {
+	switch policy {
+	case "lru":
+		return C.CacheEvictionPolicy_LRU, nil
+	case "2q":
+		return C.CacheEvictionPolicy_TwoQueue, nil
+	default:
+		return C.CacheEvictionPolicy_LRU, fmt.Errorf("invalid Tiered Storage cache eviction policy: %s", policy)
+	}
+}
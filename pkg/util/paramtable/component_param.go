@@ -245,6 +245,7 @@ type commonConfig struct {
 	DiskWriteMode         ParamItem `refreshable:"true"`
 	DiskWriteBufferSizeKb ParamItem `refreshable:"true"`
 	DiskWriteNumThreads   ParamItem `refreshable:"true"`
+	DiskIoUringQueueDepth ParamItem `refreshable:"true"`
 
 	AuthorizationEnabled  ParamItem `refreshable:"false"`
 	SuperUsers            ParamItem `refreshable:"true"`
@@ -275,6 +276,7 @@ type commonConfig struct {
 	EnableStorageV2           ParamItem `refreshable:"false"`
 	StoragePathPrefix         ParamItem `refreshable:"false"`
 	StorageZstdConcurrency    ParamItem `refreshable:"false"`
+	StorageMultipartSize      ParamItem `refreshable:"false"`
 	TTMsgEnabled              ParamItem `refreshable:"true"`
 	TraceLogMode              ParamItem `refreshable:"true"`
 	BloomFilterSize           ParamItem `refreshable:"true"`
@@ -687,6 +689,17 @@ In this case, the maximum concurrency of disk write operations is determined by
 	}
 	p.DiskWriteNumThreads.Init(base.mgr)
 
+	p.DiskIoUringQueueDepth = ParamItem{
+		Key:          "common.diskIoUringQueueDepth",
+		Version:      "2.6.0",
+		DefaultValue: "0",
+		Doc: `The queue depth of the io_uring rings used for local disk writes of temporary data and for large local disk reads, the valid range is [0, 4096].
+With a positive value, a writer keeps up to this many buffers of 'common.diskWriteBufferSizeKb' in flight instead of blocking a thread per write, and 'common.diskWriteNumThreads' is ignored.
+The default value is 0, which disables io_uring. It also falls back to the blocking writes if io_uring is not supported by the kernel.`,
+		Export: true,
+	}
+	p.DiskIoUringQueueDepth.Init(base.mgr)
+
 	p.BuildIndexThreadPoolRatio = ParamItem{
 		Key:          "common.buildIndexThreadPoolRatio",
 		Version:      "2.4.0",
@@ -876,6 +889,27 @@ The default value is 1, which is enough for most cases.`,
 	}
 	p.StorageZstdConcurrency.Init(base.mgr)
 
+	p.StorageMultipartSize = ParamItem{
+		Key:          "common.storage.multipartSize",
+		Version:      "2.6.0",
+		DefaultValue: "0",
+		Formatter: func(v string) string {
+			size := getAsInt64(v)
+			if size <= 0 {
+				return "0"
+			}
+			// S3 rejects multipart uploads with parts under 5MB
+			if size < 5 {
+				return "5"
+			}
+			return fmt.Sprintf("%d", size)
+		},
+		Doc: `Part size in MB of the ranged reads and multipart uploads segcore issues concurrently for objects larger than it, such as index files.
+0, the default, reads and writes every object with a single request.`,
+		Export: false,
+	}
+	p.StorageMultipartSize.Init(base.mgr)
+
 	p.TTMsgEnabled = ParamItem{
 		Key:          "common.ttMsgEnabled",
 		Version:      "2.3.2",
@@ -2819,6 +2853,7 @@ type queryNodeConfig struct {
 	KnowhereThreadPoolSize        ParamItem `refreshable:"false"`
 	ChunkRows                     ParamItem `refreshable:"false"`
 	EnableInterminSegmentIndex    ParamItem `refreshable:"false"`
+	EnableInterimScalarIndex      ParamItem `refreshable:"false"`
 	InterimIndexNlist             ParamItem `refreshable:"false"`
 	InterimIndexNProbe            ParamItem `refreshable:"false"`
 	InterimIndexSubDim            ParamItem `refreshable:"false"`
@@ -2844,6 +2879,14 @@ type queryNodeConfig struct {
 	TieredEvictionEnabled          ParamItem `refreshable:"false"`
 	TieredCacheTouchWindowMs       ParamItem `refreshable:"false"`
 	TieredEvictionIntervalMs       ParamItem `refreshable:"false"`
+	TieredEvictionPolicy           ParamItem `refreshable:"false"`
+	TieredEvictionShards           ParamItem `refreshable:"false"`
+	TieredReadAheadDepth           ParamItem `refreshable:"false"`
+	BruteForceChunkParallelism     ParamItem `refreshable:"false"`
+	JSONShadowColumnMaxPaths       ParamItem `refreshable:"false"`
+	ExprEvalMaxParallelism         ParamItem `refreshable:"false"`
+	OutputFieldMaxParallelism      ParamItem `refreshable:"false"`
+	QueryProfileEnabled            ParamItem `refreshable:"false"`
 
 	KnowhereScoreConsistency ParamItem `refreshable:"false"`
 
@@ -2870,6 +2913,9 @@ type queryNodeConfig struct {
 	GrowingMmapEnabled                  ParamItem `refreshable:"false"`
 	FixedFileSizeForMmapManager         ParamItem `refreshable:"false"`
 	MaxMmapDiskPercentageForMmapManager ParamItem `refreshable:"false"`
+	MmapAnonArenaEnabled                ParamItem `refreshable:"false"`
+	MmapHugePageMode                    ParamItem `refreshable:"false"`
+	MmapNumaLocal                       ParamItem `refreshable:"false"`
 
 	LazyLoadEnabled                      ParamItem `refreshable:"false"`
 	LazyLoadWaitTimeout                  ParamItem `refreshable:"true"`
@@ -3176,6 +3222,124 @@ eviction is necessary and the amount of data to evict from memory/disk.
 	}
 	p.TieredEvictionIntervalMs.Init(base.mgr)
 
+	p.TieredEvictionPolicy = ParamItem{
+		Key:          "queryNode.segcore.tieredStorage.evictionPolicy",
+		Version:      "2.6.0",
+		DefaultValue: "lru",
+		Doc: `Order in which unpinned cache entries are evicted. lru: least recently used first.
+2q: entries used only once, e.g. by a scan, are evicted before entries used again, so that large scans
+do not flush the hot entries.`,
+		Export: false,
+	}
+	p.TieredEvictionPolicy.Init(base.mgr)
+
+	p.TieredEvictionShards = ParamItem{
+		Key:          "queryNode.segcore.tieredStorage.evictionShards",
+		Version:      "2.6.0",
+		DefaultValue: "1",
+		Formatter: func(v string) string {
+			if getAsInt64(v) < 0 {
+				return "1"
+			}
+			return v
+		},
+		Doc: `Number of shards of the cache list, each with its own lock, so that concurrent accesses to the cache
+do not contend on a single lock. Eviction follows the order of the eviction policy within a shard and is
+only approximately global. The default 1 keeps a single, globally ordered list, 0 means one shard per cpu.`,
+		Export: false,
+	}
+	p.TieredEvictionShards.Init(base.mgr)
+
+	p.TieredReadAheadDepth = ParamItem{
+		Key:          "queryNode.segcore.tieredStorage.readAheadDepth",
+		Version:      "2.6.0",
+		DefaultValue: "0",
+		Formatter: func(v string) string {
+			depth := getAsInt64(v)
+			if depth < 0 {
+				return "0"
+			}
+			return fmt.Sprintf("%d", depth)
+		},
+		Doc: `Number of chunks pinned in the background ahead of a sequential column scan, 0 to disable.
+Only takes effect when eviction of tiered storage is enabled.`,
+		Export: false,
+	}
+	p.TieredReadAheadDepth.Init(base.mgr)
+
+	p.BruteForceChunkParallelism = ParamItem{
+		Key:          "queryNode.segcore.bruteForceChunkParallelism",
+		Version:      "2.6.0",
+		DefaultValue: "1",
+		Formatter: func(v string) string {
+			dop := getAsInt64(v)
+			if dop < 1 {
+				return "1"
+			}
+			return fmt.Sprintf("%d", dop)
+		},
+		Doc:    "Number of chunk ranges a brute force search on a sealed segment is split into and searched concurrently, 1 to search the chunks sequentially.",
+		Export: false,
+	}
+	p.BruteForceChunkParallelism.Init(base.mgr)
+
+	p.JSONShadowColumnMaxPaths = ParamItem{
+		Key:          "queryNode.segcore.jsonShadowColumnMaxPaths",
+		Version:      "2.6.0",
+		DefaultValue: "0",
+		Formatter: func(v string) string {
+			paths := getAsInt64(v)
+			if paths < 0 {
+				return "0"
+			}
+			return fmt.Sprintf("%d", paths)
+		},
+		Doc:    "Max number of frequent json paths per sealed chunk that are extracted into typed shadow columns at load time, so filters on them skip json parsing. 0 disables the extraction.",
+		Export: false,
+	}
+	p.JSONShadowColumnMaxPaths.Init(base.mgr)
+
+	p.ExprEvalMaxParallelism = ParamItem{
+		Key:          "queryNode.segcore.exprEvalMaxParallelism",
+		Version:      "2.6.0",
+		DefaultValue: "1",
+		Formatter: func(v string) string {
+			dop := getAsInt64(v)
+			if dop < 1 {
+				return "1"
+			}
+			return fmt.Sprintf("%d", dop)
+		},
+		Doc:    "Max number of threads evaluating the filter expression of one segment concurrently, each on its own range of rows. 1 evaluates the rows sequentially.",
+		Export: false,
+	}
+	p.ExprEvalMaxParallelism.Init(base.mgr)
+
+	p.OutputFieldMaxParallelism = ParamItem{
+		Key:          "queryNode.segcore.outputFieldMaxParallelism",
+		Version:      "2.6.0",
+		DefaultValue: "1",
+		Formatter: func(v string) string {
+			dop := getAsInt64(v)
+			if dop < 1 {
+				return "1"
+			}
+			return fmt.Sprintf("%d", dop)
+		},
+		Doc:    "Max number of threads materializing the output fields of one segment result concurrently, per field and per range of rows for large results. 1 fills the fields sequentially.",
+		Export: false,
+	}
+	p.OutputFieldMaxParallelism.Init(base.mgr)
+
+	p.QueryProfileEnabled = ParamItem{
+		Key:          "queryNode.segcore.queryProfileEnabled",
+		Version:      "2.6.0",
+		DefaultValue: "false",
+		Doc:          "Collect wall time, row counts, index usage, skipped chunks and cache traffic of every operator and filter expression a segment query runs, and log the profile of every segment search and retrieve.",
+		Export:       false,
+	}
+	p.QueryProfileEnabled.Init(base.mgr)
+
 	p.KnowhereThreadPoolSize = ParamItem{
 		Key:          "queryNode.segcore.knowhereThreadPoolNumRatio",
 		Version:      "2.0.0",
@@ -3221,6 +3385,17 @@ This defaults to true, indicating that Milvus creates temporary index for growin
 	}
 	p.EnableInterminSegmentIndex.Init(base.mgr)
 
+	p.EnableInterimScalarIndex = ParamItem{
+		Key:          "queryNode.segcore.interimIndex.enableScalarIndex",
+		Version:      "2.6.0",
+		DefaultValue: "false",
+		Doc: `Whether to maintain a temporary index of the integer and VARCHAR fields of growing segments as rows are inserted,
+which term, compare and range filters use instead of scanning the rows. Only takes effect if enableIndex is true.
+The sorted runs cost 4 bytes per indexed row and field.`,
+		Export: true,
+	}
+	p.EnableInterimScalarIndex.Init(base.mgr)
+
 	p.DenseVectorInterminIndexType = ParamItem{
 		Key:          "queryNode.segcore.interimIndex.denseVectorIndexType",
 		Version:      "2.5.4",
@@ -3483,6 +3658,35 @@ However, this optimization may come at the cost of a slight decrease in query la
 	}
 	p.MaxMmapDiskPercentageForMmapManager.Init(base.mgr)
 
+	p.MmapAnonArenaEnabled = ParamItem{
+		Key:          "queryNode.mmap.anonArenaEnabled",
+		Version:      "2.6.0",
+		DefaultValue: "false",
+		Doc: `Back the blocks of the mmap chunk manager with anonymous memory instead of tmp files.
+The blocks are then bounded by maxDiskUsagePercentageForMmapAlloc of the disk capacity as before, but use memory.`,
+		Export: true,
+	}
+	p.MmapAnonArenaEnabled.Init(base.mgr)
+
+	p.MmapHugePageMode = ParamItem{
+		Key:          "queryNode.mmap.hugePageMode",
+		Version:      "2.6.0",
+		DefaultValue: "none",
+		Doc: `Huge pages of the anonymous mmap chunk manager blocks, the options include 'none', 'transparent' and 'explicit'.
+'transparent' asks for transparent huge pages with madvise, 'explicit' maps the blocks from the reserved huge pages and falls back to 'transparent' when they run out.`,
+		Export: true,
+	}
+	p.MmapHugePageMode.Init(base.mgr)
+
+	p.MmapNumaLocal = ParamItem{
+		Key:          "queryNode.mmap.numaLocal",
+		Version:      "2.6.0",
+		DefaultValue: "false",
+		Doc:          "Prefer the numa node of the loading thread for the pages of the anonymous mmap chunk manager blocks, only on hosts with several numa nodes",
+		Export:       true,
+	}
+	p.MmapNumaLocal.Init(base.mgr)
+
 	p.LazyLoadEnabled = ParamItem{
 		Key:          "queryNode.lazyload.enabled",
 		Version:      "2.4.2",